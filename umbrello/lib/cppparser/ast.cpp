@@ -18,6 +18,7 @@
 
 #include "ast.h"
 #include <QStringList>
+#include <QThreadStorage>
 #if QT_VERSION >= 0x050000
 #else
 #include <kdebug.h>
@@ -131,6 +132,100 @@ QString nodeTypeToString(int type)
 
 
 // ------------------------------------------------------------------------
+/**
+ * Every node is preceded by the arena it was taken from, or zero if it was
+ * allocated on the heap. The size keeps the nodes aligned for any member.
+ */
+static const std::size_t HeaderSize = 16;
+
+static const std::size_t BlockSize = 64 * 1024;
+
+struct CurrentArena {
+    ASTArena* arena;
+};
+
+static QThreadStorage<CurrentArena*> currentArena;
+
+ASTArena::ASTArena()
+    : m_free(0), m_left(0), m_owner(0)
+{
+}
+
+ASTArena::~ASTArena()
+{
+    foreach(char* block, m_blocks) {
+        ::operator delete(block);
+    }
+}
+
+void* ASTArena::allocate(std::size_t size)
+{
+    size = (size + HeaderSize - 1) & ~(HeaderSize - 1);
+    if (size > BlockSize / 4) {
+        // large nodes get a block of their own, the current one is kept
+        char* block = static_cast<char*>(::operator new(size));
+        m_blocks.append(block);
+        return block;
+    }
+    if (size > m_left) {
+        m_free = static_cast<char*>(::operator new(BlockSize));
+        m_left = BlockSize;
+        m_blocks.append(m_free);
+    }
+    void* p = m_free;
+    m_free += size;
+    m_left -= size;
+    return p;
+}
+
+ASTArena* ASTArena::current()
+{
+    if (!currentArena.hasLocalData())
+        return 0;
+    return currentArena.localData()->arena;
+}
+
+ASTArena::Scope::Scope(ASTArena* arena)
+    : m_previous(ASTArena::current())
+{
+    if (!currentArena.hasLocalData())
+        currentArena.setLocalData(new CurrentArena);
+    currentArena.localData()->arena = arena;
+}
+
+ASTArena::Scope::~Scope()
+{
+    currentArena.localData()->arena = m_previous;
+}
+
+#if !defined(CPPPARSER_QUICK_ALLOCATOR)
+void* AST::operator new(std::size_t size)
+{
+    ASTArena* arena = ASTArena::current();
+    char* block;
+    if (arena)
+        block = static_cast<char*>(arena->allocate(HeaderSize + size));
+    else
+        block = static_cast<char*>(::operator new(HeaderSize + size));
+    *reinterpret_cast<ASTArena**>(block) = arena;
+    return block + HeaderSize;
+}
+
+void AST::operator delete(void* p)
+{
+    if (!p)
+        return;
+    char* block = static_cast<char*>(p) - HeaderSize;
+    ASTArena* arena = *reinterpret_cast<ASTArena**>(block);
+    if (!arena) {
+        ::operator delete(block);
+    } else if (arena->owner() == p) {
+        // the destructor of the owner has run, now all nodes go
+        delete arena;
+    }
+}
+#endif
+
 AST::AST()
     : m_nodeType(NodeType_Generic), m_parent(0),
       m_startLine(0), m_startColumn(0),
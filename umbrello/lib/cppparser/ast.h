@@ -29,7 +29,9 @@
 #include <KSharedPtr>
 #endif
 
+#include <cstddef>
 #include <memory>
+#include <QList>
 #include <QString>
 #include <QStringList>
 
@@ -225,6 +227,58 @@ QString nodeTypeToString(int type);
 
 #endif
 
+/**
+ * The memory of the nodes of one translation unit.
+ *
+ * While an arena is current in a thread, see ASTArena::Scope, the nodes
+ * created in this thread are taken from its blocks instead of being
+ * allocated one by one. Deleting such a node only runs its destructor, the
+ * memory of all nodes is released in one go when the node owning the arena,
+ * i.e. the TranslationUnitAST, is deleted. Nodes created while no arena is
+ * current are allocated on the heap.
+ */
+class ASTArena
+{
+public:
+    ASTArena();
+    ~ASTArena();
+
+    void* allocate(std::size_t size);
+
+    const void* owner() const
+    {
+        return m_owner;
+    }
+    void setOwner(const void* owner)
+    {
+        m_owner = owner;
+    }
+
+    static ASTArena* current();
+
+    /**
+     * Makes an arena the current one of the thread for the lifetime of the scope.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(ASTArena* arena);
+        ~Scope();
+    private:
+        ASTArena* m_previous;
+    };
+
+private:
+    QList<char*> m_blocks;
+    char* m_free;
+    std::size_t m_left;
+    const void* m_owner;
+
+private:
+    ASTArena(const ASTArena& source);
+    void operator = (const ASTArena& source);
+};
+
 struct Slice {
     QString source;
     int position;
@@ -276,6 +330,11 @@ public:
     AST();
     virtual ~AST();
 
+#if !defined(CPPPARSER_QUICK_ALLOCATOR)
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p);
+#endif
+
     int nodeType() const
     {
         return m_nodeType;
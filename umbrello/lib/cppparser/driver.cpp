@@ -23,6 +23,7 @@
 #include "driver.h"
 #include "lexer.h"
 #include "parser.h"
+#include "parsecache.h"
 
 #include <KLocalizedString>
 #include <stdlib.h>
@@ -108,7 +109,8 @@ private:
 
 
 Driver::Driver()
-    : depresolv(0), lexer(0), m_lexerCache(this), m_dependenceDepth(0), m_maxDependenceDepth(20)
+    : depresolv(0), lexer(0), m_lexerCache(this), m_parseCache(0), m_parseCacheHits(0), m_parseCacheMisses(0),
+      m_dependenceDepth(0), m_maxDependenceDepth(20)
 {
     m_sourceProvider = new DefaultSourceProvider();
 }
@@ -439,6 +441,12 @@ void Driver::addDependence(const QString & fileName, const Dependence & dep)
     }
 
     CachedLexedFilePointer lexedFileP = m_lexerCache.lexedFile(HashedString(file));
+    QByteArray cacheKey;
+    if (!lexedFileP && m_parseCache && dep.second == Dep_Global) {
+        cacheKey = ParseCache::key(file, m_includePaths);
+        if (!cacheKey.isEmpty())
+            lexedFileP = lexedFileFromParseCache(file, cacheKey);
+    }
     if (lexedFileP) {
         CachedLexedFile& lexedFile(*lexedFileP);
         m_currentLexerCache->merge(lexedFile); //The ParseHelper will will copy the include-files into the result later
@@ -456,6 +464,32 @@ void Driver::addDependence(const QString & fileName, const Dependence & dep)
 
     if (shouldParseIncludedFile(m_currentParsedFile)) ///Until the ParseHelper is destroyed, m_currentParsedFile will stay the included file
         h.parse();
+
+    if (!cacheKey.isEmpty())
+        m_parseCache->addLexedFile(cacheKey, *m_currentLexerCache, *m_currentParsedFile);
+}
+
+/**
+ * Look up an include-file in the persistent cache. A stored entry is only used if
+ * the macros it was lexed with fit the current ones, see LexerCache::lexedFile().
+ */
+CachedLexedFilePointer Driver::lexedFileFromParseCache(const QString& fileName, const QByteArray& key)
+{
+    ParsedFilePointer parsedFile;
+    CachedLexedFilePointer lexedFileP = m_parseCache->lexedFile(key, &m_lexerCache, parsedFile);
+    if (lexedFileP) {
+        m_lexerCache.addLexedFile(lexedFileP);
+        lexedFileP = m_lexerCache.lexedFile(HashedString(fileName));
+    }
+    if (!lexedFileP) {
+        DBG_DRV << "no fitting entry for " << fileName << " in the parse-cache" << endl;
+        ++m_parseCacheMisses;
+        return CachedLexedFilePointer();
+    }
+    DBG_DRV << "using the cached " << fileName << endl;
+    ++m_parseCacheHits;
+    m_parsedUnits.insert(fileName, parsedFile);
+    return lexedFileP;
 }
 
 void Driver::addProblem(const QString & fileName, const Problem & problem)
@@ -544,6 +578,9 @@ bool Driver::parseFile(const QString& fileName, bool onlyPreProcess, bool force
 //if(isResolveDependencesEnabled())
     clearParsedMacros(); ///Since everything will be re-lexed, we do not need any old macros
 
+    m_parseCacheHits = 0;
+    m_parseCacheMisses = 0;
+
     m_lexerCache.increaseFrame();
 
     //Remove the problems now instead of in ParseHelper, because this way the problems reported by getCustomIncludePath(...) will not be discarded
@@ -1133,3 +1170,8 @@ LexerCache* Driver::lexerCache()
     return &m_lexerCache;
 }
 
+
+void Driver::setParseCache(ParseCache* cache)
+{
+    m_parseCache = cache;
+}
@@ -36,6 +36,7 @@
 
 class Lexer;
 class Parser;
+class ParseCache;
 
 enum {
     Dep_Global,
@@ -402,6 +403,33 @@ public:
      * */
     LexerCache* lexerCache();
 
+    /**
+     * Set the persistent cache used for global include-files (#include <global.h>), or zero to not use one.
+     * The cache is not owned by the driver, and may be shared with other drivers.
+     */
+    void setParseCache(ParseCache* cache);
+
+    ParseCache* parseCache() const
+    {
+        return m_parseCache;
+    }
+
+    /**
+     * @return How many global include-files were taken from the persistent cache during the last call of parseFile()
+     */
+    int parseCacheHits() const
+    {
+        return m_parseCacheHits;
+    }
+
+    /**
+     * @return How many global include-files had to be lexed because the persistent cache had no fitting entry
+     */
+    int parseCacheMisses() const
+    {
+        return m_parseCacheMisses;
+    }
+
     ///This uses getCustomIncludePath(..) to resolve the include-path internally
     QString findIncludeFile(const Dependence& dep, const QString& fromFile);
 
@@ -436,6 +464,7 @@ protected:
 
 private:
     QMap<QString, Dependence>& findOrInsertDependenceList(const QString& fileName);
+    CachedLexedFilePointer lexedFileFromParseCache(const QString& fileName, const QByteArray& key);
     QList<Problem>& findOrInsertProblemList(const QString& fileName);
 
 
@@ -456,6 +485,9 @@ private:
     ParsedFilePointer m_currentParsedFile;
     CachedLexedFilePointer m_currentLexerCache;
     LexerCache m_lexerCache;
+    ParseCache* m_parseCache;
+    int m_parseCacheHits;
+    int m_parseCacheMisses;
 
     int m_dependenceDepth;
     int m_maxDependenceDepth;
@@ -47,7 +47,7 @@ inline void qthread_yield()
 #endif
 
 #define CREATE_TOKEN(type, start, len) Token((type), (start), (len), m_source)
-#define ADD_TOKEN(tk) m_tokens.insert(m_size++, new Token(tk));
+#define ADD_TOKEN(tk) m_tokens.insert(m_size++, tk);
 
 using namespace std;
 
@@ -123,8 +123,6 @@ Lexer::~Lexer()
 {
     d->endScope();
     delete(d);
-    qDeleteAll(m_tokens);
-    m_tokens.clear();
 }
 
 void Lexer::setSource(const QString& source)
@@ -213,10 +211,6 @@ void Lexer::nextToken(Token& tk, bool stopOnNewline)
 {
     int op = 0;
 
-    if (m_size == (int)m_tokens.size()) {
-        m_tokens.resize(m_tokens.size() + 5000 + 1);
-    }
-
     readWhiteSpaces(!stopOnNewline);
 
     int startLine = m_currentLine;
@@ -491,6 +485,8 @@ void Lexer::tokenize()
 {
     m_startLine = true;
     m_size = 0;
+    // a rough estimate, to avoid growing the vector many times
+    m_tokens.reserve(m_source.length() / 8 + 1);
 
     for (;;) {
         Token tk(m_source);
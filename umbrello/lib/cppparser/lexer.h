@@ -29,6 +29,7 @@
 #include <QString>
 #include <qmap.h>
 #include <qpair.h>
+#include <QVector>
 #include <hashedstring.h>
 
 #define CHARTYPE QChar
@@ -151,17 +152,22 @@ enum SkipType {
 
 struct LexerData;
 
+/**
+ * A token refers to its text in the source of the lexer by position and
+ * length. It does not own any data, so the lexer keeps its tokens by value
+ * in a single vector.
+ */
 class Token
 {
     explicit Token(const QString &);
     Token(int type, int position, int length, const QString& text);
-    Token(const Token& source);
 
-    Token& operator = (const Token& source);
     bool operator == (const Token& token) const;
     operator int () const;
 
 public:
+    Token();
+
     bool isNull() const;
 
     int type() const;
@@ -188,12 +194,14 @@ private:
     int m_startColumn;
     int m_endLine;
     int m_endColumn;
-    const QString & m_text;
+    const QString * m_text;
 
     friend class Lexer;
     friend class Parser;
 }; // class Token
 
+Q_DECLARE_TYPEINFO(Token, Q_MOVABLE_TYPE);
+
 class Lexer
 {
 public:
@@ -323,7 +331,7 @@ private:
 private:
     LexerData* d;
     Driver* m_driver;
-    QVector<Token*> m_tokens;
+    QVector<Token> m_tokens;
     int m_size;
     int m_index;
     QString m_source;
@@ -357,6 +365,18 @@ private:
 };
 
 
+inline Token::Token()
+    : m_type(-1),
+      m_position(0),
+      m_length(0),
+      m_startLine(0),
+      m_startColumn(0),
+      m_endLine(0),
+      m_endColumn(0),
+      m_text(0)
+{
+}
+
 inline Token::Token(const QString & text)
     : m_type(-1),
       m_position(0),
@@ -365,7 +385,7 @@ inline Token::Token(const QString & text)
       m_startColumn(0),
       m_endLine(0),
       m_endColumn(0),
-      m_text(text)
+      m_text(&text)
 {
 }
 
@@ -377,36 +397,11 @@ inline Token::Token(int type, int position, int length, const QString& text)
       m_startColumn(0),
       m_endLine(0),
       m_endColumn(0),
-      m_text(text)
+      m_text(&text)
 {
     DBG_LEXER << type << position << length << text.mid(position, length);
 }
 
-inline Token::Token(const Token& source)
-    : m_type(source.m_type),
-      m_position(source.m_position),
-      m_length(source.m_length),
-      m_startLine(source.m_startLine),
-      m_startColumn(source.m_startColumn),
-      m_endLine(source.m_endLine),
-      m_endColumn(source.m_endColumn),
-      m_text(source.m_text)
-{
-}
-
-inline Token& Token::operator = (const Token& source)
-{
-    m_type = source.m_type;
-    m_position = source.m_position;
-    m_length = source.m_length;
-    m_startLine = source.m_startLine;
-    m_startColumn = source.m_startColumn;
-    m_endLine = source.m_endLine;
-    m_endColumn = source.m_endColumn;
-//    m_text = source.m_text;
-    return (*this);
-}
-
 inline Token::operator int () const
 {
     return m_type;
@@ -421,7 +416,7 @@ inline bool Token::operator == (const Token& token) const
            m_startColumn == token.m_startColumn &&
            m_endLine == token.m_endLine &&
            m_endColumn == token.m_endColumn &&
-           m_text == token.m_text;
+           (m_text == token.m_text || (m_text && token.m_text && *m_text == *token.m_text));
 }
 
 inline bool Token::isNull() const
@@ -446,7 +441,9 @@ inline int Token::position() const
 
 inline QString Token::text() const
 {
-    return m_text.mid(m_position, m_length);
+    if (!m_text)
+        return QString();
+    return m_text->mid(m_position, m_length);
 }
 
 inline void Token::setStartPosition(int line, int column)
@@ -526,19 +523,19 @@ inline void Lexer::setIndex(int index)
 inline const Token& Lexer::nextToken()
 {
     if (m_index < m_size)
-        return *m_tokens[ m_index++ ];
+        return m_tokens.at(m_index++);
 
-    return *m_tokens[ m_index ];
+    return m_tokens.at(m_index);
 }
 
 inline const Token& Lexer::tokenAt(int n) const
 {
-    return *m_tokens[ qMin(n, m_size-1) ];
+    return m_tokens.at(qMin(n, m_size-1));
 }
 
 inline const Token& Lexer::lookAhead(int n) const
 {
-    Token &t = *m_tokens[ qMin(m_index + n, m_size-1) ];
+    const Token &t = m_tokens.at(qMin(m_index + n, m_size-1));
     DBG_LEXER << t;
     return t;
 }
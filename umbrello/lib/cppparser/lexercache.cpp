@@ -179,6 +179,66 @@ CachedLexedFile::CachedLexedFile(const HashedString& fileName, LexerCache* manag
     m_allModificationTimes[ fileName ] = m_modificationTime;
 }
 
+CachedLexedFile::CachedLexedFile(QDataStream& stream, LexerCache* manager) : CacheNode(manager)
+{
+    read(stream);
+    QFileInfo fileInfo(m_fileName.str());
+    m_modificationTime = fileInfo.lastModified();
+    m_allModificationTimes[ m_fileName ] = m_modificationTime;
+}
+
+void CachedLexedFile::read(QDataStream& stream)
+{
+    stream >> m_fileName;
+    stream >> m_modificationTime;
+    m_strings.read(stream);
+    m_includeFiles.read(stream);
+    m_usedMacros.read(stream);
+    m_definedMacros.read(stream);
+    m_definedMacroNames.read(stream);
+
+    int problemCount;
+    stream >> problemCount;
+    m_problems.clear();
+    for (int a = 0; a < problemCount; a++) {
+        Problem p;
+        p.read(stream);
+        m_problems << p;
+    }
+
+    int fileCount;
+    stream >> fileCount;
+    m_allModificationTimes.clear();
+    for (int a = 0; a < fileCount; a++) {
+        HashedString file;
+        QDateTime modificationTime;
+        stream >> file;
+        stream >> modificationTime;
+        m_allModificationTimes[ file ] = modificationTime;
+    }
+}
+
+void CachedLexedFile::write(QDataStream& stream) const
+{
+    stream << m_fileName;
+    stream << m_modificationTime;
+    m_strings.write(stream);
+    m_includeFiles.write(stream);
+    m_usedMacros.write(stream);
+    m_definedMacros.write(stream);
+    m_definedMacroNames.write(stream);
+
+    stream << int(m_problems.size());
+    for (QList<Problem>::const_iterator it = m_problems.begin(); it != m_problems.end(); ++it)
+        (*it).write(stream);
+
+    stream << int(m_allModificationTimes.size());
+    for (QMap<HashedString, QDateTime>::const_iterator it = m_allModificationTimes.begin(); it != m_allModificationTimes.end(); ++it) {
+        stream << it.key();
+        stream << *it;
+    }
+}
+
 void CachedLexedFile::addDefinedMacro(const Macro& macro)
 {
     DBG_LXC << "defined macro " << macro.name() << endl;
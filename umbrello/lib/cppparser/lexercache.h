@@ -34,6 +34,9 @@ public:
     ///@todo add and manage the set of included files
     CachedLexedFile(const HashedString& fileName, LexerCache* manager);
 
+    ///Deserializes a file written by write(). The modification-time of the file itself is set to the current one.
+    CachedLexedFile(QDataStream& stream, LexerCache* manager);
+
     inline void addString(const HashedString& string)
     {
         if (!m_definedMacroNames[ string ]) {
@@ -94,6 +97,9 @@ public:
         return m_allModificationTimes;
     }
 
+    void read(QDataStream& stream);
+    void write(QDataStream& stream) const;
+
 private:
     friend class LexerCache;
     HashedString m_fileName;
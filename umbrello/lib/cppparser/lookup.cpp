@@ -27,14 +27,18 @@ int Lookup::find(const HashedString& s)
     return static_cast<int>((*it));
 }
 
-const Lookup::KeywordMap& Lookup::keywords()
+static Lookup::KeywordMap createKeywords()
 {
-    static KeywordMap keywords;
-
-    if (keywords.empty()) {
+    Lookup::KeywordMap keywords;
 #include "keywords.h"
-    }
+    return keywords;
+}
 
+const Lookup::KeywordMap& Lookup::keywords()
+{
+    // lexers may run in several threads, the initialization of a
+    // function local static is thread safe
+    static const KeywordMap keywords = createKeywords();
     return keywords;
 }
 
@@ -109,6 +109,24 @@ public:
         return m_level;
     }
 
+    void read(QDataStream& stream)
+    {
+        stream >> m_text;
+        stream >> m_line;
+        stream >> m_column;
+        stream >> m_level;
+        stream >> m_file;
+    }
+
+    void write(QDataStream& stream) const
+    {
+        stream << m_text;
+        stream << m_line;
+        stream << m_column;
+        stream << m_level;
+        stream << m_file;
+    }
+
 private:
     QString m_text;
     int m_line;
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#include "parsecache.h"
+
+#include "debug_utils.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryFile>
+
+#define DBG_PRC DEBUG(QLatin1String("ParseCache"))
+
+DEBUG_REGISTER_DISABLED(ParseCache)
+
+/**
+ * Identifies the files written by ParseCache, the number is increased
+ * whenever the format of the entries changes.
+ */
+static const quint32 Magic = 0x55504301;
+
+ParseCache::ParseCache(const QString& directory) : m_directory(directory)
+{
+    QDir().mkpath(m_directory);
+}
+
+QString ParseCache::directory() const
+{
+    return m_directory;
+}
+
+/**
+ * Build the key of the entry for a file from its name, its content and
+ * the include-path. An empty key is returned if the file can not be read.
+ */
+QByteArray ParseCache::key(const QString& fileName, const QStringList& includePaths)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(fileName.toUtf8());
+    hash.addData("\n", 1);
+    hash.addData(includePaths.join(QLatin1String("\n")).toUtf8());
+    hash.addData("\n", 1);
+    hash.addData(file.readAll());
+    return hash.result().toHex();
+}
+
+CachedLexedFilePointer ParseCache::lexedFile(const QByteArray& key, LexerCache* manager, ParsedFilePointer& parsedFile) const
+{
+    QFile file(entryPath(key));
+    if (!file.open(QIODevice::ReadOnly))
+        return CachedLexedFilePointer();
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_8);
+    quint32 magic;
+    QByteArray storedKey;
+    stream >> magic >> storedKey;
+    if (magic != Magic || storedKey != key) {
+        DBG_PRC << "discarding the outdated entry " << file.fileName() << endl;
+        return CachedLexedFilePointer();
+    }
+
+    CachedLexedFilePointer lexedFile(new CachedLexedFile(stream, manager));
+    ParsedFilePointer parsed(new ParsedFile(stream));
+    if (stream.status() != QDataStream::Ok) {
+        DBG_PRC << "could not read the entry " << file.fileName() << endl;
+        return CachedLexedFilePointer();
+    }
+    parsedFile = parsed;
+    return lexedFile;
+}
+
+/**
+ * Store the results of lexing a file. The entry is written to a temporary
+ * file first, so that drivers in other threads never read a partial entry.
+ */
+void ParseCache::addLexedFile(const QByteArray& key, const CachedLexedFile& lexedFile, const ParsedFile& parsedFile)
+{
+    if (key.isEmpty())
+        return;
+
+    QTemporaryFile file(m_directory + QLatin1String("/entry"));
+    file.setAutoRemove(false);
+    if (!file.open())
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_8);
+    stream << Magic << key;
+    lexedFile.write(stream);
+    parsedFile.write(stream);
+    file.close();
+
+    const QString path = entryPath(key);
+    QFile::remove(path);
+    if (stream.status() != QDataStream::Ok || !QFile::rename(file.fileName(), path)) {
+        DBG_PRC << "could not write the entry for " << lexedFile.fileName().str() << endl;
+        QFile::remove(file.fileName());
+    }
+}
+
+/**
+ * Remove all entries.
+ */
+void ParseCache::clear()
+{
+    QDir dir(m_directory);
+    foreach(const QString& entry, dir.entryList(QDir::Files)) {
+        dir.remove(entry);
+    }
+}
+
+QString ParseCache::entryPath(const QByteArray& key) const
+{
+    return m_directory + QLatin1Char('/') + QString::fromLatin1(key);
+}
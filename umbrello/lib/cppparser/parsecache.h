@@ -0,0 +1,57 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef PARSECACHE_H
+#define PARSECACHE_H
+
+#include "driver.h"
+#include "lexercache.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+/**
+ * A cache of lexed and preprocessed include-files that is kept on disk, so
+ * that it survives Driver::reset() and restarts of the application.
+ *
+ * Each entry stores the CachedLexedFile of an include-file, with the macros
+ * it defines and uses and the files it includes, together with its
+ * ParsedFile (without AST). An entry is identified by a key built from the
+ * name and the content of the file and from the include-path it was
+ * resolved with, so it is found again as long as the file is unchanged.
+ * Whether the macros the file was lexed with fit the current context is
+ * checked by LexerCache::lexedFile() as for the entries kept in memory.
+ *
+ * The cache may be shared by drivers working in different threads.
+ */
+class ParseCache
+{
+public:
+    explicit ParseCache(const QString& directory);
+
+    QString directory() const;
+
+    static QByteArray key(const QString& fileName, const QStringList& includePaths);
+
+    ///Returns zero if there is no entry for the key. @p parsedFile is set to the stored ParsedFile.
+    CachedLexedFilePointer lexedFile(const QByteArray& key, LexerCache* manager, ParsedFilePointer& parsedFile) const;
+
+    void addLexedFile(const QByteArray& key, const CachedLexedFile& lexedFile, const ParsedFile& parsedFile);
+
+    void clear();
+
+private:
+    QString entryPath(const QByteArray& key) const;
+
+    QString m_directory;
+};
+
+#endif
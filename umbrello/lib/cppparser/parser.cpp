@@ -443,7 +443,12 @@ bool Parser::parseTranslationUnit(TranslationUnitAST::Node& node)
     int start = lex->index();
 
     m_problems = 0;
+    // all nodes of the translation unit are taken from an arena that is
+    // released together with the translation unit
+    ASTArena* arena = new ASTArena;
+    ASTArena::Scope scope(arena);
     TranslationUnitAST::Node tun = CreateNode<TranslationUnitAST>();
+    arena->setOwner(tun.data());
     node = tun;
     // only setup file comment if present at first line, and first column
     if (lex->lookAhead(0) == Token_comment) {
@@ -0,0 +1,273 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+/*
+ * Generates the keyword tables of the code generators, see KeywordTable.
+ *
+ * Each input file describes one language:
+ *
+ *   # comment
+ *   %case-insensitive
+ *   [keywords]
+ *   word
+ *   [datatypes]
+ *   word with spaces
+ *
+ * Directives are only recognized before the first section. The base name
+ * of the file gives the names of the tables, e.g. ada.keywords defines
+ * KeywordTables::adaKeywords and KeywordTables::adaDatatypes. A missing
+ * section results in an empty table.
+ */
+
+#include "keywordtable.h"
+
+#include <stdlib.h>
+#include <iostream>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QRegExp>
+#include <QSet>
+#include <QStringList>
+#include <QTextStream>
+#include <QVector>
+
+using namespace std;
+
+struct Table {
+    QString name;
+    QStringList words;
+    bool caseSensitive;
+    QVector<qint16> slotWords;   ///< index of the word in a slot, -1 if empty
+    QVector<quint16> displacements;
+};
+
+static QString folded(const QString &word, bool caseSensitive)
+{
+    if (caseSensitive)
+        return word;
+    QString result = word;
+    for (int i = 0; i < result.length(); ++i)
+        result[i] = QChar(KeywordTable::foldCase(result[i].unicode()));
+    return result;
+}
+
+/**
+ * Place the words with a slot count of a power of two and about four
+ * words per bucket. Buckets are placed largest first, each with the
+ * first displacement moving all of its words to free slots. If a bucket
+ * cannot be placed the number of slots is doubled.
+ */
+static bool buildHash(Table &table)
+{
+    const int count = table.words.size();
+    QVector<quint32> hashes(count);
+    for (int i = 0; i < count; ++i)
+        hashes[i] = KeywordTable::hash(table.words[i].constData(), table.words[i].length(), table.caseSensitive);
+
+    const int bucketCount = qMax(1, (count + 3) / 4);
+    QVector<QVector<int> > buckets(bucketCount);
+    for (int i = 0; i < count; ++i)
+        buckets[hashes[i] % bucketCount].append(i);
+    QVector<int> order;
+    for (int size = count; size > 0; --size) {
+        for (int b = 0; b < bucketCount; ++b) {
+            if (buckets[b].size() == size)
+                order.append(b);
+        }
+    }
+
+    int slotCount = 1;
+    while (slotCount < count + count / 4)
+        slotCount *= 2;
+
+    for (; slotCount <= 0x10000; slotCount *= 2) {
+        const quint32 mask = slotCount - 1;
+        table.slotWords.fill(-1, slotCount);
+        table.displacements.fill(0, bucketCount);
+        bool placed = true;
+        foreach (int b, order) {
+            const QVector<int> &bucket = buckets[b];
+            QVector<quint32> positions(bucket.size());
+            bool found = false;
+            for (quint32 d = 0; d <= 0xFFFF && !found; ++d) {
+                found = true;
+                for (int i = 0; i < bucket.size() && found; ++i) {
+                    positions[i] = KeywordTable::slot(hashes[bucket[i]], d) & mask;
+                    if (table.slotWords[positions[i]] >= 0)
+                        found = false;
+                    for (int j = 0; j < i && found; ++j) {
+                        if (positions[j] == positions[i])
+                            found = false;
+                    }
+                }
+                if (found) {
+                    table.displacements[b] = d;
+                    for (int i = 0; i < bucket.size(); ++i)
+                        table.slotWords[positions[i]] = bucket[i];
+                }
+            }
+            if (!found) {
+                placed = false;
+                break;
+            }
+        }
+        if (placed)
+            return true;
+    }
+    return false;
+}
+
+static bool readFile(const QString &fileName, Table &keywords, Table &datatypes)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        cerr << "cannot open " << qPrintable(fileName) << endl;
+        return false;
+    }
+
+    const QString name = QFileInfo(fileName).completeBaseName();
+    if (!QRegExp(QLatin1String("[a-z][a-z0-9]*")).exactMatch(name)) {
+        cerr << qPrintable(fileName) << ": the base name is no valid identifier" << endl;
+        return false;
+    }
+    keywords.name = name + QLatin1String("Keywords");
+    datatypes.name = name + QLatin1String("Datatypes");
+    keywords.caseSensitive = datatypes.caseSensitive = true;
+
+    QTextStream stream(&file);
+    Table *section = 0;
+    QSet<QString> seen;
+    for (int lineNumber = 1; !stream.atEnd(); ++lineNumber) {
+        const QString line = stream.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#')))
+            continue;
+        if (line == QLatin1String("[keywords]") || line == QLatin1String("[datatypes]")) {
+            section = line == QLatin1String("[keywords]") ? &keywords : &datatypes;
+            seen.clear();
+            foreach (const QString &word, section->words)
+                seen.insert(folded(word, section->caseSensitive));
+            continue;
+        }
+        if (section == 0) {
+            if (line == QLatin1String("%case-insensitive")) {
+                keywords.caseSensitive = datatypes.caseSensitive = false;
+                continue;
+            }
+            cerr << qPrintable(fileName) << ":" << lineNumber << ": unknown directive" << endl;
+            return false;
+        }
+        for (int i = 0; i < line.length(); ++i) {
+            if (line[i].unicode() < 0x20 || line[i].unicode() > 0x7e) {
+                cerr << qPrintable(fileName) << ":" << lineNumber << ": the word is not printable ASCII" << endl;
+                return false;
+            }
+        }
+        const QString key = folded(line, section->caseSensitive);
+        if (seen.contains(key)) {
+            cerr << qPrintable(fileName) << ":" << lineNumber << ": duplicate word " << qPrintable(line) << endl;
+            return false;
+        }
+        seen.insert(key);
+        section->words.append(line);
+        if (section->words.size() > 0x7fff) {
+            cerr << qPrintable(fileName) << ": too many words" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static QString cString(const QString &word)
+{
+    QString result = word;
+    result.replace(QLatin1Char('\\'), QLatin1String("\\\\"));
+    result.replace(QLatin1Char('"'), QLatin1String("\\\""));
+    result.replace(QLatin1String("??"), QLatin1String("?\\?"));
+    return QLatin1Char('"') + result + QLatin1Char('"');
+}
+
+template <typename T>
+static void writeNumbers(QTextStream &out, const QVector<T> &numbers)
+{
+    for (int i = 0; i < numbers.size(); ++i) {
+        out << (i % 16 == 0 ? "\n    " : " ") << numbers[i];
+        if (i + 1 < numbers.size())
+            out << ",";
+    }
+    out << "\n";
+}
+
+static void writeTable(QTextStream &out, const Table &table)
+{
+    const QString caseSensitive = table.caseSensitive ? QLatin1String("true") : QLatin1String("false");
+    if (table.words.isEmpty()) {
+        out << "extern Q_DECL_CONSTEXPR const KeywordTable " << table.name << " = {\n"
+            << "    0, 0, 0, 0, 0, 1, " << caseSensitive << "\n};\n\n";
+        return;
+    }
+
+    out << "static Q_DECL_CONSTEXPR const char *const " << table.name << "Words[] = {\n";
+    foreach (const QString &word, table.words)
+        out << "    " << cString(word) << ",\n";
+    out << "};\n\n";
+
+    out << "static Q_DECL_CONSTEXPR const qint16 " << table.name << "Slots[] = {";
+    writeNumbers(out, table.slotWords);
+    out << "};\n\n";
+
+    out << "static Q_DECL_CONSTEXPR const quint16 " << table.name << "Displacements[] = {";
+    writeNumbers(out, table.displacements);
+    out << "};\n\n";
+
+    out << "extern Q_DECL_CONSTEXPR const KeywordTable " << table.name << " = {\n"
+        << "    " << table.name << "Words, " << table.words.size() << ",\n"
+        << "    " << table.name << "Slots, " << table.slotWords.size() - 1 << ",\n"
+        << "    " << table.name << "Displacements, " << table.displacements.size() << ",\n"
+        << "    " << caseSensitive << "\n"
+        << "};\n\n";
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        qWarning("usage: %s output-CPP keywords-file...", argv[0]);
+        ::exit(1);
+    }
+
+    QList<Table> tables;
+    for (int i = 2; i < argc; ++i) {
+        Table keywords, datatypes;
+        const QString fileName = QFile::decodeName(argv[i]);
+        if (!readFile(fileName, keywords, datatypes))
+            ::exit(2);
+        if (!buildHash(keywords) || !buildHash(datatypes)) {
+            cerr << qPrintable(fileName) << ": no perfect hash found" << endl;
+            ::exit(2);
+        }
+        tables << keywords << datatypes;
+    }
+
+    QFile file(QFile::decodeName(argv[1]));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        cerr << "cannot write " << argv[1] << endl;
+        ::exit(3);
+    }
+
+    QTextStream out(&file);
+    out << "// Generated by keywords2cpp, do not edit.\n\n"
+        << "#include \"keywordtable.h\"\n\n"
+        << "namespace KeywordTables\n{\n\n";
+    foreach (const Table &table, tables)
+        writeTable(out, table);
+    out << "}\n";
+    out.flush();
+    return file.error() == QFile::NoError ? 0 : 3;
+}
@@ -20,6 +20,7 @@
 #include "basictypes.h"
 
 #include "debug_utils.h"
+#include "keywordtable.h"
 
 // kde includes
 #include <KLocalizedString>
@@ -33,6 +34,53 @@
 #endif
 #include <QRegExp>
 
+// generated by keywords2cpp from the *.keywords files of the code generators
+namespace KeywordTables
+{
+extern const KeywordTable adaKeywords;
+extern const KeywordTable adaDatatypes;
+extern const KeywordTable asKeywords;
+extern const KeywordTable asDatatypes;
+extern const KeywordTable cppKeywords;
+extern const KeywordTable cppDatatypes;
+extern const KeywordTable csharpKeywords;
+extern const KeywordTable csharpDatatypes;
+extern const KeywordTable dKeywords;
+extern const KeywordTable dDatatypes;
+extern const KeywordTable idlKeywords;
+extern const KeywordTable idlDatatypes;
+extern const KeywordTable javaKeywords;
+extern const KeywordTable javaDatatypes;
+extern const KeywordTable jsKeywords;
+extern const KeywordTable jsDatatypes;
+extern const KeywordTable mysqlKeywords;
+extern const KeywordTable mysqlDatatypes;
+extern const KeywordTable pascalKeywords;
+extern const KeywordTable pascalDatatypes;
+extern const KeywordTable perlKeywords;
+extern const KeywordTable perlDatatypes;
+extern const KeywordTable phpKeywords;
+extern const KeywordTable phpDatatypes;
+extern const KeywordTable php5Keywords;
+extern const KeywordTable php5Datatypes;
+extern const KeywordTable postgresqlKeywords;
+extern const KeywordTable postgresqlDatatypes;
+extern const KeywordTable pythonKeywords;
+extern const KeywordTable pythonDatatypes;
+extern const KeywordTable rubyKeywords;
+extern const KeywordTable rubyDatatypes;
+extern const KeywordTable sqlKeywords;
+extern const KeywordTable sqlDatatypes;
+extern const KeywordTable tclKeywords;
+extern const KeywordTable tclDatatypes;
+extern const KeywordTable valaKeywords;
+extern const KeywordTable valaDatatypes;
+extern const KeywordTable xmlschemaKeywords;
+extern const KeywordTable xmlschemaDatatypes;
+
+static const KeywordTable emptyTable = { 0, 0, 0, 0, 0, 1, true };
+}
+
 namespace Uml
 {
 
@@ -997,6 +1045,113 @@ QString toExtensionsDescription(Enum item)
     return toString(item) + QLatin1String(" ") + result;
 }
 
+/**
+ * Return the reserved keywords of the requested language.
+ * MySQL and PostgreSQL share the keywords of SQL.
+ * @param item programming language index
+ * @return keyword table, empty for unknown languages
+ */
+const KeywordTable& reservedKeywords(Enum item)
+{
+    switch (item) {
+        case Uml::ProgrammingLanguage::ActionScript:
+            return KeywordTables::asKeywords;
+        case Uml::ProgrammingLanguage::Ada:
+            return KeywordTables::adaKeywords;
+        case Uml::ProgrammingLanguage::Cpp:
+            return KeywordTables::cppKeywords;
+        case Uml::ProgrammingLanguage::CSharp:
+            return KeywordTables::csharpKeywords;
+        case Uml::ProgrammingLanguage::D:
+            return KeywordTables::dKeywords;
+        case Uml::ProgrammingLanguage::IDL:
+            return KeywordTables::idlKeywords;
+        case Uml::ProgrammingLanguage::Java:
+            return KeywordTables::javaKeywords;
+        case Uml::ProgrammingLanguage::JavaScript:
+            return KeywordTables::jsKeywords;
+        case Uml::ProgrammingLanguage::MySQL:
+            return KeywordTables::sqlKeywords;
+        case Uml::ProgrammingLanguage::Pascal:
+            return KeywordTables::pascalKeywords;
+        case Uml::ProgrammingLanguage::Perl:
+            return KeywordTables::perlKeywords;
+        case Uml::ProgrammingLanguage::PHP:
+            return KeywordTables::phpKeywords;
+        case Uml::ProgrammingLanguage::PHP5:
+            return KeywordTables::php5Keywords;
+        case Uml::ProgrammingLanguage::PostgreSQL:
+            return KeywordTables::sqlKeywords;
+        case Uml::ProgrammingLanguage::Python:
+            return KeywordTables::pythonKeywords;
+        case Uml::ProgrammingLanguage::Ruby:
+            return KeywordTables::rubyKeywords;
+        case Uml::ProgrammingLanguage::SQL:
+            return KeywordTables::sqlKeywords;
+        case Uml::ProgrammingLanguage::Tcl:
+            return KeywordTables::tclKeywords;
+        case Uml::ProgrammingLanguage::Vala:
+            return KeywordTables::valaKeywords;
+        case Uml::ProgrammingLanguage::XMLSchema:
+            return KeywordTables::xmlschemaKeywords;
+        default:
+            return KeywordTables::emptyTable;
+    }
+}
+
+/**
+ * Return the default datatypes of the requested language.
+ * @param item programming language index
+ * @return keyword table, empty for unknown languages
+ */
+const KeywordTable& defaultDatatypes(Enum item)
+{
+    switch (item) {
+        case Uml::ProgrammingLanguage::ActionScript:
+            return KeywordTables::asDatatypes;
+        case Uml::ProgrammingLanguage::Ada:
+            return KeywordTables::adaDatatypes;
+        case Uml::ProgrammingLanguage::Cpp:
+            return KeywordTables::cppDatatypes;
+        case Uml::ProgrammingLanguage::CSharp:
+            return KeywordTables::csharpDatatypes;
+        case Uml::ProgrammingLanguage::D:
+            return KeywordTables::dDatatypes;
+        case Uml::ProgrammingLanguage::IDL:
+            return KeywordTables::idlDatatypes;
+        case Uml::ProgrammingLanguage::Java:
+            return KeywordTables::javaDatatypes;
+        case Uml::ProgrammingLanguage::JavaScript:
+            return KeywordTables::jsDatatypes;
+        case Uml::ProgrammingLanguage::MySQL:
+            return KeywordTables::mysqlDatatypes;
+        case Uml::ProgrammingLanguage::Pascal:
+            return KeywordTables::pascalDatatypes;
+        case Uml::ProgrammingLanguage::Perl:
+            return KeywordTables::perlDatatypes;
+        case Uml::ProgrammingLanguage::PHP:
+            return KeywordTables::phpDatatypes;
+        case Uml::ProgrammingLanguage::PHP5:
+            return KeywordTables::php5Datatypes;
+        case Uml::ProgrammingLanguage::PostgreSQL:
+            return KeywordTables::postgresqlDatatypes;
+        case Uml::ProgrammingLanguage::Python:
+            return KeywordTables::pythonDatatypes;
+        case Uml::ProgrammingLanguage::Ruby:
+            return KeywordTables::rubyDatatypes;
+        case Uml::ProgrammingLanguage::SQL:
+            return KeywordTables::sqlDatatypes;
+        case Uml::ProgrammingLanguage::Tcl:
+            return KeywordTables::tclDatatypes;
+        case Uml::ProgrammingLanguage::Vala:
+            return KeywordTables::valaDatatypes;
+        case Uml::ProgrammingLanguage::XMLSchema:
+            return KeywordTables::xmlschemaDatatypes;
+        default:
+            return KeywordTables::emptyTable;
+    }
+}
+
 }  // end namespace ProgrammingLanguage
 
 //-----------------------------------------------------------------------------
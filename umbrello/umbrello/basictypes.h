@@ -26,6 +26,8 @@
 
 #include <string>
 
+struct KeywordTable;
+
 /**
  * This namespace contains all the enums used all over the code base.
  * The enums are embedded into namespaces and useful functionality is added.
@@ -275,6 +277,8 @@ namespace Uml
         Enum fromInt(int item);
         QStringList toExtensions(Enum item);
         QString toExtensionsDescription(Enum item);
+        const KeywordTable& reservedKeywords(Enum item);
+        const KeywordTable& defaultDatatypes(Enum item);
     }
 
     /**
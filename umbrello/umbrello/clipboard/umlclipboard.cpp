@@ -200,6 +200,7 @@ bool UMLClipboard::paste(const QMimeData* data)
     uDebug() << "Pasting mimeType=" << mimeType << "data=" << data->data(mimeType);
 
     bool result = false;
+    doc->beginChangeBatch();
     doc->beginPaste();
 
     switch (codingType) {
@@ -222,6 +223,7 @@ bool UMLClipboard::paste(const QMimeData* data)
         break;
     }
     doc->endPaste();
+    doc->commitChangeBatch();
     return result;
 }
 
@@ -68,11 +68,13 @@ CmdLineExportAllViewsEvent::~CmdLineExportAllViewsEvent()
  * Exports all the views using UMLViewImageExporterModel, prints the errors
  * occurred in the error output and quits the application.
  * To export the views, it uses the attributes set when the event was created.
+ * Views which have not changed since the last export to the same directory
+ * are not exported again.
  */
 void CmdLineExportAllViewsEvent::exportAllViews()
 {
     UMLViewList views = UMLApp::app()->document()->viewIterator();
-    QStringList errors = UMLViewImageExporterModel().exportViews(views, m_imageType, m_directory, m_useFolders);
+    QStringList errors = UMLViewImageExporterModel().exportViews(views, m_imageType, m_directory, m_useFolders, true);
     if (!errors.isEmpty()) {
         uError() << "CmdLineExportAllViewsEvent::exportAllViews(): Errors while exporting:";
         for (QStringList::Iterator it = errors.begin(); it != errors.end(); ++it) {
@@ -23,6 +23,7 @@
 #include "cmds/cmd_removeDiagram.h"
 #include "cmds/cmd_setStereotype.h"
 #include "cmds/cmd_setVisibility.h"
+#include "cmds/cmd_xmiSnapshot.h"
 
 /************************************************************
  * Generic
@@ -18,6 +18,8 @@
 
 #include <KLocalizedString>
 
+#include <QDomDocument>
+
 namespace Uml
 {
 
@@ -37,12 +39,7 @@ namespace Uml
         setText(msg);
 
         // Save diagram XMI for undo
-        QDomDocument doc;
-        QDomElement container = doc.createElement(QLatin1String("diagram"));
-        scene->saveToXMI(doc, container);
-
-        // The first child element contains the diagram XMI
-        m_element = container.firstChild().toElement();
+        m_snapshot.save(scene);
     }
 
     CmdRemoveDiagram::~CmdRemoveDiagram()
@@ -56,10 +53,15 @@ namespace Uml
 
     void CmdRemoveDiagram::undo()
     {
+        QDomDocument xmi;
+        QDomElement element = m_snapshot.element(xmi);
+
         UMLDoc* doc = UMLApp::app()->document();
         UMLView* view = doc->createDiagram(m_folder, m_type, m_name, m_sceneId);
 
-        view->umlScene()->loadFromXMI(m_element);
+        if (!element.isNull()) {
+            view->umlScene()->loadFromXMI(element);
+        }
     }
 
 }
@@ -12,8 +12,8 @@
 #define CMD_REMOVE_DIAGRAM_H
 
 #include "basictypes.h"
+#include "cmd_xmiSnapshot.h"
 
-#include <QDomElement>
 #include <QUndoCommand>
 
 class UMLFolder;
@@ -37,7 +37,7 @@ namespace Uml
         Uml::DiagramType::Enum m_type;
         QString         m_name;
         Uml::ID::Type   m_sceneId;
-        QDomElement     m_element;
+        XMISnapshot     m_snapshot;
     };
 }
 
@@ -0,0 +1,222 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#include "cmd_xmiSnapshot.h"
+
+// app includes
+#include "debug_utils.h"
+#include "umlscene.h"
+#include "umlwidget.h"
+
+// kde includes
+#if QT_VERSION < 0x050000
+#include <ktemporaryfile.h>
+#endif
+
+// qt includes
+#include <QDomDocument>
+#include <QList>
+#include <QTemporaryFile>
+#include <QTextStream>
+
+/**
+ * All snapshots in the order they were created, the oldest first.
+ */
+static QList<Uml::XMISnapshot*> s_snapshots;
+
+/**
+ * The size of the compressed XMI of all snapshots kept in memory.
+ */
+static qint64 s_memoryUsage = 0;
+
+/**
+ * The size the snapshots in memory may reach before they are swapped out.
+ */
+static qint64 s_memoryBudget = 32 * 1024 * 1024;
+
+/**
+ * The file the swapped out snapshots are appended to. It is removed
+ * when the last snapshot has been deleted.
+ */
+static QTemporaryFile *s_swapFile = 0;
+
+namespace Uml
+{
+
+    /**
+     * Constructor, creates an empty snapshot.
+     */
+    XMISnapshot::XMISnapshot()
+      : m_offset(-1),
+        m_size(0)
+    {
+        s_snapshots.append(this);
+    }
+
+    /**
+     * Destructor.
+     */
+    XMISnapshot::~XMISnapshot()
+    {
+        if (m_offset < 0) {
+            s_memoryUsage -= m_size;
+        }
+        s_snapshots.removeOne(this);
+        if (s_snapshots.isEmpty()) {
+            delete s_swapFile;
+            s_swapFile = 0;
+        }
+    }
+
+    /**
+     * Save the XMI of a widget.
+     */
+    void XMISnapshot::save(UMLWidget* widget)
+    {
+        QDomDocument doc;
+        QDomElement container = doc.createElement(QLatin1String("widget"));
+        widget->saveToXMI(doc, container);
+        setXMI(container.firstChild().toElement());
+    }
+
+    /**
+     * Save the XMI of a diagram with all its widgets.
+     */
+    void XMISnapshot::save(UMLScene* scene)
+    {
+        QDomDocument doc;
+        QDomElement container = doc.createElement(QLatin1String("diagram"));
+        scene->saveToXMI(doc, container);
+        setXMI(container.firstChild().toElement());
+    }
+
+    /**
+     * Return the saved element, parsed into the given document.
+     *
+     * @param doc   The document owning the returned element, it must
+     *              exist as long as the element is used.
+     * @return      The element, a null element if it could not be read.
+     */
+    QDomElement XMISnapshot::element(QDomDocument& doc) const
+    {
+        QByteArray xmi = m_xmi;
+        if (m_offset >= 0) {
+            if (s_swapFile == 0 || !s_swapFile->seek(m_offset)) {
+                uError() << "could not read the undo snapshot";
+                return QDomElement();
+            }
+            xmi = s_swapFile->read(m_size);
+            if (xmi.size() != m_size) {
+                uError() << "could not read the undo snapshot from" << s_swapFile->fileName();
+                return QDomElement();
+            }
+        }
+        QString error;
+        int line;
+        if (!doc.setContent(qUncompress(xmi), &error, &line)) {
+            uError() << "could not parse the undo snapshot:" << error << "at line" << line;
+            return QDomElement();
+        }
+        return doc.documentElement();
+    }
+
+    /**
+     * Return the size of all snapshots held in memory.
+     */
+    qint64 XMISnapshot::memoryUsage()
+    {
+        return s_memoryUsage;
+    }
+
+    /**
+     * Return the size the snapshots in memory may reach.
+     */
+    qint64 XMISnapshot::memoryBudget()
+    {
+        return s_memoryBudget;
+    }
+
+    /**
+     * Set the size the snapshots in memory may reach. When it is exceeded,
+     * the oldest snapshots are moved to a temporary file.
+     */
+    void XMISnapshot::setMemoryBudget(qint64 bytes)
+    {
+        s_memoryBudget = bytes;
+        trim();
+    }
+
+    /**
+     * Compress the XMI of the given element and keep it in memory.
+     */
+    void XMISnapshot::setXMI(const QDomElement& element)
+    {
+        QString xmi;
+        QTextStream stream(&xmi, QIODevice::WriteOnly);
+        element.save(stream, 0);
+        stream.flush();
+
+        if (m_offset < 0) {
+            s_memoryUsage -= m_size;
+        }
+        m_xmi = qCompress(xmi.toUtf8());
+        m_offset = -1;
+        m_size = m_xmi.size();
+        s_memoryUsage += m_size;
+        trim();
+    }
+
+    /**
+     * Append the compressed XMI to the swap file and release it.
+     *
+     * @return  false if the swap file could not be written
+     */
+    bool XMISnapshot::swapOut()
+    {
+        if (s_swapFile == 0) {
+#if QT_VERSION >= 0x050000
+            s_swapFile = new QTemporaryFile;
+#else
+            s_swapFile = new KTemporaryFile;
+#endif
+            if (!s_swapFile->open()) {
+                uError() << "could not create a file for the undo history";
+                delete s_swapFile;
+                s_swapFile = 0;
+                return false;
+            }
+        }
+        const qint64 offset = s_swapFile->size();
+        if (!s_swapFile->seek(offset) || s_swapFile->write(m_xmi) != m_size) {
+            uError() << "could not write the undo history to" << s_swapFile->fileName();
+            return false;
+        }
+        m_xmi.clear();
+        m_offset = offset;
+        s_memoryUsage -= m_size;
+        return true;
+    }
+
+    /**
+     * Swap out the oldest snapshots until the memory budget is kept.
+     */
+    void XMISnapshot::trim()
+    {
+        foreach (XMISnapshot *snapshot, s_snapshots) {
+            if (s_memoryUsage <= s_memoryBudget) {
+                break;
+            }
+            if (snapshot->m_offset < 0 && snapshot->m_size > 0 && !snapshot->swapOut()) {
+                break;
+            }
+        }
+    }
+
+}
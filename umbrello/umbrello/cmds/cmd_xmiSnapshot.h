@@ -0,0 +1,59 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef CMD_XMISNAPSHOT_H
+#define CMD_XMISNAPSHOT_H
+
+#include <QByteArray>
+#include <QDomElement>
+
+class UMLScene;
+class UMLWidget;
+
+namespace Uml
+{
+    /**
+     * The XMI of a widget or diagram kept by an undo command, so that the
+     * command can create it again.
+     *
+     * The XMI is stored compressed. All snapshots share a memory budget:
+     * when the snapshots in memory exceed it, the oldest ones are moved
+     * to a temporary file and read back from there when the command is
+     * undone or redone, so that large histories do not stay in memory.
+     */
+    class XMISnapshot
+    {
+    public:
+        XMISnapshot();
+        ~XMISnapshot();
+
+        void save(UMLWidget* widget);
+        void save(UMLScene* scene);
+        QDomElement element(QDomDocument& doc) const;
+
+        static qint64 memoryUsage();
+        static qint64 memoryBudget();
+        static void setMemoryBudget(qint64 bytes);
+
+    private:
+        void setXMI(const QDomElement& element);
+        bool swapOut();
+
+        static void trim();
+
+        QByteArray m_xmi;   ///< compressed XMI, empty when swapped out
+        qint64 m_offset;    ///< position in the swap file, -1 if in memory
+        int m_size;         ///< size of the compressed XMI
+
+        Q_DISABLE_COPY(XMISnapshot)
+    };
+}
+
+#endif
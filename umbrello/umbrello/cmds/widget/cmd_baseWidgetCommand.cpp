@@ -24,6 +24,7 @@
 namespace Uml
 {
     CmdBaseWidgetCommand::CmdBaseWidgetCommand(UMLWidget* widget)
+      : m_mergeable(UMLApp::app()->hasBegunMacro())
     {
         setWidget(widget);
     }
@@ -55,13 +56,34 @@ namespace Uml
 
     UMLWidget* CmdBaseWidgetCommand::widget()
     {
-        UMLWidget* umlWidget = scene()->findWidget(m_widgetId);
+        return widget(m_widgetId, m_widget);
+    }
+
+    /**
+     * Find a widget of the scene by its id.
+     *
+     * @param id         The local id of the widget.
+     * @param fallback   The widget returned if the scene does not know the id.
+     */
+    UMLWidget* CmdBaseWidgetCommand::widget(Uml::ID::Type id, UMLWidget* fallback)
+    {
+        UMLWidget* umlWidget = scene()->findWidget(id);
 
         if (umlWidget)
             return umlWidget;
 
-        Q_ASSERT(m_widget.data());
-        return m_widget;
+        Q_ASSERT(fallback);
+        return fallback;
+    }
+
+    /**
+     * Return whether the command may be merged with the following command
+     * of the same kind: only the commands of one gesture are merged, which
+     * are pushed within a macro.
+     */
+    bool CmdBaseWidgetCommand::isMergeable() const
+    {
+        return m_mergeable;
     }
 
     /**
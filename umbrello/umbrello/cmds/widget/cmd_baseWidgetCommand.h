@@ -28,15 +28,24 @@ namespace Uml
             virtual ~CmdBaseWidgetCommand();
 
         protected:
+            /// ids of the commands merged with QUndoCommand::mergeWith()
+            enum MergeId {
+                MoveWidgetId = 1,
+                ResizeWidgetId
+            };
+
             Uml::ID::Type m_sceneId;
             Uml::ID::Type m_widgetId;
             QPointer<UMLScene> m_scene;
             QPointer<UMLWidget> m_widget;
+            bool m_mergeable;  ///< created within a macro
 
             void setWidget(UMLWidget* widget);
             void addWidgetToScene(UMLWidget* widget);
             UMLWidget* widget();
+            UMLWidget* widget(Uml::ID::Type id, UMLWidget* fallback);
             UMLScene* scene();
+            bool isMergeable() const;
     };
 }
 
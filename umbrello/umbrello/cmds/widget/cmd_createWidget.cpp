@@ -17,6 +17,9 @@
 // kde includes
 #include <KLocalizedString>
 
+// qt includes
+#include <QDomDocument>
+
 namespace Uml
 {
 
@@ -30,9 +33,7 @@ namespace Uml
 
         addWidgetToScene(widget);
 
-        QDomDocument doc;
-        m_element = doc.createElement(QLatin1String("widget"));
-        widget->saveToXMI(doc, m_element);
+        m_snapshot.save(widget);
     }
 
     /**
@@ -51,7 +52,11 @@ namespace Uml
         if (umlWidget == 0) {
             // If the widget is not found, the add command was undone. Load the
             // widget back from the saved XMI state.
-            QDomElement widgetElement = m_element.firstChild().toElement();
+            QDomDocument doc;
+            QDomElement widgetElement = m_snapshot.element(doc);
+            if (widgetElement.isNull()) {
+                return;
+            }
             umlWidget = scene()->loadWidgetFromXMI(widgetElement);
 
             addWidgetToScene(umlWidget);
@@ -12,8 +12,7 @@
 #define CMD_CREATE_WIDGET_H
 
 #include "cmd_baseWidgetCommand.h"
-
-#include <QDomElement>
+#include "cmd_xmiSnapshot.h"
 
 class UMLWidget;
 
@@ -29,7 +28,7 @@ namespace Uml
         void undo();
 
     private:
-        QDomElement  m_element;
+        XMISnapshot  m_snapshot;
     };
 }
 
@@ -25,8 +25,12 @@ namespace Uml
     {
         setText(i18n("Move widget : %1", widget->name()));
 
-        m_pos = widget->pos();
-        m_posOld = widget->startMovePosition();
+        Move move;
+        move.widgetId = widget->localID();
+        move.widget = widget;
+        move.pos = widget->pos();
+        move.posOld = widget->startMovePosition();
+        m_moves.append(move);
     }
 
     CmdMoveWidget::~CmdMoveWidget()
@@ -35,25 +39,39 @@ namespace Uml
 
     void CmdMoveWidget::redo()
     {
-        UMLWidget* umlWidget = widget();
-        umlWidget->setPos(m_pos);
-        umlWidget->updateGeometry();
+        foreach (const Move &move, m_moves) {
+            UMLWidget* umlWidget = widget(move.widgetId, move.widget);
+            umlWidget->setPos(move.pos);
+            umlWidget->updateGeometry();
+        }
     }
 
     void CmdMoveWidget::undo()
     {
-        UMLWidget* umlWidget = widget();
-        umlWidget->setPos(m_posOld);
-        umlWidget->updateGeometry();
+        for (int i = m_moves.count() - 1; i >= 0; --i) {
+            const Move &move = m_moves.at(i);
+            UMLWidget* umlWidget = widget(move.widgetId, move.widget);
+            umlWidget->setPos(move.posOld);
+            umlWidget->updateGeometry();
+        }
     }
 
-//    bool CmdMoveWidget::mergeWith(const QUndoCommand* other)
-//    {
-//        const CmdMoveWidget* otherCmd = static_cast<const CmdMoveWidget*>(other);
-//        if (m_widgetCtrl != otherCmd->m_widgetCtrl)
-//            return false;
-//        m_x = otherCmd->m_x;
-//        m_y = otherCmd->m_y;
-//        return true;
-//    }
+    int CmdMoveWidget::id() const
+    {
+        return MoveWidgetId;
+    }
+
+    /**
+     * Take over the moves of the widgets of another command pushed within
+     * the same gesture, e.g. when a selection is dragged, so that the
+     * gesture is kept as one command instead of one command per widget.
+     */
+    bool CmdMoveWidget::mergeWith(const QUndoCommand* other)
+    {
+        const CmdMoveWidget* otherCmd = static_cast<const CmdMoveWidget*>(other);
+        if (!isMergeable() || !otherCmd->isMergeable() || m_sceneId != otherCmd->m_sceneId)
+            return false;
+        m_moves += otherCmd->m_moves;
+        return true;
+    }
 }
@@ -13,6 +13,7 @@
 
 #include "cmd_baseWidgetCommand.h"
 
+#include <QList>
 #include <QPointF>
 
 class UMLWidget;
@@ -28,10 +29,19 @@ namespace Uml
         void redo();
         void undo();
 
-    private:
-        QPointF     m_pos;
-        QPointF     m_posOld;
+        int id() const;
+        bool mergeWith(const QUndoCommand* other);
 
+    private:
+        /// the move of one widget
+        struct Move {
+            Uml::ID::Type       widgetId;
+            QPointer<UMLWidget> widget;
+            QPointF             pos;
+            QPointF             posOld;
+        };
+
+        QList<Move> m_moves;  ///< the widget of the command and the widgets merged into it
     };
 }
 
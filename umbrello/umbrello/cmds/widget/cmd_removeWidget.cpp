@@ -17,6 +17,9 @@
 // kde includes
 #include <KLocalizedString>
 
+// qt includes
+#include <QDomDocument>
+
 namespace Uml
 {
 
@@ -28,9 +31,7 @@ namespace Uml
     {
         setText(i18n("Remove widget : %1", widget->name()));
 
-        QDomDocument doc;
-        m_element = doc.createElement(QLatin1String("widget"));
-        widget->saveToXMI(doc, m_element);
+        m_snapshot.save(widget);
     }
 
     /**
@@ -57,7 +58,11 @@ namespace Uml
      */
     void CmdRemoveWidget::undo()
     {
-        QDomElement widgetElement = m_element.firstChild().toElement();
+        QDomDocument doc;
+        QDomElement widgetElement = m_snapshot.element(doc);
+        if (widgetElement.isNull()) {
+            return;
+        }
 
         UMLScene* umlScene = scene();
         UMLWidget* widget = umlScene->loadWidgetFromXMI(widgetElement);
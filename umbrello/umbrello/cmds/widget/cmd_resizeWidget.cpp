@@ -25,8 +25,12 @@ namespace Uml
         Q_ASSERT(widget != 0);
         setText(i18n("Resize widget : %1", widget->name()));
 
-        m_size = QSizeF(widget->width(), widget->height());
-        m_sizeOld = widget->startResizeSize();
+        Resize resize;
+        resize.widgetId = widget->localID();
+        resize.widget = widget;
+        resize.size = QSizeF(widget->width(), widget->height());
+        resize.sizeOld = widget->startResizeSize();
+        m_resizes.append(resize);
     }
 
     CmdResizeWidget::~CmdResizeWidget()
@@ -35,12 +39,35 @@ namespace Uml
 
     void CmdResizeWidget::redo()
     {
-        widget()->setSize(m_size);
+        foreach (const Resize &resize, m_resizes) {
+            widget(resize.widgetId, resize.widget)->setSize(resize.size);
+        }
     }
 
     void CmdResizeWidget::undo()
     {
-        widget()->setSize(m_sizeOld);
+        for (int i = m_resizes.count() - 1; i >= 0; --i) {
+            const Resize &resize = m_resizes.at(i);
+            widget(resize.widgetId, resize.widget)->setSize(resize.sizeOld);
+        }
+    }
+
+    int CmdResizeWidget::id() const
+    {
+        return ResizeWidgetId;
+    }
+
+    /**
+     * Take over the resizes of another command pushed within the same
+     * gesture, see CmdMoveWidget::mergeWith().
+     */
+    bool CmdResizeWidget::mergeWith(const QUndoCommand* other)
+    {
+        const CmdResizeWidget* otherCmd = static_cast<const CmdResizeWidget*>(other);
+        if (!isMergeable() || !otherCmd->isMergeable() || m_sceneId != otherCmd->m_sceneId)
+            return false;
+        m_resizes += otherCmd->m_resizes;
+        return true;
     }
 
 }
@@ -13,6 +13,7 @@
 
 #include "cmd_baseWidgetCommand.h"
 
+#include <QList>
 #include <QSizeF>
 
 class UMLWidget;
@@ -28,9 +29,19 @@ namespace Uml
         void redo();
         void undo();
 
+        int id() const;
+        bool mergeWith(const QUndoCommand* other);
+
     private:
-        QSizeF      m_size;
-        QSizeF      m_sizeOld;
+        /// the resize of one widget
+        struct Resize {
+            Uml::ID::Type       widgetId;
+            QPointer<UMLWidget> widget;
+            QSizeF              size;
+            QSizeF              sizeOld;
+        };
+
+        QList<Resize> m_resizes;  ///< the widget of the command and the widgets merged into it
     };
 }
 
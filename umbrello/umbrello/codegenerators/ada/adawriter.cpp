@@ -496,175 +496,6 @@ void AdaWriter::writeOperation(UMLOperation *op, QTextStream &ada, bool is_comme
     ada << ";" << m_endl << m_endl;
 }
 
-/**
- * Returns the default datatypes.
- */
-QStringList AdaWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("Boolean"));
-    l.append(QLatin1String("Character"));
-    l.append(QLatin1String("Positive"));
-    l.append(QLatin1String("Natural"));
-    l.append(QLatin1String("Integer"));
-    l.append(QLatin1String("Short_Integer"));
-    l.append(QLatin1String("Long_Integer"));
-    l.append(QLatin1String("Float"));
-    l.append(QLatin1String("Long_Float"));
-    l.append(QLatin1String("Duration"));
-    l.append(QLatin1String("String"));
-    return l;
-}
-
-/**
- * Check whether the given string is a reserved word for the
- * language of this code generator
- *
- * @param rPossiblyReservedKeyword  The string to check.
- */
-bool AdaWriter::isReservedKeyword(const QString & rPossiblyReservedKeyword)
-{
-    const QStringList keywords = reservedKeywords();
-
-    QStringList::ConstIterator it;
-    for (it = keywords.begin(); it != keywords.end(); ++it) {
-        if ((*it).toLower() == rPossiblyReservedKeyword.toLower()) {
-            return true;
-        }
-    }
-    return false;
-}
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList AdaWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords.append(QLatin1String("abort"));
-        keywords.append(QLatin1String("abs"));
-        keywords.append(QLatin1String("abstract"));
-        keywords.append(QLatin1String("accept"));
-        keywords.append(QLatin1String("access"));
-        keywords.append(QLatin1String("aliased"));
-        keywords.append(QLatin1String("all"));
-        keywords.append(QLatin1String("and"));
-        keywords.append(QLatin1String("Argument_Error"));
-        keywords.append(QLatin1String("array"));
-        keywords.append(QLatin1String("Assert_Failure"));
-        keywords.append(QLatin1String("at"));
-        keywords.append(QLatin1String("begin"));
-        keywords.append(QLatin1String("body"));
-        keywords.append(QLatin1String("Boolean"));
-        keywords.append(QLatin1String("case"));
-        keywords.append(QLatin1String("Character"));
-        keywords.append(QLatin1String("constant"));
-        keywords.append(QLatin1String("Constraint_Error"));
-        keywords.append(QLatin1String("Conversion_Error"));
-        keywords.append(QLatin1String("Data_Error"));
-        keywords.append(QLatin1String("declare"));
-        keywords.append(QLatin1String("delay"));
-        keywords.append(QLatin1String("delta"));
-        keywords.append(QLatin1String("Dereference_Error"));
-        keywords.append(QLatin1String("Device_Error"));
-        keywords.append(QLatin1String("digits"));
-        keywords.append(QLatin1String("do"));
-        keywords.append(QLatin1String("Duration"));
-        keywords.append(QLatin1String("else"));
-        keywords.append(QLatin1String("elsif"));
-        keywords.append(QLatin1String("end"));
-        keywords.append(QLatin1String("End_Error"));
-        keywords.append(QLatin1String("entry"));
-        keywords.append(QLatin1String("exception"));
-        keywords.append(QLatin1String("exit"));
-        keywords.append(QLatin1String("false"));
-        keywords.append(QLatin1String("Float"));
-        keywords.append(QLatin1String("for"));
-        keywords.append(QLatin1String("function"));
-        keywords.append(QLatin1String("generic"));
-        keywords.append(QLatin1String("goto"));
-        keywords.append(QLatin1String("if"));
-        keywords.append(QLatin1String("in"));
-        keywords.append(QLatin1String("Index_Error"));
-        keywords.append(QLatin1String("Integer"));
-        keywords.append(QLatin1String("interface"));
-        keywords.append(QLatin1String("is"));
-        keywords.append(QLatin1String("Layout_Error"));
-        keywords.append(QLatin1String("Length_Error"));
-        keywords.append(QLatin1String("limited"));
-        keywords.append(QLatin1String("Long_Float"));
-        keywords.append(QLatin1String("Long_Integer"));
-        keywords.append(QLatin1String("Long_Long_Float"));
-        keywords.append(QLatin1String("Long_Long_Integer"));
-        keywords.append(QLatin1String("loop"));
-        keywords.append(QLatin1String("mod"));
-        keywords.append(QLatin1String("Mode_Error"));
-        keywords.append(QLatin1String("Name_Error"));
-        keywords.append(QLatin1String("Natural"));
-        keywords.append(QLatin1String("new"));
-        keywords.append(QLatin1String("not"));
-        keywords.append(QLatin1String("null"));
-        keywords.append(QLatin1String("of"));
-        keywords.append(QLatin1String("or"));
-        keywords.append(QLatin1String("others"));
-        keywords.append(QLatin1String("out"));
-        keywords.append(QLatin1String("package"));
-        keywords.append(QLatin1String("Pattern_Error"));
-        keywords.append(QLatin1String("Picture_Error"));
-        keywords.append(QLatin1String("Pointer_Error"));
-        keywords.append(QLatin1String("Positive"));
-        keywords.append(QLatin1String("pragma"));
-        keywords.append(QLatin1String("private"));
-        keywords.append(QLatin1String("procedure"));
-        keywords.append(QLatin1String("Program_Error"));
-        keywords.append(QLatin1String("protected"));
-        keywords.append(QLatin1String("raise"));
-        keywords.append(QLatin1String("range"));
-        keywords.append(QLatin1String("record"));
-        keywords.append(QLatin1String("rem"));
-        keywords.append(QLatin1String("renames"));
-        keywords.append(QLatin1String("requeue"));
-        keywords.append(QLatin1String("return"));
-        keywords.append(QLatin1String("reverse"));
-        keywords.append(QLatin1String("select"));
-        keywords.append(QLatin1String("separate"));
-        keywords.append(QLatin1String("Short_Float"));
-        keywords.append(QLatin1String("Short_Integer"));
-        keywords.append(QLatin1String("Short_Short_Float"));
-        keywords.append(QLatin1String("Short_Short_Integer"));
-        keywords.append(QLatin1String("Status_Error"));
-        keywords.append(QLatin1String("Storage_Error"));
-        keywords.append(QLatin1String("String"));
-        keywords.append(QLatin1String("subtype"));
-        keywords.append(QLatin1String("Tag_Error"));
-        keywords.append(QLatin1String("tagged"));
-        keywords.append(QLatin1String("task"));
-        keywords.append(QLatin1String("Tasking_Error"));
-        keywords.append(QLatin1String("terminate"));
-        keywords.append(QLatin1String("Terminator_Error"));
-        keywords.append(QLatin1String("then"));
-        keywords.append(QLatin1String("Time_Error"));
-        keywords.append(QLatin1String("Translation_Error"));
-        keywords.append(QLatin1String("true"));
-        keywords.append(QLatin1String("type"));
-        keywords.append(QLatin1String("until"));
-        keywords.append(QLatin1String("Update_Error"));
-        keywords.append(QLatin1String("use"));
-        keywords.append(QLatin1String("Use_Error"));
-        keywords.append(QLatin1String("when"));
-        keywords.append(QLatin1String("while"));
-        keywords.append(QLatin1String("Wide_Character"));
-        keywords.append(QLatin1String("Wide_String"));
-        keywords.append(QLatin1String("with"));
-        keywords.append(QLatin1String("xor"));
-    }
-
-    return keywords;
-}
-
 void AdaWriter::finalizeRun()
 {
     PackageFileMap::iterator end(m_pkgsGenerated.end());
@@ -41,12 +41,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
-    virtual bool isReservedKeyword(const QString & rPossiblyReservedKeyword);
-
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void declareClass(UMLClassifier *c, QTextStream &ada);
@@ -14,6 +14,7 @@
 
 // local includes
 #include "codedocument.h"
+#include "codeemitter.h"
 #include "codegenfactory.h"
 #include "debug_utils.h"
 
@@ -132,27 +133,15 @@ void CodeBlockWithComments::setAttributesFromNode(QDomElement & root)
 }
 
 /**
- * @return  QString
+ * Write the comment and the body of the block.
+ * @param emitter   the emitter receiving the text
  */
-QString CodeBlockWithComments::toString () const
+void CodeBlockWithComments::write(CodeEmitter & emitter) const
 {
-    QString string;
-
     if (getWriteOutText()) {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
-        QString body = formatMultiLineText (getText(), indent, endLine);
-        CodeComment* codeComment = getComment();
-        QString comment = codeComment->toString();
-
-        if (!comment.isEmpty() && codeComment->getWriteOutText()) {
-            string.append(comment);
-        }
-        if (!body.isEmpty()) {
-            string.append(body);
-        }
+        getComment()->write(emitter);
+        emitter.writeLines(getText(), getIndentationLevel());
     }
-    return string;
 }
 
 // slave indentation level for both the header and text body
@@ -35,7 +35,7 @@ public:
 
     CodeComment * getComment () const;
 
-    virtual QString toString () const;
+    virtual void write (CodeEmitter & emitter) const;
 
     void setOverallIndentationLevel (int level);
 
@@ -13,6 +13,7 @@
 #include "codedocument.h"
 
 // local includes
+#include "codeemitter.h"
 #include "codegenerator.h"
 #include "debug_utils.h"
 #include "package.h"
@@ -296,31 +297,35 @@ void CodeDocument::updateHeader ()
 }
 
 /**
- * Create the string representation of this object.
- * @return   the created string
+ * Write the code of this document.
+ * @param emitter   the emitter receiving the code
  */
-QString CodeDocument::toString ()
+void CodeDocument::write (CodeEmitter & emitter)
 {
     // IF the whole document is turned "Off" then don't bother
-    // checking individual code blocks, just send back empty string
+    // checking individual code blocks, just write nothing
     if (!getWriteOutCode())
-        return QString();
-
-    QString content = getHeader()->toString();
+        return;
 
-    // update the time/date
+    getHeader()->write(emitter);
 
     // comments, import, package codeblocks go next
     TextBlockList * items = getTextBlockList();
     foreach (TextBlock* c, *items)
     {
-        if (c->getWriteOutText()) {
-            QString str = c->toString();
-            if (!str.isEmpty())
-                content.append(str);
-        }
+        c->write(emitter);
     }
-    return content;
+}
+
+/**
+ * Create the string representation of this object.
+ * @return   the created string
+ */
+QString CodeDocument::toString ()
+{
+    StringCodeEmitter emitter;
+    write(emitter);
+    return emitter.text();
 }
 
 /**
@@ -21,6 +21,7 @@
 
 class CodeBlockWithComments;
 class CodeComment;
+class CodeEmitter;
 class TextBlock;
 class UMLPackage;
 
@@ -62,7 +63,8 @@ public:
 
     TextBlock * findTextBlockByTag(const QString &tag, bool descendIntoChildren = false);
 
-    virtual QString toString ();
+    virtual void write (CodeEmitter & emitter);
+    QString toString ();
 
     virtual void saveToXMI (QDomDocument & doc, QDomElement & root);
     virtual void loadFromXMI (QDomElement & root);
@@ -0,0 +1,269 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "codeemitter.h"
+
+// app includes
+#include "codegenerationpolicy.h"
+#include "uml.h"
+
+// qt includes
+#include <QIODevice>
+
+/**
+ * Constructor.
+ * @param bufferSize   number of characters collected before they are
+ *                     passed to writeBuffer(), 0 to collect all text
+ *                     until flush() is called
+ */
+CodeEmitter::CodeEmitter(int bufferSize)
+  : m_bufferSize(bufferSize)
+{
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    m_endLine = policy->getNewLineEndingChars();
+    m_indentation = policy->getIndentation();
+    m_indentations.append(QString());
+    if (m_bufferSize > 0)
+        m_buffer.reserve(m_bufferSize + 1024);
+}
+
+/**
+ * Destructor.
+ * Subclasses have to call flush() themselves, the buffer cannot be
+ * written from here anymore.
+ */
+CodeEmitter::~CodeEmitter()
+{
+}
+
+/**
+ * Return the line ending of the code generation policy.
+ */
+const QString& CodeEmitter::endLine() const
+{
+    return m_endLine;
+}
+
+/**
+ * Return the indentation string of the given level.
+ * @param level   the number of indentation units
+ */
+const QString& CodeEmitter::indentation(int level)
+{
+    if (level < 0)
+        level = 0;
+    while (m_indentations.size() <= level)
+        m_indentations.append(m_indentations.last() + m_indentation);
+    return m_indentations.at(level);
+}
+
+/**
+ * Write a text as it is.
+ */
+void CodeEmitter::write(const QString &text)
+{
+    m_buffer.append(text);
+    written();
+}
+
+/**
+ * Write a text as it is.
+ */
+void CodeEmitter::write(QLatin1String text)
+{
+    m_buffer.append(text);
+    written();
+}
+
+/**
+ * Write a single character.
+ */
+void CodeEmitter::write(QChar c)
+{
+    m_buffer.append(c);
+    written();
+}
+
+/**
+ * Write a single line with the given indentation, followed by
+ * the line ending.
+ * @param level   the indentation level
+ * @param text    the line without line ending
+ */
+void CodeEmitter::writeLine(int level, QLatin1String text)
+{
+    m_buffer.append(indentation(level));
+    m_buffer.append(text);
+    m_buffer.append(m_endLine);
+    written();
+}
+
+/**
+ * Write a text which may consist of several lines separated by the
+ * line ending of the policy, see the other overload.
+ */
+void CodeEmitter::writeLines(const QString &text, int level, const QString &prefix,
+                             bool addBreak, bool lastLineHasBreak)
+{
+    writeLines(text, level, prefix, m_endLine, addBreak, lastLineHasBreak);
+}
+
+/**
+ * Write a text which may consist of several lines. Each line is written
+ * with the indentation of the given level and the prefix, and is ended
+ * by the line ending of the policy. A line break at the end of the text
+ * does not start another line.
+ * This is the streaming version of TextBlock::formatMultiLineText().
+ * @param text               the text to write
+ * @param level              the indentation level of each line
+ * @param prefix             written after the indentation of each line
+ * @param breakStr           the string separating the lines in the text
+ * @param addBreak           add the break string to a text consisting of a single line
+ * @param lastLineHasBreak   end the last line of a text with several lines
+ */
+void CodeEmitter::writeLines(const QString &text, int level, const QString &prefix, const QString &breakStr,
+                             bool addBreak, bool lastLineHasBreak)
+{
+    const QString &indent = indentation(level);
+    int pos = breakStr.isEmpty() ? -1 : text.indexOf(breakStr);
+    if (pos < 0) {
+        m_buffer.append(indent);
+        m_buffer.append(prefix);
+        m_buffer.append(text);
+        if (addBreak)
+            m_buffer.append(breakStr);
+        written();
+        return;
+    }
+
+    const int length = text.length();
+    int from = 0;
+    while (true) {
+        m_buffer.append(indent);
+        m_buffer.append(prefix);
+        m_buffer.append(text.midRef(from, pos - from));
+        from = pos + breakStr.length();
+        if (from >= length) {
+            if (lastLineHasBreak)
+                m_buffer.append(m_endLine);
+            break;
+        }
+        m_buffer.append(m_endLine);
+        pos = text.indexOf(breakStr, from);
+        if (pos < 0) {
+            m_buffer.append(indent);
+            m_buffer.append(prefix);
+            m_buffer.append(text.midRef(from));
+            if (lastLineHasBreak)
+                m_buffer.append(m_endLine);
+            break;
+        }
+    }
+    written();
+}
+
+/**
+ * Pass the buffered text to the sink.
+ */
+void CodeEmitter::flush()
+{
+    if (m_buffer.isEmpty())
+        return;
+    writeBuffer(m_buffer);
+    m_buffer.clear();
+    if (m_bufferSize > 0)
+        m_buffer.reserve(m_bufferSize + 1024);
+}
+
+/**
+ * Flush the buffer if it is full.
+ */
+void CodeEmitter::written()
+{
+    if (m_bufferSize > 0 && m_buffer.size() >= m_bufferSize)
+        flush();
+}
+
+/**
+ * Constructor.
+ */
+StringCodeEmitter::StringCodeEmitter()
+  : CodeEmitter(0)
+{
+}
+
+/**
+ * Return the text written so far.
+ */
+QString StringCodeEmitter::text()
+{
+    flush();
+    return m_text;
+}
+
+void StringCodeEmitter::writeBuffer(const QString &text)
+{
+    m_text.append(text);
+}
+
+/**
+ * Constructor.
+ * @param device       the opened device to write to
+ * @param bufferSize   number of characters encoded and written at once
+ */
+DeviceCodeEmitter::DeviceCodeEmitter(QIODevice *device, int bufferSize)
+  : CodeEmitter(bufferSize),
+    m_device(device),
+    m_encoder(QTextCodec::codecForLocale()),
+    m_success(true)
+{
+}
+
+/**
+ * Return whether all text passed to the device has been written.
+ * Call flush() before.
+ */
+bool DeviceCodeEmitter::success() const
+{
+    return m_success;
+}
+
+void DeviceCodeEmitter::writeBuffer(const QString &text)
+{
+    const QByteArray data = m_encoder.fromUnicode(text);
+    if (m_device->write(data) != data.size())
+        m_success = false;
+}
+
+/**
+ * Constructor.
+ * @param bufferSize   number of characters encoded and hashed at once
+ */
+HashCodeEmitter::HashCodeEmitter(int bufferSize)
+  : CodeEmitter(bufferSize),
+    m_hash(QCryptographicHash::Sha1),
+    m_encoder(QTextCodec::codecForLocale())
+{
+}
+
+/**
+ * Return the hash of the text written so far.
+ */
+QByteArray HashCodeEmitter::result()
+{
+    flush();
+    return m_hash.result();
+}
+
+void HashCodeEmitter::writeBuffer(const QString &text)
+{
+    m_hash.addData(m_encoder.fromUnicode(text));
+}
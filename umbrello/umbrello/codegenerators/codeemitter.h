@@ -0,0 +1,135 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef CODEEMITTER_H
+#define CODEEMITTER_H
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QString>
+#include <QTextCodec>
+#include <QVector>
+
+class QIODevice;
+
+/**
+ * A CodeEmitter receives the text of code documents and text blocks,
+ * see TextBlock::write() and CodeDocument::write().
+ *
+ * The text is collected in a buffer, which is passed to writeBuffer()
+ * whenever it exceeds the buffer size and by flush(). The line ending
+ * and the indentation of the code generation policy are read once by
+ * the constructor, the indentation strings of the levels are kept in
+ * a table.
+ *
+ * writeLines() splits a text at the line breaks and writes each line
+ * with a prefix. Subclasses decide where the text goes to:
+ * StringCodeEmitter keeps it in memory, DeviceCodeEmitter writes it to
+ * a file and HashCodeEmitter only calculates its hash.
+ *
+ * @short Buffered sink for the text of code documents
+ * Bugs and comments to umbrello-devel@kde.org or http://bugs.kde.org
+ */
+class CodeEmitter
+{
+public:
+    explicit CodeEmitter(int bufferSize);
+    virtual ~CodeEmitter();
+
+    const QString& endLine() const;
+    const QString& indentation(int level);
+
+    void write(const QString &text);
+    void write(QLatin1String text);
+    void write(QChar c);
+    void writeLine(int level, QLatin1String text);
+    void writeLines(const QString &text, int level, const QString &prefix = QString(),
+                    bool addBreak = true, bool lastLineHasBreak = true);
+    void writeLines(const QString &text, int level, const QString &prefix, const QString &breakStr,
+                    bool addBreak = true, bool lastLineHasBreak = true);
+
+    void flush();
+
+protected:
+    /**
+     * Pass the buffered text to the sink.
+     * @param text   the text written since the last call
+     */
+    virtual void writeBuffer(const QString &text) = 0;
+
+private:
+    void written();
+
+    QString m_buffer;
+    int m_bufferSize;              ///< 0 if the text is only passed on by flush()
+    QString m_endLine;
+    QString m_indentation;         ///< of a single level
+    QVector<QString> m_indentations;
+};
+
+/**
+ * Collects the text in a string.
+ */
+class StringCodeEmitter : public CodeEmitter
+{
+public:
+    StringCodeEmitter();
+
+    QString text();
+
+protected:
+    void writeBuffer(const QString &text);
+
+private:
+    QString m_text;
+};
+
+/**
+ * Writes the text to a device, encoded with the locale codec like
+ * QTextStream does it.
+ */
+class DeviceCodeEmitter : public CodeEmitter
+{
+public:
+    explicit DeviceCodeEmitter(QIODevice *device, int bufferSize = DefaultBufferSize);
+
+    bool success() const;
+
+    static const int DefaultBufferSize = 64 * 1024;
+
+protected:
+    void writeBuffer(const QString &text);
+
+private:
+    QIODevice *m_device;
+    QTextEncoder m_encoder;
+    bool m_success;
+};
+
+/**
+ * Calculates the SHA1 hash of the text as it would be written to a file
+ * by DeviceCodeEmitter, without keeping the text.
+ */
+class HashCodeEmitter : public CodeEmitter
+{
+public:
+    explicit HashCodeEmitter(int bufferSize = DeviceCodeEmitter::DefaultBufferSize);
+
+    QByteArray result();
+
+protected:
+    void writeBuffer(const QString &text);
+
+private:
+    QCryptographicHash m_hash;
+    QTextEncoder m_encoder;
+};
+
+#endif // CODEEMITTER_H
@@ -0,0 +1,102 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "codefilewriter.h"
+
+// qt includes
+#include <QFile>
+#include <QTextCodec>
+
+/**
+ * Constructor.
+ * @param parent   Parent object for QThread constructor.
+ */
+CodeFileWriter::CodeFileWriter(QObject* parent)
+  : QThread(parent),
+    m_finishing(false)
+{
+}
+
+/**
+ * Destructor, waits for the queued files to be written.
+ */
+CodeFileWriter::~CodeFileWriter()
+{
+    finish();
+}
+
+/**
+ * Queue a file for writing. This method may be called from any thread.
+ * @param file   the file with its name and text
+ */
+void CodeFileWriter::enqueue(File* file)
+{
+    QMutexLocker locker(&m_mutex);
+    m_queue.enqueue(file);
+    m_queued.wakeOne();
+}
+
+/**
+ * Wait until all queued files have been written.
+ * No files may be queued after this call.
+ */
+void CodeFileWriter::finish()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_finishing = true;
+        m_queued.wakeOne();
+    }
+    wait();
+}
+
+/**
+ * Write the queued files until finish() is called.
+ */
+void CodeFileWriter::run()
+{
+    forever {
+        File* file;
+        {
+            QMutexLocker locker(&m_mutex);
+            while (m_queue.isEmpty() && !m_finishing)
+                m_queued.wait(&m_mutex);
+            if (m_queue.isEmpty())
+                return;
+            file = m_queue.dequeue();
+        }
+        file->success = writeFile(file);
+    }
+}
+
+/**
+ * Write a single file, unless it already has the given content.
+ * The text is encoded with the locale codec, as the serial code
+ * generation does by writing to a QTextStream.
+ * @param file   the file to be written
+ * @return true if the file has the generated content
+ */
+bool CodeFileWriter::writeFile(File* file)
+{
+    const QByteArray data = QTextCodec::codecForLocale()->fromUnicode(file->text);
+    file->text.clear();
+
+    QFile out(file->fileName);
+    if (out.exists() && out.size() == data.size() && out.open(QIODevice::ReadOnly)) {
+        file->unchanged = (out.readAll() == data);
+        out.close();
+        if (file->unchanged)
+            return true;
+    }
+    if (!out.open(QIODevice::WriteOnly))
+        return false;
+    return out.write(data) == data.size();
+}
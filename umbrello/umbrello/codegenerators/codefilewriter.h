@@ -0,0 +1,73 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef CODEFILEWRITER_H
+#define CODEFILEWRITER_H
+
+#include <QMutex>
+#include <QQueue>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+
+/**
+ * This class writes generated files in a separate thread.
+ *
+ * The code of the files is built by other threads, which pass each
+ * file to enqueue() as soon as its text is known. The files are written
+ * in the order they are queued, encoded like QTextStream does it. A file
+ * whose content on disk is the same as the generated one is not written
+ * again, so that its modification time is kept.
+ *
+ * finish() waits until all queued files have been written; afterwards
+ * the result of each file can be read from its File record.
+ *
+ * @short Writes generated code files in a separate thread
+ * Bugs and comments to umbrello-devel@kde.org or http://bugs.kde.org
+ */
+class CodeFileWriter : public QThread
+{
+    Q_OBJECT
+
+public:
+    /**
+     * A file to be written. The record is owned by the caller and must
+     * exist until finish() has returned.
+     */
+    class File
+    {
+    public:
+        File() : success(false), unchanged(false) {}
+
+        QString fileName;  ///< absolute name of the file
+        QString text;      ///< the code, released when written
+        bool success;      ///< set when the file has been written
+        bool unchanged;    ///< set if the file already had this content
+    };
+
+    explicit CodeFileWriter(QObject* parent = 0);
+    virtual ~CodeFileWriter();
+
+    void enqueue(File* file);
+    void finish();
+
+protected:
+    void run();
+
+private:
+    bool writeFile(File* file);
+
+    QQueue<File*> m_queue;   ///< files waiting to be written
+    QMutex m_mutex;
+    QWaitCondition m_queued;
+    bool m_finishing;        ///< no more files will be queued
+};
+
+#endif
@@ -15,10 +15,6 @@
 
 namespace Codegen_Utils {
 
-QStringList cppDatatypes();
-
-const QStringList reservedCppKeywords();
-
 void createCppStereotypes();
 
 QString capitalizeFirstLetter(const QString &string);
@@ -213,6 +213,44 @@ QDir CodeGenerationPolicy::getOutputDirectory ()
     return Settings::optionState().codeGenerationState.outputDirectory;
 }
 
+/**
+ * Set whether the code documents are built concurrently and written
+ * through CodeFileWriter, see CodeGenerator::writeListedCodeDocsToFile().
+ * @param new_var the new value
+ */
+void CodeGenerationPolicy::setParallelGeneration (bool new_var)
+{
+    Settings::optionState().codeGenerationState.parallelGeneration = new_var;
+}
+
+/**
+ * Get whether the code documents are built concurrently.
+ * @return the flag whether code is generated in parallel
+ */
+bool CodeGenerationPolicy::getParallelGeneration () const
+{
+    return Settings::optionState().codeGenerationState.parallelGeneration;
+}
+
+/**
+ * Set whether only the files of changed classifiers are written,
+ * see CodeGenerationRecord.
+ * @param new_var the new value
+ */
+void CodeGenerationPolicy::setIncrementalGeneration (bool new_var)
+{
+    Settings::optionState().codeGenerationState.incrementalGeneration = new_var;
+}
+
+/**
+ * Get whether only the files of changed classifiers are written.
+ * @return the flag whether code is generated incrementally
+ */
+bool CodeGenerationPolicy::getIncrementalGeneration () const
+{
+    return Settings::optionState().codeGenerationState.incrementalGeneration;
+}
+
 /**
  * Set the value of m_lineEndingType
  * What line ending characters to use.
@@ -445,6 +483,8 @@ void CodeGenerationPolicy::setDefaults (CodeGenerationPolicy * clone, bool emitU
     setIndentationType (clone->getIndentationType());
     setModifyPolicy (clone->getModifyPolicy());
     setOverwritePolicy (clone->getOverwritePolicy());
+    setParallelGeneration (clone->getParallelGeneration());
+    setIncrementalGeneration (clone->getIncrementalGeneration());
 
     calculateIndentation();
     blockSignals(false); // "as you were citizen"
@@ -495,6 +535,8 @@ void CodeGenerationPolicy::setDefaults(bool emitUpdateSignal)
     setIncludeHeadings(UmbrelloSettings::includeHeadings());
     setOverwritePolicy(UmbrelloSettings::overwritePolicy());
     setModifyPolicy(UmbrelloSettings::modnamePolicy());
+    setParallelGeneration(UmbrelloSettings::parallelGeneration());
+    setIncrementalGeneration(UmbrelloSettings::incrementalGeneration());
 
     blockSignals(false); // "as you were citizen"
 
@@ -524,6 +566,8 @@ void CodeGenerationPolicy::writeConfig ()
     UmbrelloSettings::setIncludeHeadings(getIncludeHeadings());
     UmbrelloSettings::setOverwritePolicy(getOverwritePolicy());
     UmbrelloSettings::setModnamePolicy(getModifyPolicy());
+    UmbrelloSettings::setParallelGeneration(getParallelGeneration());
+    UmbrelloSettings::setIncrementalGeneration(getIncrementalGeneration());
 
     // this will be written to the disk from the place it was called :)
 }
@@ -72,6 +72,12 @@ public:
     void setOutputDirectory(QDir new_var);
     QDir getOutputDirectory();
 
+    void setParallelGeneration(bool new_var);
+    bool getParallelGeneration() const;
+
+    void setIncrementalGeneration(bool new_var);
+    bool getIncrementalGeneration() const;
+
     void setLineEndingType(NewLineType type);
     NewLineType getLineEndingType();
 
@@ -0,0 +1,271 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "codegenerationrecord.h"
+
+// app includes
+#include "association.h"
+#include "classifier.h"
+#include "classifiercodedocument.h"
+#include "codegenerationpolicy.h"
+#include "codegenerator.h"
+#include "optionstate.h"
+#include "package.h"
+#include "uml.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QDomDocument>
+#include <QDomElement>
+
+/**
+ * Constructor.
+ */
+CodeGenerationRecord::CodeGenerationRecord()
+{
+}
+
+/**
+ * Forget all generated files.
+ */
+void CodeGenerationRecord::clear()
+{
+    m_entries.clear();
+    m_settingsHash.clear();
+    m_contentHashes.clear();
+}
+
+/**
+ * Return true if no generated file is recorded.
+ */
+bool CodeGenerationRecord::isEmpty() const
+{
+    return m_entries.isEmpty();
+}
+
+/**
+ * Prepare a code generation run. The model may have changed since the
+ * last run, so the content hashes are computed again. If the code
+ * generation settings changed, all recorded files are outdated.
+ */
+void CodeGenerationRecord::startRun()
+{
+    m_contentHashes.clear();
+    const QByteArray hash = settingsHash();
+    if (hash != m_settingsHash) {
+        m_entries.clear();
+        m_settingsHash = hash;
+    }
+}
+
+/**
+ * Return true if the file of the code document has been generated
+ * before and neither the classifier nor the classifiers it depends on
+ * changed since, so that the file does not need to be written again.
+ * @param doc   the code document of a classifier
+ */
+bool CodeGenerationRecord::isUpToDate(ClassifierCodeDocument* doc)
+{
+    UMLClassifier *c = doc->getParentClassifier();
+    QHash<QString, Entry>::const_iterator it = m_entries.constFind(Uml::ID::toString(c->id()));
+    if (it == m_entries.constEnd())
+        return false;
+    const Entry& entry = it.value();
+    if (!UMLApp::app()->commonPolicy()->getOutputDirectory().exists(entry.fileName))
+        return false;
+    return entry.contentHash == contentHash(c) &&
+           entry.dependencyHash == dependencyHash(entry.dependencies);
+}
+
+/**
+ * Record that the file of the code document has been written.
+ * @param doc        the code document of a classifier
+ * @param fileName   the name of the file relative to the output directory
+ */
+void CodeGenerationRecord::setGenerated(ClassifierCodeDocument* doc, const QString& fileName)
+{
+    UMLClassifier *c = doc->getParentClassifier();
+    UMLPackageList related;
+    CodeGenerator::findObjectsRelated(c, related);
+
+    Entry entry;
+    entry.fileName = fileName;
+    entry.contentHash = contentHash(c);
+    foreach (UMLPackage *pkg, related) {
+        entry.dependencies.append(Uml::ID::toString(pkg->id()));
+    }
+    entry.dependencies.sort();
+    entry.dependencyHash = dependencyHash(entry.dependencies);
+    m_entries.insert(Uml::ID::toString(c->id()), entry);
+}
+
+/**
+ * Forget the file of a code document, e.g. because its code has been
+ * edited, so that it is written by the next run.
+ * @param doc   the code document
+ */
+void CodeGenerationRecord::invalidate(CodeDocument* doc)
+{
+    ClassifierCodeDocument *cdoc = dynamic_cast<ClassifierCodeDocument*>(doc);
+    if (cdoc) {
+        m_entries.remove(Uml::ID::toString(cdoc->getParentClassifier()->id()));
+    }
+}
+
+/**
+ * Return the hash of the model content of an object. For a classifier
+ * this is its XMI representation including attributes, operations and
+ * associations, for other objects only the qualified name matters.
+ * @param obj   the object
+ */
+QByteArray CodeGenerationRecord::contentHash(UMLObject* obj)
+{
+    QHash<UMLObject*, QByteArray>::const_iterator it = m_contentHashes.constFind(obj);
+    if (it != m_contentHashes.constEnd())
+        return it.value();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(obj->fullyQualifiedName().toUtf8());
+    UMLClassifier *c = dynamic_cast<UMLClassifier*>(obj);
+    if (c) {
+        QDomDocument doc;
+        QDomElement root = doc.createElement(QLatin1String("record"));
+        c->saveToXMI(doc, root);
+        foreach (UMLAssociation *a, c->getAssociations()) {
+            a->saveToXMI(doc, root);
+        }
+        doc.appendChild(root);
+        hash.addData(doc.toString().toUtf8());
+    }
+    const QByteArray result = hash.result();
+    m_contentHashes.insert(obj, result);
+    return result;
+}
+
+/**
+ * Return the combined hash of the content of the given objects.
+ * An object which does not exist anymore changes the hash, too.
+ * @param dependencies   the ids of the objects
+ */
+QByteArray CodeGenerationRecord::dependencyHash(const QStringList& dependencies)
+{
+    UMLDoc *umldoc = UMLApp::app()->document();
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    foreach (const QString& id, dependencies) {
+        hash.addData(id.toLatin1());
+        UMLObject *obj = umldoc->findObjectById(Uml::ID::fromString(id));
+        if (obj)
+            hash.addData(contentHash(obj));
+    }
+    return hash.result();
+}
+
+/**
+ * Return the hash of the settings which influence the generated code.
+ * The contents of the heading files are not covered.
+ */
+QByteArray CodeGenerationRecord::settingsHash()
+{
+    const Settings::CodeGenerationState& state = Settings::optionState().codeGenerationState;
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << int(UMLApp::app()->activeLanguage())
+           << state.autoGenEmptyConstructors
+           << int(state.commentStyle)
+           << int(state.defaultAssocFieldScope)
+           << int(state.defaultAttributeAccessorScope)
+           << state.forceDoc
+           << state.forceSections
+           << state.headingsDirectory.absolutePath()
+           << state.includeHeadings
+           << state.indentationAmount
+           << int(state.indentationType)
+           << int(state.lineEndingType)
+           << int(state.modnamePolicy)
+           << state.outputDirectory.absolutePath();
+
+    const Settings::CodeGenerationState::CPPCodeGenerationState& cpp = state.cppCodeGenerationState;
+    stream << cpp.autoGenAccessors
+           << cpp.inlineAccessors
+           << cpp.inlineOps
+           << cpp.packageIsNamespace
+           << cpp.publicAccessors
+           << cpp.stringClassName
+           << cpp.stringClassNameInclude
+           << cpp.stringIncludeIsGlobal
+           << cpp.vectorClassName
+           << cpp.vectorClassNameInclude
+           << cpp.docToolTag
+           << cpp.vectorIncludeIsGlobal
+           << cpp.virtualDestructors;
+
+    const Settings::CodeGenerationState::DCodeGenerationState& d = state.dCodeGenerationState;
+    stream << d.autoGenerateAttributeAccessors
+           << d.autoGenerateAssocAccessors
+           << d.buildANTDocument;
+
+    const Settings::CodeGenerationState::JavaCodeGenerationState& java = state.javaCodeGenerationState;
+    stream << java.autoGenerateAttributeAccessors
+           << java.autoGenerateAssocAccessors
+           << java.buildANTDocument;
+
+    const Settings::CodeGenerationState::RubyCodeGenerationState& ruby = state.rubyCodeGenerationState;
+    stream << ruby.autoGenerateAttributeAccessors
+           << ruby.autoGenerateAssocAccessors;
+
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+/**
+ * Save the record as child of the <codegenerator> element.
+ * @param doc    the document
+ * @param root   the <codegenerator> element
+ */
+void CodeGenerationRecord::saveToXMI(QDomDocument& doc, QDomElement& root) const
+{
+    QDomElement element = doc.createElement(QLatin1String("generatedfiles"));
+    element.setAttribute(QLatin1String("settings"), QString::fromLatin1(m_settingsHash.toHex()));
+    QStringList ids = m_entries.keys();
+    ids.sort();
+    foreach (const QString& id, ids) {
+        const Entry& entry = m_entries[id];
+        QDomElement fileElement = doc.createElement(QLatin1String("generatedfile"));
+        fileElement.setAttribute(QLatin1String("id"), id);
+        fileElement.setAttribute(QLatin1String("file"), entry.fileName);
+        fileElement.setAttribute(QLatin1String("hash"), QString::fromLatin1(entry.contentHash.toHex()));
+        fileElement.setAttribute(QLatin1String("dependencies"), entry.dependencies.join(QLatin1String(" ")));
+        fileElement.setAttribute(QLatin1String("dependencyhash"), QString::fromLatin1(entry.dependencyHash.toHex()));
+        element.appendChild(fileElement);
+    }
+    root.appendChild(element);
+}
+
+/**
+ * Load the record from its <generatedfiles> element.
+ * @param element   the element
+ */
+void CodeGenerationRecord::loadFromXMI(QDomElement& element)
+{
+    clear();
+    m_settingsHash = QByteArray::fromHex(element.attribute(QLatin1String("settings")).toLatin1());
+    QDomElement fileElement = element.firstChildElement(QLatin1String("generatedfile"));
+    for (; !fileElement.isNull(); fileElement = fileElement.nextSiblingElement(QLatin1String("generatedfile"))) {
+        Entry entry;
+        entry.fileName = fileElement.attribute(QLatin1String("file"));
+        entry.contentHash = QByteArray::fromHex(fileElement.attribute(QLatin1String("hash")).toLatin1());
+        entry.dependencies = fileElement.attribute(QLatin1String("dependencies")).split(QLatin1Char(' '), QString::SkipEmptyParts);
+        entry.dependencyHash = QByteArray::fromHex(fileElement.attribute(QLatin1String("dependencyhash")).toLatin1());
+        m_entries.insert(fileElement.attribute(QLatin1String("id")), entry);
+    }
+}
@@ -0,0 +1,78 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef CODEGENERATIONRECORD_H
+#define CODEGENERATIONRECORD_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+class ClassifierCodeDocument;
+class CodeDocument;
+class UMLObject;
+class QDomDocument;
+class QDomElement;
+
+/**
+ * This class records the files written for classifier code documents,
+ * so that an incremental code generation run rewrites only the files
+ * whose classifier changed.
+ *
+ * For each generated classifier the record keeps the file name, a hash
+ * of the model content of the classifier, the classifiers its file
+ * depends on (the ones found by CodeGenerator::findObjectsRelated()) and
+ * a hash of their content at the time the file was written. A hash of
+ * the code generation settings covers all files; when it changes, every
+ * file is regenerated.
+ *
+ * The record is saved in the <codegenerator> element of the XMI file.
+ *
+ * @short Record of incrementally generated code files
+ * Bugs and comments to umbrello-devel@kde.org or http://bugs.kde.org
+ */
+class CodeGenerationRecord
+{
+public:
+    CodeGenerationRecord();
+
+    void clear();
+    bool isEmpty() const;
+
+    void startRun();
+    bool isUpToDate(ClassifierCodeDocument* doc);
+    void setGenerated(ClassifierCodeDocument* doc, const QString& fileName);
+    void invalidate(CodeDocument* doc);
+
+    void saveToXMI(QDomDocument& doc, QDomElement& root) const;
+    void loadFromXMI(QDomElement& element);
+
+private:
+    class Entry
+    {
+    public:
+        QString fileName;               ///< relative to the output directory
+        QByteArray contentHash;         ///< of the classifier
+        QStringList dependencies;       ///< ids of the related classifiers
+        QByteArray dependencyHash;      ///< of the related classifiers
+    };
+
+    QByteArray contentHash(UMLObject* obj);
+    QByteArray dependencyHash(const QStringList& dependencies);
+
+    static QByteArray settingsHash();
+
+    QHash<QString, Entry> m_entries;                     ///< by classifier id
+    QByteArray m_settingsHash;
+    QHash<UMLObject*, QByteArray> m_contentHashes;   ///< computed in the current run
+};
+
+#endif
@@ -22,7 +22,11 @@
 #include "classifier.h"
 #include "classifiercodedocument.h"
 #include "codedocument.h"
+#include "codeemitter.h"
+#include "codefilewriter.h"
 #include "codegenerationpolicy.h"
+#include "codegenerationrecord.h"
+#include "keywordtable.h"
 #include "operation.h"
 #include "uml.h"
 #include "umldoc.h"
@@ -41,17 +45,50 @@
 #include <QDomElement>
 #include <QPointer>
 #include <QRegExp>
-#include <QTextStream>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVector>
 
 // system includes
 #include <cstdlib>  // to get the user name
 
+/**
+ * Build the text of a code document in a worker thread and pass it
+ * to the writer thread.
+ */
+class CodeDocumentTask : public QRunnable
+{
+public:
+    CodeDocumentTask(CodeDocument* doc, CodeFileWriter::File* file, CodeFileWriter* writer)
+      : m_doc(doc),
+        m_file(file),
+        m_writer(writer)
+    {
+    }
+
+    void run()
+    {
+        // the serial code generation ends the file with a newline
+        StringCodeEmitter emitter;
+        m_doc->write(emitter);
+        emitter.write(QLatin1Char('\n'));
+        m_file->text = emitter.text();
+        m_writer->enqueue(m_file);
+    }
+
+private:
+    CodeDocument* m_doc;
+    CodeFileWriter::File* m_file;
+    CodeFileWriter* m_writer;
+};
+
 /**
  * Constructor for a code generator.
  */
 CodeGenerator::CodeGenerator()
   : m_applyToAllRemaining(true),
     m_document(UMLApp::app()->document()),
+    m_generationRecord(new CodeGenerationRecord),
     m_lastIDIndex(0)
 {
     // initial population of our project generator
@@ -69,6 +106,7 @@ CodeGenerator::~CodeGenerator()
     // destroy all owned codedocuments
     qDeleteAll(m_codedocumentVector);
     m_codedocumentVector.clear();
+    delete m_generationRecord;
 }
 
 /**
@@ -171,6 +209,15 @@ CodeDocumentList * CodeGenerator::getCodeDocumentList()
     return &m_codedocumentVector;
 }
 
+/**
+ * Get the record of the files written by incremental code generation.
+ * @return the record, owned by the code generator
+ */
+CodeGenerationRecord * CodeGenerator::generationRecord()
+{
+    return m_generationRecord;
+}
+
 /**
  * Load codegenerator data from xmi.
  * @param qElement   the element from which to load
@@ -196,6 +243,9 @@ void CodeGenerator::loadFromXMI(QDomElement & qElement)
         if (docTag == QLatin1String("sourcecode")) {
             loadCodeForOperation(id, codeDocElement);
         }
+        else if (docTag == QLatin1String("generatedfiles")) {
+            m_generationRecord->loadFromXMI(codeDocElement);
+        }
         else if (docTag == QLatin1String("codedocument") || docTag == QLatin1String("classifiercodedocument")) {
             CodeDocument * codeDoc = findCodeDocumentByID(id);
             if (codeDoc) {
@@ -272,6 +322,9 @@ void CodeGenerator::saveToXMI(QDomDocument & doc, QDomElement & root)
         for (; it != end; ++it) {
             (*it)->saveToXMI(doc, docElement);
         }
+        if (!m_generationRecord->isEmpty()) {
+            m_generationRecord->saveToXMI(doc, docElement);
+        }
     }
     root.appendChild(docElement);
 }
@@ -339,6 +392,27 @@ void CodeGenerator::writeCodeToFile(UMLClassifierList & concepts)
  */
 void CodeGenerator::writeListedCodeDocsToFile(CodeDocumentList * docs)
 {
+    // in incremental mode skip the documents whose files are up to date
+    const bool incremental = UMLApp::app()->commonPolicy()->getIncrementalGeneration();
+    CodeDocumentList changedDocs;
+    if (incremental) {
+        m_generationRecord->startRun();
+        foreach (CodeDocument *doc, *docs) {
+            ClassifierCodeDocument * cdoc = dynamic_cast<ClassifierCodeDocument *>(doc);
+            if (cdoc && doc->getWriteOutCode() && m_generationRecord->isUpToDate(cdoc)) {
+                emit codeGenerated(cdoc->getParentClassifier(), true);
+                continue;
+            }
+            changedDocs.append(doc);
+        }
+        docs = &changedDocs;
+    }
+
+    if (UMLApp::app()->commonPolicy()->getParallelGeneration() && docs->count() > 1) {
+        writeListedCodeDocsInParallel(docs);
+        return;
+    }
+
     // iterate thru all code documents
     CodeDocumentList::iterator it = docs->begin();
     CodeDocumentList::iterator end = docs->end();
@@ -354,11 +428,21 @@ void CodeGenerator::writeListedCodeDocsToFile(CodeDocumentList * docs)
             // check that we may open that file for writing
             QFile file;
             if (openFile(file, filename)) {
-                QTextStream stream(&file);
-                stream << (*it)->toString() << endl;
+                DeviceCodeEmitter emitter(&file);
+                (*it)->write(emitter);
+                emitter.write(QLatin1Char('\n'));
+                emitter.flush();
                 file.close();
-                codeGenSuccess = true; // we wrote the code - OK
-                emit showGeneratedFile(file.fileName());
+                codeGenSuccess = emitter.success();
+                if (!codeGenSuccess) {
+                    uWarning() << "Cannot write file :" << file.fileName();
+                }
+                else {
+                    if (cdoc && incremental) {
+                        m_generationRecord->setGenerated(cdoc, filename);
+                    }
+                    emit showGeneratedFile(file.fileName());
+                }
             }
             else {
                 uWarning() << "Cannot open file :" << file.fileName() << " for writing!";
@@ -372,6 +456,71 @@ void CodeGenerator::writeListedCodeDocsToFile(CodeDocumentList * docs)
     }
 }
 
+/**
+ * Write the code documents like writeListedCodeDocsToFile(), but build
+ * their text concurrently.
+ * The file names are determined first, so that the overwrite policy is
+ * applied and the user is asked in the same order as without threads.
+ * Then the text of the documents is built on a thread pool and written
+ * by a CodeFileWriter, which skips files whose content did not change.
+ * The calling thread waits for the workers, so that the model and the
+ * code documents cannot change while they are read. Finally the signals
+ * are emitted for each document in the original order.
+ */
+void CodeGenerator::writeListedCodeDocsInParallel(CodeDocumentList * docs)
+{
+    QDir outputDirectory = UMLApp::app()->commonPolicy()->getOutputDirectory();
+    if (!outputDirectory.exists())
+        outputDirectory.mkpath(outputDirectory.absolutePath());
+    const bool incremental = UMLApp::app()->commonPolicy()->getIncrementalGeneration();
+
+    QVector<CodeFileWriter::File> files(docs->count());
+    QVector<bool> named(docs->count(), false);
+    for (int i = 0; i < docs->count(); ++i) {
+        CodeDocument *doc = docs->at(i);
+        if (!doc->getWriteOutCode())
+            continue;
+        QString filename = findFileName(doc);
+        if (filename.isEmpty()) {
+            uWarning() << "cannot find a file name";
+            continue;
+        }
+        files[i].fileName = outputDirectory.absoluteFilePath(filename);
+        named[i] = true;
+    }
+
+    CodeFileWriter writer;
+    writer.start();
+    QThreadPool pool;
+    for (int i = 0; i < docs->count(); ++i) {
+        if (named[i])
+            pool.start(new CodeDocumentTask(docs->at(i), &files[i], &writer));
+    }
+    pool.waitForDone();
+    writer.finish();
+
+    for (int i = 0; i < docs->count(); ++i) {
+        ClassifierCodeDocument * cdoc = dynamic_cast<ClassifierCodeDocument *>(docs->at(i));
+        bool codeGenSuccess = false;
+        if (named[i]) {
+            codeGenSuccess = files[i].success;
+            if (codeGenSuccess && cdoc && incremental) {
+                m_generationRecord->setGenerated(cdoc, outputDirectory.relativeFilePath(files[i].fileName));
+            }
+            if (codeGenSuccess) {
+                emit showGeneratedFile(files[i].fileName);
+            }
+            else {
+                KMessageBox::sorry(0, i18n("Cannot open file %1 for writing. Please make sure the folder exists and you have permissions to write to it.", files[i].fileName), i18n("Cannot Open File"));
+                uWarning() << "Cannot open file :" << files[i].fileName << " for writing!";
+            }
+        }
+        if (cdoc) {
+            emit codeGenerated(cdoc->getParentClassifier(), codeGenSuccess);
+        }
+    }
+}
+
 /**
  * A single call to writeCodeToFile() usually entails processing many
  * items (e.g. as classifiers) for which code is generated.
@@ -541,14 +690,42 @@ bool CodeGenerator::openFile(QFile & file, const QString &fileName)
 }
 
 /**
- * Replaces spaces with underscores and capitalises as defined in m_modname
+ * Return whether the character is matched by "\\w" of QRegExp.
+ */
+static bool isWordCharacter(QChar c)
+{
+    return c.isLetterOrNumber() || c.isMark() || c == QLatin1Char('_');
+}
+
+/**
+ * Replaces each run of non word characters by an underscore, like
+ * replacing the regular expression "\\W+" by "_" does.
+ * Names which need no replacement are returned without a copy.
  * @return      QString
  * @param       name
  */
 QString CodeGenerator::cleanName(const QString &name)
 {
-    QString retval = name;
-    retval.replace(QRegExp(QLatin1String("\\W+")), QLatin1String("_"));
+    const QChar *data = name.constData();
+    const int length = name.length();
+    int i = 0;
+    while (i < length && isWordCharacter(data[i]))
+        ++i;
+    if (i == length)
+        return name;
+
+    QString retval;
+    retval.reserve(length);
+    retval.append(data, i);
+    while (i < length) {
+        if (isWordCharacter(data[i])) {
+            retval.append(data[i++]);
+        } else {
+            retval.append(QLatin1Char('_'));
+            while (i < length && !isWordCharacter(data[i]))
+                ++i;
+        }
+    }
     return retval;
 }
 
@@ -778,34 +955,35 @@ bool CodeGenerator::forceSections() const
 
 /**
  * Return the default datatypes for your language (bool, int etc).
- * Default implementation returns empty list.
+ * The datatypes are taken from the keyword table of language(),
+ * see Uml::ProgrammingLanguage::defaultDatatypes().
  */
 QStringList CodeGenerator::defaultDatatypes()
 {
-    return QStringList();
-    //empty by default, override in your code generator
+    return Uml::ProgrammingLanguage::defaultDatatypes(language()).toStringList();
 }
 
 /**
  * Check whether the given string is a reserved word for the
  * language of this code generator.
+ * The lookup in the keyword table does not allocate memory.
  *
  * @param keyword   string to check
  *
  */
 bool CodeGenerator::isReservedKeyword(const QString & keyword)
 {
-    const QStringList keywords = reservedKeywords();
-    return keywords.contains(keyword);
+    return Uml::ProgrammingLanguage::reservedKeywords(language()).contains(keyword);
 }
 
 /**
  * Get list of reserved keywords.
+ * The keywords are taken from the keyword table of language(),
+ * see Uml::ProgrammingLanguage::reservedKeywords().
  */
 QStringList CodeGenerator::reservedKeywords() const
 {
-    static QStringList emptyList;
-    return emptyList;
+    return Uml::ProgrammingLanguage::reservedKeywords(language()).toStringList();
 }
 
 /**
@@ -28,6 +28,7 @@ class UMLDoc;
 class UMLObject;
 class ClassifierCodeDocument;
 class CodeDocument;
+class CodeGenerationRecord;
 class CodeViewerDialog;
 class QDomDocument;
 class QDomElement;
@@ -65,6 +66,8 @@ public:
 
     CodeDocumentList * getCodeDocumentList();
 
+    CodeGenerationRecord * generationRecord();
+
     QString getUniqueID(CodeDocument * codeDoc);
 
     virtual void saveToXMI(QDomDocument & doc, QDomElement & root);
@@ -130,6 +133,7 @@ protected:
     bool openFile(QFile& file, const QString &name);
 
     void writeListedCodeDocsToFile(CodeDocumentList * docs);
+    void writeListedCodeDocsInParallel(CodeDocumentList * docs);
 
     virtual void finalizeRun();
 
@@ -147,6 +151,11 @@ protected:
      */
     UMLDoc* m_document;
 
+    /**
+     * The files written by incremental code generation.
+     */
+    CodeGenerationRecord* m_generationRecord;
+
 private:
     CodeDocumentList m_codedocumentVector;
     int m_lastIDIndex;
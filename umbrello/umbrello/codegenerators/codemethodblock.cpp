@@ -12,6 +12,7 @@
 #include "codemethodblock.h"
 
 #include "codeclassfield.h"
+#include "codeemitter.h"
 #include "classifiercodedocument.h"
 #include "codegenerationpolicy.h"
 #include "uml.h"
@@ -134,36 +135,20 @@ void CodeMethodBlock::setAttributesFromObject(TextBlock * obj)
 }
 
 /**
- * @return  QString
+ * Write the comment, the start and the end of the method and its
+ * body, which is indented by one more level.
+ * @param emitter   the emitter receiving the text
  */
-QString CodeMethodBlock::toString() const
+void CodeMethodBlock::write(CodeEmitter & emitter) const
 {
-    QString string;
-
     if (getWriteOutText()) {
-        QString indent = getIndentationString();
-        QString bodyIndent = getIndentationString(getIndentationLevel()+1);
-        QString endLine = UMLApp::app()->commonPolicy()->getNewLineEndingChars();
-
-        QString startMethod = formatMultiLineText (getStartMethodText(), indent, endLine);
-        QString body = formatMultiLineText (getText(), bodyIndent, endLine);
-        QString endMethod = formatMultiLineText(getEndMethodText(), indent, endLine);
-
-        QString comment = getComment()->toString();
-        if (!comment.isEmpty() && getComment()->getWriteOutText())
-            string.append(comment);
-
-        if (!startMethod.isEmpty())
-            string.append(startMethod);
-
-        if (!body.isEmpty())
-            string.append(body);
-
-        if (!endMethod.isEmpty())
-            string.append(endMethod);
+        const int level = getIndentationLevel();
 
+        getComment()->write(emitter);
+        emitter.writeLines(getStartMethodText(), level);
+        emitter.writeLines(getText(), level + 1);
+        emitter.writeLines(getEndMethodText(), level);
     }
-    return string;
 }
 
 void CodeMethodBlock::syncToParent()
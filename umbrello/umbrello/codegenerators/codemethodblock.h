@@ -42,7 +42,7 @@ public:
      */
     virtual ~CodeMethodBlock ();
 
-    virtual QString toString () const;
+    virtual void write (CodeEmitter & emitter) const;
 
     QString getStartMethodText () const;
 
@@ -12,6 +12,8 @@
 // own header
 #include "cppcodecomment.h"
 
+#include "codeemitter.h"
+
 // qt includes
 #include <QRegExp>
 
@@ -33,19 +35,13 @@ void CPPCodeComment::saveToXMI (QDomDocument & doc, QDomElement & root)
     root.appendChild(blockElement);
 }
 
-QString CPPCodeComment::toString () const
+void CPPCodeComment::write (CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if(getWriteOutText())
     {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
-        output.append(formatMultiLineText (getText() + endLine, indent + QLatin1String("// "), endLine));
+        emitter.writeLines(getText() + emitter.endLine(), getIndentationLevel(), QLatin1String("// "));
     }
-
-    return output;
 }
 
 QString CPPCodeComment::getNewEditorLine (int amount)
@@ -41,9 +41,9 @@ public:
     virtual void saveToXMI (QDomDocument & doc, QDomElement & root);
 
     /**
-     * @return  QString
+     * @param emitter   the emitter receiving the text
      */
-    QString toString () const;
+    void write (CodeEmitter & emitter) const;
 
     /**
      * UnFormat a long text string. Typically, this means removing
@@ -14,6 +14,7 @@
 
 // app includes
 #include "codedocument.h"
+#include "codeemitter.h"
 #include "codegenerator.h"
 #include "codegenerationpolicy.h"
 #include "uml.h"
@@ -42,12 +43,10 @@ void CPPCodeDocumentation::saveToXMI(QDomDocument & doc, QDomElement & root)
 }
 
 /**
- * @return   QString
+ * @param emitter   the emitter receiving the text
  */
-QString CPPCodeDocumentation::toString() const
+void CPPCodeDocumentation::write(CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if(getWriteOutText())
     {
@@ -58,21 +57,18 @@ QString CPPCodeDocumentation::toString() const
         if(p->getCommentStyle() == CodeGenerationPolicy::MultiLine)
             useDoubleDashOutput = false;
 
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
         if(useDoubleDashOutput)
         {
             if(!body.isEmpty())
-                output.append(formatMultiLineText (body, indent + QLatin1String("// "), endLine));
+                emitter.writeLines(body, level, QLatin1String("// "));
         } else {
-            output.append(indent + QLatin1String("/**") + endLine);
-            output.append(formatMultiLineText (body, indent + QLatin1String(" * "), endLine));
-            output.append(indent + QLatin1String(" */") + endLine);
+            emitter.writeLine(level, QLatin1String("/**"));
+            emitter.writeLines(body, level, QLatin1String(" * "));
+            emitter.writeLine(level, QLatin1String(" */"));
         }
     }
-
-    return output;
 }
 
 QString CPPCodeDocumentation::getNewEditorLine(int amount)
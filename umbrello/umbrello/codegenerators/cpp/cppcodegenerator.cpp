@@ -385,24 +385,6 @@ void CPPCodeGenerator::checkRemoveUMLObject(UMLObject * obj)
 
 }
 
-/**
- * Add C++ primitives as datatypes.
- * @return a string list of C++ datatypes
- */
-QStringList CPPCodeGenerator::defaultDatatypes()
-{
-    return Codegen_Utils::cppDatatypes();
-}
-
-/**
- * Get list of reserved keywords.
- * @return a string list with reserve keywords of this language
- */
-QStringList CPPCodeGenerator::reservedKeywords() const
-{
-    return Codegen_Utils::reservedCppKeywords();
-}
-
 /**
  * Add the default stereotypes for c++ (constructor, int etc)
  */
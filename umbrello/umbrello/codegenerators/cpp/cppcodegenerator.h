@@ -52,12 +52,8 @@ public:
     virtual void writeCodeToFile();
     virtual void writeCodeToFile(UMLClassifierList &list);
 
-    QStringList defaultDatatypes();
-
     virtual void saveToXMI (QDomDocument & doc, QDomElement & root);
 
-    virtual QStringList reservedKeywords() const;
-
     virtual void createDefaultStereotypes ();
 
     void initFromParentDocument();
@@ -11,6 +11,8 @@
 
 #include "cppcodegenerator.h"
 
+#include "codeemitter.h"
+
 #include <QRegExp>
 
 const char * CPPMakefileCodeDocument::DOCUMENT_ID_VALUE = "Makefile_DOC";
@@ -34,11 +36,11 @@ void CPPMakefileCodeDocument::updateContent()
 }
 
 /**
- * @return      QString
+ * @param emitter   the emitter receiving the code
  */
-QString CPPMakefileCodeDocument::toString ()
+void CPPMakefileCodeDocument::write (CodeEmitter & emitter)
 {
-    return QLatin1String("# cpp make build document");
+    emitter.write(QLatin1String("# cpp make build document"));
 }
 
 // We overwritten by CPP language implementation to get lowercase path
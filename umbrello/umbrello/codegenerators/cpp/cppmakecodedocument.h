@@ -38,9 +38,9 @@ public:
     virtual ~CPPMakefileCodeDocument ();
 
     /**
-     * @return  QString
+     * @param emitter   the emitter receiving the code
      */
-    QString toString ();
+    void write (CodeEmitter & emitter);
 
     QString getPath ();
 
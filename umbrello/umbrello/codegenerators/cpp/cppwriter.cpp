@@ -1315,21 +1315,3 @@ QString CppWriter::getAttributeVariableName(UMLAttribute *at)
     return fieldName;
 }
 
-/**
- * Add C++ primitives as datatypes.
- * @return   the list of default datatypes
- */
-QStringList CppWriter::defaultDatatypes()
-{
-    return Codegen_Utils::cppDatatypes();
-}
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList CppWriter::reservedKeywords() const
-{
-    return Codegen_Utils::reservedCppKeywords();
-}
-
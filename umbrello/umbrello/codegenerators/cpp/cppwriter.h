@@ -42,10 +42,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void writeClassDecl(UMLClassifier *c, QTextStream &cpp);
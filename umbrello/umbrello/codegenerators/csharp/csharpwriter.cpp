@@ -22,85 +22,6 @@
 #include <QRegExp>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "abstract",
-    "as",
-    "base",
-    "bool",
-    "break",
-    "byte",
-    "case",
-    "catch",
-    "char",
-    "checked",
-    "class",
-    "const",
-    "continue",
-    "decimal",
-    "default",
-    "delegate",
-    "do",
-    "double",
-    "else",
-    "enum",
-    "event",
-    "explicit",
-    "extern",
-    "false",
-    "finally",
-    "for",
-    "foreach",
-    "goto",
-    "if",
-    "implicit",
-    "in",
-    "int",
-    "interface",
-    "internal",
-    "is",
-    "lock",
-    "long",
-    "namespace",
-    "new",
-    "null",
-    "object",
-    "operator",
-    "out",
-    "override",
-    "params",
-    "private",
-    "protected",
-    "public",
-    "readonly",
-    "ref",
-    "return",
-    "sbyte",
-    "sealed",
-    "short",
-    "sizeof",
-    "stackalloc",
-    "static",
-    "string",
-    "struct",
-    "switch",
-    "this",
-    "throw",
-    "true",
-    "try",
-    "typeof",
-    "uint",
-    "ulong",
-    "unchecked",
-    "unsafe",
-    "ushort",
-    "using",
-    "virtual",
-    "void",
-    "volatile",
-    "while",
-    0
-};
-
 CSharpWriter::CSharpWriter()
  : SimpleCodeGenerator(),
    m_unnamedRoles(0)
@@ -112,33 +33,6 @@ CSharpWriter::~CSharpWriter()
 {
 }
 
-/**
- * Get list of predefined data types.
- */
-QStringList CSharpWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("bool"));
-    l.append(QLatin1String("byte"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("decimal"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("fixed"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("fixed"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("int"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("object"));
-    l.append(QLatin1String("sbyte"));
-    l.append(QLatin1String("short"));
-    l.append(QLatin1String("string"));
-    l.append(QLatin1String("uint"));
-    l.append(QLatin1String("ulong"));
-    l.append(QLatin1String("ushort"));
-    return l;
-}
-
 /**
  * Call this method to generate Php code for a UMLClassifier
  * @param c the class you want to generate code for.
@@ -774,20 +668,4 @@ Uml::ProgrammingLanguage::Enum CSharpWriter::language() const
     return Uml::ProgrammingLanguage::CSharp;
 }
 
-/**
- * Get list of reserved keywords.
- */
-QStringList CSharpWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
 
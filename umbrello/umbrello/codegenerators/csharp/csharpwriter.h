@@ -33,10 +33,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
-    QStringList defaultDatatypes();
-
 private:
 
     /**
@@ -12,6 +12,8 @@
 // own header
 #include "dcodecomment.h"
 
+#include "codeemitter.h"
+
 // qt/kde includes
 #include <QRegExp>
 
@@ -34,28 +36,23 @@ void DCodeComment::saveToXMI (QDomDocument & doc, QDomElement & root)
     root.appendChild(blockElement);
 }
 
-QString DCodeComment::toString () const
+void DCodeComment::write (CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if(getWriteOutText())
     {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
 
         // check the need for multiline comments
-        if (body.indexOf(QRegExp(endLine)) >= 0) {
-            output += indent + QLatin1String("/**") + endLine;
-            output += formatMultiLineText (body, indent + QLatin1String(" * "), endLine);
-            output += indent + QLatin1String(" */") + endLine;
+        if (body.contains(emitter.endLine())) {
+            emitter.writeLine(level, QLatin1String("/**"));
+            emitter.writeLines(body, level, QLatin1String(" * "));
+            emitter.writeLine(level, QLatin1String(" */"));
         } else {
-            output += formatMultiLineText (body, indent + QLatin1String("// "), endLine);
+            emitter.writeLines(body, level, QLatin1String("// "));
         }
     }
-
-    return output;
 }
 
 // TODO: where is this used?
@@ -47,9 +47,9 @@ public:
      * The syntax follows the D Style Guide (@see http://www.digitalmars.com/d/dstyle.html).
      * Single line comments begin with // and multiline comments use the longer form.
      *
-     * @return  QString Comment block source code.
+     * @param emitter   the emitter receiving the comment block source code
      */
-    QString toString () const;
+    void write (CodeEmitter & emitter) const;
 
     /**
      * UnFormat a long text string. Typically, this means removing
@@ -14,6 +14,7 @@
 
 // app includes
 #include "codedocument.h"
+#include "codeemitter.h"
 #include "codegenerator.h"
 #include "codegenerationpolicy.h"
 #include "uml.h"
@@ -38,10 +39,8 @@ void DCodeDocumentation::saveToXMI(QDomDocument & doc, QDomElement & root)
     root.appendChild(blockElement);
 }
 
-QString DCodeDocumentation::toString() const
+void DCodeDocumentation::write(CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if(getWriteOutText())
     {
@@ -52,23 +51,20 @@ QString DCodeDocumentation::toString() const
         if(p->getCommentStyle() == CodeGenerationPolicy::MultiLine)
             useDoubleDashOutput = false;
 
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
 
         if(useDoubleDashOutput)
         {
             if(!body.isEmpty()) {
-                output += (formatMultiLineText (body, indent + QLatin1String("// "), endLine));
+                emitter.writeLines(body, level, QLatin1String("// "));
             }
         } else {
-            output += indent + QLatin1String("/**") + endLine;
-            output += formatMultiLineText (body, indent + QLatin1String(" * "), endLine);
-            output += indent + QLatin1String(" */") + endLine;
+            emitter.writeLine(level, QLatin1String("/**"));
+            emitter.writeLines(body, level, QLatin1String(" * "));
+            emitter.writeLine(level, QLatin1String(" */"));
         }
     }
-
-    return output;
 }
 
 QString DCodeDocumentation::getNewEditorLine(int amount)
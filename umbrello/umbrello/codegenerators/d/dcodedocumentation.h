@@ -49,9 +49,9 @@ public:
      * The syntax follows the D Style Guide (@see http://www.digitalmars.com/d/dstyle.html).
      * Choice between single line and multiline comments is based on the common policy.
      *
-     * @return  QString Documentation block source code.
+     * @param emitter   the emitter receiving the documentation block source code
      */
-    QString toString () const;
+    void write (CodeEmitter & emitter) const;
 
     /**
      * UnFormat a long text string. Typically, this means removing
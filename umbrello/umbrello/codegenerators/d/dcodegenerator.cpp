@@ -140,151 +140,3 @@ CodeDocument * DCodeGenerator::newClassifierCodeDocument (UMLClassifier * classi
     return doc;
 }
 
-/**
- * Adds D's primitives as datatypes.
- * @return the list of primitive datatypes
- */
-QStringList DCodeGenerator::defaultDatatypes()
-{
-    QStringList l;
-    l << QLatin1String("void")
-      << QLatin1String("bool")
-      << QLatin1String("byte")
-      << QLatin1String("ubyte")
-      << QLatin1String("short")
-      << QLatin1String("ushort")
-      << QLatin1String("int")
-      << QLatin1String("uint")
-      << QLatin1String("long")
-      << QLatin1String("ulong")
-      << QLatin1String("cent")
-      << QLatin1String("ucent")
-      << QLatin1String("float")
-      << QLatin1String("double")
-      << QLatin1String("real")
-      << QLatin1String("ifloat")
-      << QLatin1String("idouble")
-      << QLatin1String("ireal")
-      << QLatin1String("cfloat")
-      << QLatin1String("cdouble")
-      << QLatin1String("creal")
-      << QLatin1String("char")
-      << QLatin1String("wchar")
-      << QLatin1String("dchar");
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- * @return the list of reserved keywords
- */
-QStringList DCodeGenerator::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords
-          << QLatin1String("abstract")
-          << QLatin1String("alias")
-          << QLatin1String("align")
-          << QLatin1String("asm")
-          << QLatin1String("assert")
-          << QLatin1String("auto")
-          << QLatin1String("body")
-          << QLatin1String("bool")
-          << QLatin1String("break")
-          << QLatin1String("byte")
-          << QLatin1String("case")
-          << QLatin1String("cast")
-          << QLatin1String("catch")
-          << QLatin1String("cdouble")
-          << QLatin1String("cent")
-          << QLatin1String("cfloat")
-          << QLatin1String("char")
-          << QLatin1String("class")
-          << QLatin1String("const")
-          << QLatin1String("continue")
-          << QLatin1String("creal")
-          << QLatin1String("dchar")
-          << QLatin1String("debug")
-          << QLatin1String("default")
-          << QLatin1String("delegate")
-          << QLatin1String("delete")
-          << QLatin1String("deprecated")
-          << QLatin1String("do")
-          << QLatin1String("double")
-          << QLatin1String("else")
-          << QLatin1String("enum")
-          << QLatin1String("export")
-          << QLatin1String("extern")
-          << QLatin1String("false")
-          << QLatin1String("final")
-          << QLatin1String("finally")
-          << QLatin1String("float")
-          << QLatin1String("for")
-          << QLatin1String("foreach")
-          << QLatin1String("foreach_reverse")
-          << QLatin1String("function")
-          << QLatin1String("goto")
-          << QLatin1String("idouble")
-          << QLatin1String("if")
-          << QLatin1String("ifloat")
-          << QLatin1String("import")
-          << QLatin1String("in")
-          << QLatin1String("inout")
-          << QLatin1String("int")
-          << QLatin1String("interface")
-          << QLatin1String("invariant")
-          << QLatin1String("ireal")
-          << QLatin1String("is")
-          << QLatin1String("lazy")
-          << QLatin1String("long")
-          << QLatin1String("macro")
-          << QLatin1String("mixin")
-          << QLatin1String("module")
-          << QLatin1String("msg")
-          << QLatin1String("new")
-          << QLatin1String("null")
-          << QLatin1String("out")
-          << QLatin1String("override")
-          << QLatin1String("package")
-          << QLatin1String("pragma")
-          << QLatin1String("private")
-          << QLatin1String("protected")
-          << QLatin1String("public")
-          << QLatin1String("real")
-          << QLatin1String("ref")
-          << QLatin1String("return")
-          << QLatin1String("scope")
-          << QLatin1String("short")
-          << QLatin1String("static")
-          << QLatin1String("struct")
-          << QLatin1String("super")
-          << QLatin1String("switch")
-          << QLatin1String("synchronized")
-          << QLatin1String("template")
-          << QLatin1String("this")
-          << QLatin1String("throw")
-          << QLatin1String("true")
-          << QLatin1String("try")
-          << QLatin1String("typedef")
-          << QLatin1String("typeid")
-          << QLatin1String("typeof")
-          << QLatin1String("ubyte")
-          << QLatin1String("ucent")
-          << QLatin1String("uint")
-          << QLatin1String("ulong")
-          << QLatin1String("union")
-          << QLatin1String("unittest")
-          << QLatin1String("ushort")
-          << QLatin1String("version")
-          << QLatin1String("void")
-          << QLatin1String("volatile")
-          << QLatin1String("wchar")
-          << QLatin1String("while")
-          << QLatin1String("with");
-    }
-
-    return keywords;
-}
-
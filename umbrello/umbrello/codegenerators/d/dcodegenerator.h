@@ -47,12 +47,8 @@ public:
 
     Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList defaultDatatypes();
-
     static QString fixTypeName(const QString &item);
 
-    virtual QStringList reservedKeywords() const;
-
 protected:
 
 //    /**
@@ -724,41 +724,6 @@ QString DWriter::fixTypeName(const QString& string)
     return string;
 }
 
-/**
- * Return the default datatypes.
- * (Overrides method from class CodeGenerator.)
- * @return   list of default datatypes
- */
-QStringList DWriter::defaultDatatypes()
-{
-    QStringList l;
-    l << QLatin1String("void")
-      << QLatin1String("bool")
-      << QLatin1String("byte")
-      << QLatin1String("ubyte")
-      << QLatin1String("short")
-      << QLatin1String("ushort")
-      << QLatin1String("int")
-      << QLatin1String("uint")
-      << QLatin1String("long")
-      << QLatin1String("ulong")
-      << QLatin1String("cent")
-      << QLatin1String("ucent")
-      << QLatin1String("float")
-      << QLatin1String("double")
-      << QLatin1String("real")
-      << QLatin1String("ifloat")
-      << QLatin1String("idouble")
-      << QLatin1String("ireal")
-      << QLatin1String("cfloat")
-      << QLatin1String("cdouble")
-      << QLatin1String("creal")
-      << QLatin1String("char")
-      << QLatin1String("wchar")
-      << QLatin1String("dchar");
-    return l;
-}
-
 
 bool DWriter::compareDMethod(UMLOperation *op1, UMLOperation *op2)
 {
@@ -40,8 +40,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
 private:
 
     /**
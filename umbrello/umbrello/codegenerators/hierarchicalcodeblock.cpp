@@ -16,6 +16,7 @@
 #include "codedocument.h"
 #include "classifiercodedocument.h"
 #include "codeclassfield.h"
+#include "codeemitter.h"
 #include "codegenerationpolicy.h"
 #include "codegenerators/codegenfactory.h"
 #include "debug_utils.h"
@@ -308,52 +309,31 @@ void HierarchicalCodeBlock::setAttributesFromObject (TextBlock * obj)
 }
 
 /**
- * @return  QString
+ * Write the comment, the start text, the child text blocks and the
+ * end text of the block.
+ * @param emitter   the emitter receiving the text
  */
-QString HierarchicalCodeBlock::toString() const
+void HierarchicalCodeBlock::write(CodeEmitter & emitter) const
 {
-    QString string;
-
     if (getWriteOutText()) {
-        QString indent = getIndentationString();
-        QString endLine = UMLApp::app()->commonPolicy()->getNewLineEndingChars();
-        QString startText;
-        QString endText;
+        const int level = getIndentationLevel();
+
+        getComment()->write(emitter);
         if (!getStartText().isEmpty())
-            startText = formatMultiLineText (getStartText(), indent, endLine);
+            emitter.writeLines(getStartText(), level);
+        writeChildTextBlocks(emitter);
         if (!getEndText().isEmpty())
-            endText = formatMultiLineText (getEndText(), indent, endLine);
-
-        QString body = childTextBlocksToString();
-        QString comment = getComment()->toString();
-
-        // tack in text, if there is something there..
-        if (!comment.isEmpty() && getComment()->getWriteOutText())
-            string.append(comment);
-
-        if (!startText.isEmpty())
-            string.append(startText);
-
-        if (!body.isEmpty())
-            string.append(body);
-
-        if (!endText.isEmpty())
-            string.append(endText);
+            emitter.writeLines(getEndText(), level);
     }
-    return string;
 }
 
-QString  HierarchicalCodeBlock::childTextBlocksToString() const
+void HierarchicalCodeBlock::writeChildTextBlocks(CodeEmitter & emitter) const
 {
     TextBlockList* list = getTextBlockList();
-    QString retString;
     foreach (TextBlock* block, *list)
     {
-        QString blockValue = block->toString();
-        if (!blockValue.isEmpty())
-            retString.append(blockValue);
+        block->write(emitter);
     }
-    return retString;
 }
 
 /**
@@ -49,7 +49,7 @@ public:
 
     virtual void loadFromXMI (QDomElement & root);
 
-    virtual QString toString () const;
+    virtual void write (CodeEmitter & emitter) const;
 
     QString getUniqueTag();
     QString getUniqueTag(const QString& prefix);
@@ -77,7 +77,7 @@ private:
     QString m_startText;
     QString m_endText;
 
-    QString childTextBlocksToString() const;
+    void writeChildTextBlocks(CodeEmitter & emitter) const;
     void initAttributes () ;
 
 };
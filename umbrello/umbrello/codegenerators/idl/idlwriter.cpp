@@ -433,67 +433,3 @@ void IDLWriter::writeOperation(UMLOperation *op, QTextStream &idl, bool is_comme
     }
     idl << ");" << m_endl << m_endl;
 }
-
-QStringList IDLWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("boolean"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("octet"));
-    l.append(QLatin1String("short"));
-    l.append(QLatin1String("unsigned short"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("unsigned long"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("string"));
-    l.append(QLatin1String("any"));
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- */
-QStringList IDLWriter::reservedKeywords() const 
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords
-          << QLatin1String("any")
-          << QLatin1String("attribute")
-          << QLatin1String("boolean")
-          << QLatin1String("case")
-          << QLatin1String("char")
-          << QLatin1String("const")
-          << QLatin1String("context")
-          << QLatin1String("default")
-          << QLatin1String("double")
-          << QLatin1String("enum")
-          << QLatin1String("exception")
-          << QLatin1String("FALSE")
-          << QLatin1String("float")
-          << QLatin1String("in")
-          << QLatin1String("inout")
-          << QLatin1String("interface")
-          << QLatin1String("long")
-          << QLatin1String("module")
-          << QLatin1String("octet")
-          << QLatin1String("oneway")
-          << QLatin1String("out")
-          << QLatin1String("raises")
-          << QLatin1String("readonly")
-          << QLatin1String("sequence")
-          << QLatin1String("short")
-          << QLatin1String("string")
-          << QLatin1String("struct")
-          << QLatin1String("switch")
-          << QLatin1String("TRUE")
-          << QLatin1String("typedef")
-          << QLatin1String("union")
-          << QLatin1String("unsigned")
-          << QLatin1String("void");
-    }
-
-    return keywords;
-}
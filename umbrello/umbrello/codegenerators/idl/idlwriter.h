@@ -37,10 +37,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void writeOperation(UMLOperation* op, QTextStream& idl, bool is_comment = false);
@@ -11,6 +11,8 @@
 
 #include "javacodecomment.h"
 
+#include "codeemitter.h"
+
 #include <QRegExp>
 
 JavaCodeComment::JavaCodeComment (CodeDocument * doc, const QString & text)
@@ -42,18 +44,12 @@ QString JavaCodeComment::unformatText (const QString & text, const QString & ind
 }
 
 /**
- * @return      QString
+ * @param emitter   the emitter receiving the text
  */
-QString JavaCodeComment::toString () const
+void JavaCodeComment::write (CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if (getWriteOutText()) {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
-        output.append(formatMultiLineText (getText(), indent + QLatin1String("// "), endLine));
+        emitter.writeLines(getText(), getIndentationLevel(), QLatin1String("// "));
     }
-
-    return output;
 }
@@ -37,9 +37,9 @@ public:
     virtual ~JavaCodeComment ();
 
     /**
-     * @return  QString
+     * @param emitter   the emitter receiving the text
      */
-    QString toString () const;
+    void write (CodeEmitter & emitter) const;
 
     /**
      * UnFormat a long text string. Typically, this means removing
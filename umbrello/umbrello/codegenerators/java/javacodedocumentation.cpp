@@ -13,6 +13,7 @@
 #include "javacodedocumentation.h"
 
 // local includes
+#include "codeemitter.h"
 #include "codegenerationpolicy.h"
 #include "javaclassifiercodedocument.h"
 #include "uml.h"
@@ -41,12 +42,10 @@ void JavaCodeDocumentation::saveToXMI(QDomDocument & doc, QDomElement & root)
 }
 
 /**
- * @return      QString
+ * @param emitter   the emitter receiving the text
  */
-QString JavaCodeDocumentation::toString() const
+void JavaCodeDocumentation::write(CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if(getWriteOutText())
     {
@@ -57,21 +56,18 @@ QString JavaCodeDocumentation::toString() const
         if(p->getCommentStyle() == CodeGenerationPolicy::MultiLine)
             useDoubleDashOutput = false;
 
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
         if(useDoubleDashOutput)
         {
             if(!body.isEmpty())
-                output.append(formatMultiLineText (body, indent + QLatin1String("// "), endLine));
+                emitter.writeLines(body, level, QLatin1String("// "));
         } else {
-            output.append(indent + QLatin1String("/**") + endLine);
-            output.append(formatMultiLineText (body, indent + QLatin1String(" * "), endLine));
-            output.append(indent + QLatin1String(" */") + endLine);
+            emitter.writeLine(level, QLatin1String("/**"));
+            emitter.writeLines(body, level, QLatin1String(" * "));
+            emitter.writeLine(level, QLatin1String(" */"));
         }
     }
-
-    return output;
 }
 
 QString JavaCodeDocumentation::getNewEditorLine(int amount)
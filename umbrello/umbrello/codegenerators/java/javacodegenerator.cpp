@@ -26,164 +26,6 @@
 // qt includes
 #include <QRegExp>
 
-static const char *reserved_words[] = {
-    "abstract",
-    "AbstractMethodError",
-    "ArithmeticException",
-    "ArrayIndexOutOfBoundsException",
-    "ArrayStoreException",
-    "assert",
-    "AssertionError",
-    "auto",
-    "boolean",
-    "Boolean",
-    "break",
-    "byte",
-    "Byte",
-    "catch",
-    "char",
-    "Character",
-    "CharSequence",
-    "Class",
-    "ClassCastException",
-    "ClassCircularityError",
-    "ClassFormatError",
-    "ClassLoader",
-    "ClassNotFoundException",
-    "clone",
-    "Cloneable",
-    "CloneNotSupportedException",
-    "Comparable",
-    "Compiler",
-    "const",
-    "continue",
-    "default",
-    "delete",
-    "do",
-    "double",
-    "Double",
-    "else",
-    "enum",
-    "equals",
-    "Error",
-    "Exception",
-    "ExceptionInInitializerError",
-    "extends",
-    "extern",
-    "false",
-    "final",
-    "finalize",
-    "finally",
-    "float",
-    "Float",
-    "for",
-    "friend",
-    "getClass",
-    "goto",
-    "hashCode",
-    "if",
-    "IllegalAccessError",
-    "IllegalAccessException",
-    "IllegalArgumentException",
-    "IllegalMonitorStateException",
-    "IllegalStateException",
-    "IllegalThreadStateException",
-    "implements",
-    "import",
-    "IncompatibleClassChangeError",
-    "IndexOutOfBoundsException",
-    "InheritableThreadLocal",
-    "inline",
-    "instanceof",
-    "InstantiationError",
-    "InstantiationException",
-    "int",
-    "Integer",
-    "interface",
-    "InternalError",
-    "InterruptedException",
-    "LinkageError",
-    "long",
-    "Long",
-    "Math",
-    "native",
-    "NegativeArraySizeException",
-    "new",
-    "nextgroup=javaUserLabelRef",
-    "NoClassDefFoundError",
-    "NoSuchFieldError",
-    "NoSuchFieldException",
-    "NoSuchMethodError",
-    "NoSuchMethodException",
-    "notifyAll",
-    "null",
-    "NullPointerException",
-    "Number",
-    "NumberFormatException",
-    "Object",
-    "operator",
-    "OutOfMemoryError",
-    "package",
-    "Package",
-    "private",
-    "Process",
-    "protected",
-    "redeclared",
-    "register",
-    "return",
-    "Runnable",
-    "Runtime",
-    "RuntimeException",
-    "RuntimePermission",
-    "SecurityException",
-    "SecurityManager",
-    "serializable",
-    "short",
-    "Short",
-    "signed",
-    "sizeof",
-    "skipwhite",
-    "StackOverflowError",
-    "StackTraceElement",
-    "static",
-    "strictfp",
-    "StrictMath",
-    "String",
-    "StringBuffer",
-    "StringIndexOutOfBoundsException",
-    "struct",
-    "super",
-    "switch",
-    "synchronized",
-    "template",
-    "this",
-    "Thread",
-    "ThreadDeath",
-    "ThreadGroup",
-    "ThreadLocal",
-    "throw",
-    "Throwable",
-    "throws",
-    "toString",
-    "transient",
-    "true",
-    "try",
-    "typedef",
-    "union",
-    "UnknownError",
-    "UnsatisfiedLinuError",
-    "unsigned",
-    "UnsupportedClassVersionError",
-    "UnsupportedOperationException",
-    "VirtualMachineError",
-    "void",
-    "Void",
-    "volatile",
-    "wait",
-    "while",
-    0
-};
-
 /**
  * Constructor.
  */
@@ -321,50 +163,4 @@ CodeDocument * JavaCodeGenerator::newClassifierCodeDocument(UMLClassifier * clas
     return doc;
 }
 
-/**
- * Adds Java's primitives as datatypes.
- * @return a string list of Java primitives
- */
-QStringList JavaCodeGenerator::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("int"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("boolean"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("byte"));
-    l.append(QLatin1String("short"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("String"));
-    l.append(QLatin1String("Integer"));
-    l.append(QLatin1String("Character"));
-    l.append(QLatin1String("Boolean"));
-    l.append(QLatin1String("Float"));
-    l.append(QLatin1String("Double"));
-    l.append(QLatin1String("Byte"));
-    l.append(QLatin1String("Short"));
-    l.append(QLatin1String("Long"));
-    l.append(QLatin1String("StringBuffer"));
-    l.append(QLatin1String("StringBuilder"));
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- * @return the string list of reserved keywords for Java
- */
-QStringList JavaCodeGenerator::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
 
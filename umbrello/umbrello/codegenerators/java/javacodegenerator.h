@@ -50,12 +50,8 @@ public:
 
     Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList defaultDatatypes();
-
     static QString fixTypeName(const QString &string);
 
-    virtual QStringList reservedKeywords() const;
-
 protected:
 
 //    /**
@@ -731,35 +731,6 @@ QString JavaWriter::fixTypeName(const QString& string)
     return string;
 }
 
-/**
- * Overrides method from class CodeGenerator.
- * @return   the list of default datatypes
- */
-QStringList JavaWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("int"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("boolean"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("byte"));
-    l.append(QLatin1String("short"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("String"));
-    l.append(QLatin1String("Integer"));
-    l.append(QLatin1String("Character"));
-    l.append(QLatin1String("Boolean"));
-    l.append(QLatin1String("Float"));
-    l.append(QLatin1String("Double"));
-    l.append(QLatin1String("Byte"));
-    l.append(QLatin1String("Short"));
-    l.append(QLatin1String("Long"));
-    l.append(QLatin1String("StringBuffer"));
-    l.append(QLatin1String("StringBuilder"));
-    return l;
-}
-
 /**
  * Return true if the two operations have the same name and the same parameters.
  * @param op1   first operation to be compared
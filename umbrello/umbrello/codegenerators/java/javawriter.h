@@ -39,8 +39,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
 private:
     void writeClassDecl(UMLClassifier *c, QTextStream &java);
 
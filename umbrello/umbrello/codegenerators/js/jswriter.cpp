@@ -291,37 +291,3 @@ Uml::ProgrammingLanguage::Enum JSWriter::language() const
     return Uml::ProgrammingLanguage::JavaScript;
 }
 
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList JSWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords
-          << QLatin1String("break")
-          << QLatin1String("case")
-          << QLatin1String("const")
-          << QLatin1String("continue")
-          << QLatin1String("default")
-          << QLatin1String("else")
-          << QLatin1String("false")
-          << QLatin1String("for")
-          << QLatin1String("function")
-          << QLatin1String("if")
-          << QLatin1String("in")
-          << QLatin1String("new")
-          << QLatin1String("return")
-          << QLatin1String("switch")
-          << QLatin1String("this")
-          << QLatin1String("true")
-          << QLatin1String("var")
-          << QLatin1String("while")
-          << QLatin1String("with");
-    }
-
-    return keywords;
-}
-
@@ -34,8 +34,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
 private:
     void writeOperations(QString classname, UMLOperationList *opList, QTextStream &js);
 
@@ -408,181 +408,3 @@ void PascalWriter::writeOperation(UMLOperation *op, QTextStream &pas, bool is_co
     }
 }
 
-/**
- * Returns the default datatypes in a list.
- * @return  the list of default datatypes
- */
-QStringList PascalWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("AnsiString"));
-    l.append(QLatin1String("Boolean"));
-    l.append(QLatin1String("Byte"));
-    l.append(QLatin1String("ByteBool"));
-    l.append(QLatin1String("Cardinal"));
-    l.append(QLatin1String("Character"));
-    l.append(QLatin1String("Currency"));
-    l.append(QLatin1String("Double"));
-    l.append(QLatin1String("Extended"));
-    l.append(QLatin1String("Int64"));
-    l.append(QLatin1String("Integer"));
-    l.append(QLatin1String("Longint"));
-    l.append(QLatin1String("LongBool"));
-    l.append(QLatin1String("Longword"));
-    l.append(QLatin1String("QWord"));
-    l.append(QLatin1String("Real"));
-    l.append(QLatin1String("Shortint"));
-    l.append(QLatin1String("ShortString"));
-    l.append(QLatin1String("Single"));
-    l.append(QLatin1String("Smallint"));
-    l.append(QLatin1String("String"));
-    l.append(QLatin1String("WideString"));
-    l.append(QLatin1String("Word"));
-    return l;
-}
-
-/**
- * Check whether the given string is a reserved word for the
- * language of this code generator.
- * @param rPossiblyReservedKeyword   the string to check
- */
-bool PascalWriter::isReservedKeyword(const QString & rPossiblyReservedKeyword)
-{
-    const QStringList keywords = reservedKeywords();
-
-    QStringList::ConstIterator it;
-    for (it = keywords.begin(); it != keywords.end(); ++it)
-        if ((*it).toLower() == rPossiblyReservedKeyword.toLower())
-            return true;
-
-    return false;
-}
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList PascalWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords.append(QLatin1String("absolute"));
-        keywords.append(QLatin1String("abstract"));
-        keywords.append(QLatin1String("and"));
-        keywords.append(QLatin1String("array"));
-        keywords.append(QLatin1String("as"));
-        keywords.append(QLatin1String("asm"));
-        keywords.append(QLatin1String("assembler"));
-        keywords.append(QLatin1String("automated"));
-        keywords.append(QLatin1String("begin"));
-        keywords.append(QLatin1String("case"));
-        keywords.append(QLatin1String("cdecl"));
-        keywords.append(QLatin1String("class"));
-        keywords.append(QLatin1String("const"));
-        keywords.append(QLatin1String("constructor"));
-        keywords.append(QLatin1String("contains"));
-        keywords.append(QLatin1String("default"));
-        keywords.append(QLatin1String("deprecated"));
-        keywords.append(QLatin1String("destructor"));
-        keywords.append(QLatin1String("dispid"));
-        keywords.append(QLatin1String("dispinterface"));
-        keywords.append(QLatin1String("div"));
-        keywords.append(QLatin1String("do"));
-        keywords.append(QLatin1String("downto"));
-        keywords.append(QLatin1String("dynamic"));
-        keywords.append(QLatin1String("else"));
-        keywords.append(QLatin1String("end"));
-        keywords.append(QLatin1String("except"));
-        keywords.append(QLatin1String("export"));
-        keywords.append(QLatin1String("exports"));
-        keywords.append(QLatin1String("external"));
-        keywords.append(QLatin1String("far"));
-        keywords.append(QLatin1String("file"));
-        keywords.append(QLatin1String("final"));
-        keywords.append(QLatin1String("finalization"));
-        keywords.append(QLatin1String("finally"));
-        keywords.append(QLatin1String("for"));
-        keywords.append(QLatin1String("forward"));
-        keywords.append(QLatin1String("function"));
-        keywords.append(QLatin1String("goto"));
-        keywords.append(QLatin1String("if"));
-        keywords.append(QLatin1String("implementation"));
-        keywords.append(QLatin1String("implements"));
-        keywords.append(QLatin1String("in"));
-        keywords.append(QLatin1String("index"));
-        keywords.append(QLatin1String("inherited"));
-        keywords.append(QLatin1String("initialization"));
-        keywords.append(QLatin1String("inline"));
-        keywords.append(QLatin1String("inline"));
-        keywords.append(QLatin1String("interface"));
-        keywords.append(QLatin1String("is"));
-        keywords.append(QLatin1String("label"));
-        keywords.append(QLatin1String("library"));
-        keywords.append(QLatin1String("library"));
-        keywords.append(QLatin1String("local"));
-        keywords.append(QLatin1String("message"));
-        keywords.append(QLatin1String("mod"));
-        keywords.append(QLatin1String("name"));
-        keywords.append(QLatin1String("near"));
-        keywords.append(QLatin1String("nil"));
-        keywords.append(QLatin1String("nodefault"));
-        keywords.append(QLatin1String("not"));
-        keywords.append(QLatin1String("object"));
-        keywords.append(QLatin1String("of"));
-        keywords.append(QLatin1String("or"));
-        keywords.append(QLatin1String("out"));
-        keywords.append(QLatin1String("overload"));
-        keywords.append(QLatin1String("override"));
-        keywords.append(QLatin1String("package"));
-        keywords.append(QLatin1String("packed"));
-        keywords.append(QLatin1String("pascal"));
-        keywords.append(QLatin1String("platform"));
-        keywords.append(QLatin1String("private"));
-        keywords.append(QLatin1String("procedure"));
-        keywords.append(QLatin1String("program"));
-        keywords.append(QLatin1String("property"));
-        keywords.append(QLatin1String("protected"));
-        keywords.append(QLatin1String("public"));
-        keywords.append(QLatin1String("published"));
-        keywords.append(QLatin1String("raise"));
-        keywords.append(QLatin1String("read"));
-        keywords.append(QLatin1String("readonly"));
-        keywords.append(QLatin1String("record"));
-        keywords.append(QLatin1String("register"));
-        keywords.append(QLatin1String("reintroduce"));
-        keywords.append(QLatin1String("repeat"));
-        keywords.append(QLatin1String("requires"));
-        keywords.append(QLatin1String("resident"));
-        keywords.append(QLatin1String("resourcestring"));
-        keywords.append(QLatin1String("safecall"));
-        keywords.append(QLatin1String("sealed"));
-        keywords.append(QLatin1String("set"));
-        keywords.append(QLatin1String("shl"));
-        keywords.append(QLatin1String("shr"));
-        keywords.append(QLatin1String("static"));
-        keywords.append(QLatin1String("stdcall"));
-        keywords.append(QLatin1String("stored"));
-        keywords.append(QLatin1String("string"));
-        keywords.append(QLatin1String("then"));
-        keywords.append(QLatin1String("threadvar"));
-        keywords.append(QLatin1String("to"));
-        keywords.append(QLatin1String("try"));
-        keywords.append(QLatin1String("type"));
-        keywords.append(QLatin1String("unit"));
-        keywords.append(QLatin1String("unsafe"));
-        keywords.append(QLatin1String("until"));
-        keywords.append(QLatin1String("uses"));
-        keywords.append(QLatin1String("var"));
-        keywords.append(QLatin1String("varargs"));
-        keywords.append(QLatin1String("virtual"));
-        keywords.append(QLatin1String("while"));
-        keywords.append(QLatin1String("with"));
-        keywords.append(QLatin1String("write"));
-        keywords.append(QLatin1String("writeonly"));
-        keywords.append(QLatin1String("xor"));
-    }
-
-    return keywords;
-}
-
@@ -34,12 +34,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
-    virtual bool isReservedKeyword(const QString & rPossiblyReservedKeyword);
-
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void writeOperation (UMLOperation *op, QTextStream &ada, bool is_comment = false);
@@ -24,250 +24,6 @@
 #include <QString>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "abs",
-    "accept",
-    "alarm",
-    "and",
-    "atan2",
-    "BEGIN",
-    "bind",
-    "binmode",
-    "bless",
-    "byte",
-    "caller",
-    "carp",
-    "chdir",
-    "chmod",
-    "chomp",
-    "chop",
-    "chown",
-    "chr",
-    "chroot",
-    "close",
-    "closedir",
-    "cmp",
-    "confess",
-    "connect",
-    "continue",
-    "cos",
-    "croak",
-    "crypt",
-    "dbmclose",
-    "dbmopen",
-    "defined",
-    "delete",
-    "die",
-    "do",
-    "dump",
-    "each",
-    "else",
-    "elsif",
-    "END",
-    "endgrent",
-    "endhostent",
-    "endnetent",
-    "endprotoent",
-    "endpwent",
-    "endservent",
-    "eof",
-    "eq",
-    "eval",
-    "exec",
-    "exists",
-    "exit",
-    "exp",
-    "fcntl",
-    "fileno",
-    "flock",
-    "for",
-    "foreach",
-    "fork",
-    "format",
-    "formline",
-    "ge",
-    "getc",
-    "getgrent",
-    "getgrgid",
-    "getgrnam",
-    "gethostbyaddr",
-    "gethostbyname",
-    "gethostent",
-    "getlogin",
-    "getnetbyaddr",
-    "getnetbyname",
-    "getnetent",
-    "getpeername",
-    "getpgrp",
-    "getppid",
-    "getpriority",
-    "getprotobyname",
-    "getprotobynumber",
-    "getprotoent",
-    "getpwent",
-    "getpwnam",
-    "getpwuid",
-    "getservbyname",
-    "getservbyport",
-    "getservent",
-    "getsockname",
-    "getsockopt",
-    "glob",
-    "gmtime",
-    "goto",
-    "grep",
-    "gt",
-    "hex",
-    "if",
-    "import",
-    "index",
-    "int",
-    "integer",
-    "ioctl",
-    "join",
-    "keys",
-    "kill",
-    "last",
-    "lc",
-    "lcfirst",
-    "le",
-    "length",
-    "lib",
-    "link",
-    "listen",
-    "local",
-    "localtime",
-    "lock",
-    "log",
-    "lstat",
-    "lt",
-    "map",
-    "mkdir",
-    "msgctl",
-    "msgget",
-    "msgrcv",
-    "msgsnd",
-    "my",
-    "ne",
-    "new",
-    "next",
-    "no",
-    "not",
-    "oct",
-    "open",
-    "opendir",
-    "or",
-    "ord",
-    "our",
-    "pack",
-    "package",
-    "pipe",
-    "pop",
-    "pos",
-    "print",
-    "printf",
-    "prototype",
-    "push",
-    "quotemeta",
-    "rand",
-    "read",
-    "readdir",
-    "readline",
-    "readlink",
-    "readpipe",
-    "recv",
-    "redo",
-    "ref",
-    "rename",
-    "require",
-    "reset",
-    "return",
-    "reverse",
-    "rewinddir",
-    "rindex",
-    "rmdir",
-    "scalar",
-    "seek",
-    "seekdir",
-    "select",
-    "semctl",
-    "semget",
-    "semop",
-    "send",
-    "setgrent",
-    "sethostent",
-    "setnetent",
-    "setpgrp",
-    "setpriority",
-    "setprotoent",
-    "setpwent",
-    "setservent",
-    "setsockopt",
-    "shift",
-    "shmctl",
-    "shmget",
-    "shmread",
-    "shmwrite",
-    "shutdown",
-    "sigtrap",
-    "sin",
-    "sleep",
-    "socket",
-    "socketpair",
-    "sort",
-    "splice",
-    "split",
-    "sprintf",
-    "sqrt",
-    "srand",
-    "stat",
-    "strict",
-    "study",
-    "sub",
-    "subs",
-    "substr",
-    "switch",
-    "symlink",
-    "syscall",
-    "sysopen",
-    "sysread",
-    "sysseek",
-    "system",
-    "syswrite",
-    "tell",
-    "telldir",
-    "tie",
-    "tied",
-    "time",
-    "times",
-    "truncate",
-    "uc",
-    "ucfirst",
-    "umask",
-    "undef",
-    "unless",
-    "unlink",
-    "unpack",
-    "unshift",
-    "untie",
-    "until",
-    "use",
-    "utf8",
-    "utime",
-    "values",
-    "vars",
-    "vec",
-    "wait",
-    "waitpid",
-    "wantarray",
-    "warn",
-    "warnings",
-    "while",
-    "write",
-    "xor",
-    0
-};
-
 PerlWriter::PerlWriter()
 {
 }
@@ -714,33 +470,3 @@ void PerlWriter::writeAttributes(UMLAttributeList &atList, QTextStream &perl)
     return;
 }
 
-/**
- * Get list of default datatypes.
- * @return   the list of default datatypes
- */
-QStringList PerlWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("$"));
-    l.append(QLatin1String("@"));
-    l.append(QLatin1String("%"));
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList PerlWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
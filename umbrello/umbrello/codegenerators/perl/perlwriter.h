@@ -36,10 +36,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
-    QStringList defaultDatatypes();
-
 private:
     void writeOperations(UMLClassifier *c, QTextStream &perl);
     void writeOperations(const QString &classname, UMLOperationList &opList,
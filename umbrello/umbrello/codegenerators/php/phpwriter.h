@@ -32,8 +32,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
 private:
     void writeOperations(UMLClassifier *c, QTextStream &php);
     void writeOperations(const QString& classname,
@@ -27,144 +27,6 @@
 #include <QTextCodec>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "abs",
-    "and",
-    "apply",
-    "ArithmeticError",
-    "assert",
-    "AssertionError",
-    "AttributeError",
-    "break",
-    "buffer",
-    "callable",
-    "chr",
-    "class",
-    "classmethod",
-    "cmp",
-    "coerce",
-    "compile",
-    "complex",
-    "continue",
-    "def",
-    "del",
-    "delattr",
-    "DeprecationWarning",
-    "dict",
-    "dir",
-    "divmod",
-    "elif",
-    "Ellipsis",
-    "else",
-    "EnvironmentError",
-    "EOFError",
-    "eval",
-    "except",
-    "Exception",
-    "exec",
-    "execfile",
-    "file",
-    "filter",
-    "finally",
-    "float",
-    "FloatingPointError",
-    "for",
-    "from",
-    "getattr",
-    "global",
-    "globals",
-    "hasattr",
-    "hash",
-    "hex",
-    "id",
-    "if",
-    "import",
-    "__import__",
-    "ImportError",
-    "in",
-    "IndentationError",
-    "IndexError",
-    "input",
-    "int",
-    "intern",
-    "IOError",
-    "is",
-    "isinstance",
-    "issubclass",
-    "iter",
-    "KeyboardInterrupt",
-    "KeyError",
-    "lambda",
-    "len",
-    "list",
-    "locals",
-    "long",
-    "LookupError",
-    "map",
-    "max",
-    "MemoryError",
-    "min",
-    "NameError",
-    "None",
-    "not",
-    "NotImplemented",
-    "NotImplementedError",
-    "object",
-    "oct",
-    "open",
-    "or",
-    "ord",
-    "OSError",
-    "OverflowError",
-    "OverflowWarning",
-    "pass",
-    "pow",
-    "print",
-    "property",
-    "raise",
-    "range",
-    "raw_input",
-    "reduce",
-    "ReferenceError",
-    "reload",
-    "repr",
-    "return",
-    "round",
-    "RuntimeError",
-    "RuntimeWarning",
-    "setattr",
-    "slice",
-    "StandardError",
-    "staticmethod",
-    "StopIteration",
-    "str",
-    "super",
-    "SyntaxError",
-    "SyntaxWarning",
-    "SystemError",
-    "SystemExit",
-    "TabError",
-    "try",
-    "tuple",
-    "type",
-    "TypeError",
-    "UnboundLocalError",
-    "unichr",
-    "unicode",
-    "UnicodeError",
-    "UserWarning",
-    "ValueError",
-    "vars",
-    "Warning",
-    "while",
-    "WindowsError",
-    "xrange",
-    "yield",
-    "ZeroDivisionError",
-    "zip",
-    0
-};
-
 PythonWriter::PythonWriter() : m_bNeedPass(true)
 {
 }
@@ -442,39 +304,3 @@ Uml::ProgrammingLanguage::Enum PythonWriter::language() const
     return Uml::ProgrammingLanguage::Python;
 }
 
-/**
- * Reimplementation of method from class CodeGenerator
- */
-QStringList PythonWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("array"));
-    l.append(QLatin1String("bool"));
-    l.append(QLatin1String("tuple"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("int"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("dict"));
-    l.append(QLatin1String("object"));
-    l.append(QLatin1String("set"));
-    l.append(QLatin1String("string"));
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList PythonWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
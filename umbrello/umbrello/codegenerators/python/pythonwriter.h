@@ -35,10 +35,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
-    QStringList defaultDatatypes();
-
 private:
 
     void writeAttributes(UMLAttributeList atList, QTextStream &py);
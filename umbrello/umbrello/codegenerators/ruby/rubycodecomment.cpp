@@ -12,6 +12,8 @@
 
 #include "rubycodecomment.h"
 
+#include "codeemitter.h"
+
 #include <QRegExp>
 
 RubyCodeComment::RubyCodeComment(CodeDocument * doc, const QString & text)
@@ -39,16 +41,11 @@ QString RubyCodeComment::unformatText(const QString & text, const QString & inde
     return mytext;
 }
 
-QString RubyCodeComment::toString() const
+void RubyCodeComment::write(CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if (getWriteOutText()) {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
-        output.append(formatMultiLineText(getText(), indent + QLatin1String("# "), endLine + endLine));
+        emitter.writeLines(getText(), getIndentationLevel(), QLatin1String("# "),
+                           emitter.endLine() + emitter.endLine());
     }
-
-    return output;
 }
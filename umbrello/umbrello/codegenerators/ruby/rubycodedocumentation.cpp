@@ -15,6 +15,7 @@
 
 // local includes
 #include "rubyclassifiercodedocument.h"
+#include "codeemitter.h"
 #include "rubycodegenerationpolicy.h"
 #include "uml.h"
 
@@ -38,10 +39,8 @@ void RubyCodeDocumentation::saveToXMI(QDomDocument & doc, QDomElement & root)
     root.appendChild(blockElement);
 }
 
-QString RubyCodeDocumentation::toString() const
+void RubyCodeDocumentation::write(CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if (getWriteOutText())
     {
@@ -52,21 +51,18 @@ QString RubyCodeDocumentation::toString() const
         if (p->getCommentStyle() == CodeGenerationPolicy::MultiLine)
              useHashOutput = false;
 
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
         if (useHashOutput)
         {
             if (!body.isEmpty())
-                output.append(formatMultiLineText (body, indent + QLatin1String("# "), endLine));
+                emitter.writeLines(body, level, QLatin1String("# "));
         } else {
-            output.append(QLatin1String("=begin rdoc") + endLine);
-            output.append(formatMultiLineText (body, indent + QLatin1Char(' '), endLine));
-            output.append(QLatin1String("=end") + endLine);
+            emitter.writeLine(0, QLatin1String("=begin rdoc"));
+            emitter.writeLines(body, level, QString(QLatin1Char(' ')));
+            emitter.writeLine(0, QLatin1String("=end"));
         }
     }
-
-    return output;
 }
 
 QString RubyCodeDocumentation::getNewEditorLine(int amount)
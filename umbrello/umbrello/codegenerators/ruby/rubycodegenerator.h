@@ -49,8 +49,6 @@ public:
     static QString cppToRubyType(const QString &cppType);
     static QString cppToRubyName(const QString &cppName);
 
-    virtual QStringList reservedKeywords() const;
-
 protected:
 
 //    CodeBlockWithComments * createClassDecl(UMLClassifier *c, RubyClassifierCodeDocument * doc);
@@ -423,58 +423,3 @@ Uml::ProgrammingLanguage::Enum RubyWriter::language() const
     return Uml::ProgrammingLanguage::Ruby;
 }
 
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList RubyWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords
-          << QLatin1String("__FILE__")
-          << QLatin1String("__LINE__")
-          << QLatin1String("BEGIN")
-          << QLatin1String("END")
-          << QLatin1String("alias")
-          << QLatin1String("and")
-          << QLatin1String("begin")
-          << QLatin1String("break")
-          << QLatin1String("case")
-          << QLatin1String("class")
-          << QLatin1String("def")
-          << QLatin1String("defined?")
-          << QLatin1String("do")
-          << QLatin1String("else")
-          << QLatin1String("elsif")
-          << QLatin1String("end")
-          << QLatin1String("ensure")
-          << QLatin1String("false")
-          << QLatin1String("for")
-          << QLatin1String("if")
-          << QLatin1String("in")
-          << QLatin1String("module")
-          << QLatin1String("next")
-          << QLatin1String("nil")
-          << QLatin1String("not")
-          << QLatin1String("or")
-          << QLatin1String("redo")
-          << QLatin1String("rescue")
-          << QLatin1String("retry")
-          << QLatin1String("return")
-          << QLatin1String("self")
-          << QLatin1String("super")
-          << QLatin1String("then")
-          << QLatin1String("true")
-          << QLatin1String("undef")
-          << QLatin1String("unless")
-          << QLatin1String("until")
-          << QLatin1String("when")
-          << QLatin1String("while")
-          << QLatin1String("yield");
-    }
-
-    return keywords;
-}
-
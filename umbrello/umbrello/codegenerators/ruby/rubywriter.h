@@ -35,8 +35,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     QString cppToRubyType(const QString &cppType);
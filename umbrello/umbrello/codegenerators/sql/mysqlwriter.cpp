@@ -37,49 +37,6 @@ Uml::ProgrammingLanguage::Enum MySQLWriter::language() const
     return Uml::ProgrammingLanguage::MySQL;
 }
 
-/**
- * Reimplement method from CodeGenerator.
- */
-QStringList MySQLWriter::defaultDatatypes()
-{
-    QStringList l;
-
-    l.append(QLatin1String("ascii"));
-    l.append(QLatin1String("bigint"));
-    l.append(QLatin1String("bit"));
-    l.append(QLatin1String("binary"));
-    l.append(QLatin1String("blob"));
-    l.append(QLatin1String("bool"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("charset"));
-    l.append(QLatin1String("date"));
-    l.append(QLatin1String("datetime"));
-    l.append(QLatin1String("decimal"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("enum"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("integer"));
-    l.append(QLatin1String("longblob"));
-    l.append(QLatin1String("longtext"));
-    l.append(QLatin1String("mediumblob"));
-    l.append(QLatin1String("mediumint"));
-    l.append(QLatin1String("mediumtext"));
-    l.append(QLatin1String("serial"));
-    l.append(QLatin1String("set"));
-    l.append(QLatin1String("smallint"));
-    l.append(QLatin1String("timestamp"));
-    l.append(QLatin1String("time"));
-    l.append(QLatin1String("tinyblob"));
-    l.append(QLatin1String("tinyint"));
-    l.append(QLatin1String("tinytext"));
-    l.append(QLatin1String("text"));
-    l.append(QLatin1String("unicode"));
-    l.append(QLatin1String("varbinary"));
-    l.append(QLatin1String("varchar"));
-
-    return l;
-}
-
 /**
  * Reimplemented method from SQLWriter.
  */
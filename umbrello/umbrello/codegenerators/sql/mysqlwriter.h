@@ -33,8 +33,6 @@ public:
 
     Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
     void printForeignKeyConstraints(QTextStream& sql, UMLClassifierListItemList constrList);
     void printCheckConstraints(QTextStream& sql, UMLClassifierListItemList constrList);
 
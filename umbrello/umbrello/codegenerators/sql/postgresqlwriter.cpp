@@ -34,49 +34,6 @@ Uml::ProgrammingLanguage::Enum PostgreSQLWriter::language() const
     return Uml::ProgrammingLanguage::PostgreSQL;
 }
 
-/**
- * Reimplement method from CodeGenerator.
- */
-QStringList PostgreSQLWriter::defaultDatatypes()
-{
-    QStringList l;
-
-    l.append(QLatin1String("bigint"));
-    l.append(QLatin1String("bigserial"));
-    l.append(QLatin1String("bit"));
-    l.append(QLatin1String("bit varying"));
-    l.append(QLatin1String("boolean"));
-    l.append(QLatin1String("box"));
-    l.append(QLatin1String("bytea"));
-    l.append(QLatin1String("character varying"));
-    l.append(QLatin1String("character"));
-    l.append(QLatin1String("cidr"));
-    l.append(QLatin1String("circle"));
-    l.append(QLatin1String("date"));
-    l.append(QLatin1String("decimal"));
-    l.append(QLatin1String("double precision"));
-    l.append(QLatin1String("inet"));
-    l.append(QLatin1String("integer"));
-    l.append(QLatin1String("interval"));
-    l.append(QLatin1String("line"));
-    l.append(QLatin1String("lseg"));
-    l.append(QLatin1String("macaddr"));
-    l.append(QLatin1String("money"));
-    l.append(QLatin1String("numeric"));
-    l.append(QLatin1String("path"));
-    l.append(QLatin1String("point"));
-    l.append(QLatin1String("polygon"));
-    l.append(QLatin1String("real"));
-    l.append(QLatin1String("serial"));
-    l.append(QLatin1String("smallint"));
-    l.append(QLatin1String("time without time zone"));
-    l.append(QLatin1String("time with time zone"));
-    l.append(QLatin1String("timestamp without time zone"));
-    l.append(QLatin1String("timestamp with time zone"));
-
-    return l;
-}
-
 /**
  * Reimplement printAutoIncrement statements from Base Class for PostgreSQL
  */
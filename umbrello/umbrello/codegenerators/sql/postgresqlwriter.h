@@ -29,8 +29,6 @@ public:
 
     Uml::ProgrammingLanguage::Enum language() const;
 
-    QStringList defaultDatatypes();
-
 protected:
 
     void printAutoIncrements(QTextStream& sql, UMLEntityAttributeList entAttList);
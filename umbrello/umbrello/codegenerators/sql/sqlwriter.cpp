@@ -32,147 +32,6 @@
 #include <QRegExp>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "access",
-    "add",
-    "all",
-    "alter",
-    "analyze",
-    "and",
-    "any",
-    "as",
-    "asc",
-    "audit",
-    "begin",
-    "between",
-    "boolean",
-    "by",
-    "char",
-    "character",
-    "check",
-    "cluster",
-    "column",
-    "comment",
-    "commit",
-    "compress",
-    "connect",
-    "create",
-    "current",
-    "cursor",
-    "date",
-    "decimal",
-    "default",
-    "delete",
-    "desc",
-    "distinct",
-    "drop",
-    "else",
-    "elsif",
-    "end",
-    "escape",
-    "exception",
-    "exclusive",
-    "execute",
-    "exists",
-    "explain",
-    "false",
-    "file",
-    "float",
-    "for",
-    "from",
-    "function",
-    "grant",
-    "group",
-    "having",
-    "identified",
-    "if",
-    "immediate",
-    "in",
-    "increment",
-    "index",
-    "initial",
-    "insert",
-    "integer",
-    "intersect",
-    "into",
-    "is",
-    "level",
-    "like",
-    "lock",
-    "long",
-    "loop",
-    "maxextents",
-    "minus",
-    "mlslabel",
-    "mode",
-    "modify",
-    "noaudit",
-    "nocompress",
-    "not",
-    "nowait",
-    "null",
-    "number",
-    "of",
-    "offline",
-    "on",
-    "online",
-    "option",
-    "or",
-    "order",
-    "out",
-    "pctfree",
-    "prior",
-    "privileges",
-    "procedure",
-    "public",
-    "raw",
-    "rename",
-    "resource",
-    "return",
-    "revoke",
-    "rollback",
-    "row",
-    "rowid",
-    "rowlabel",
-    "rownum",
-    "rows",
-    "savepoint",
-    "select",
-    "session",
-    "set",
-    "share",
-    "size",
-    "smallint",
-    "some",
-    "start",
-    "successful",
-    "synonym",
-    "sysdate",
-    "table",
-    "then",
-    "to",
-    "trigger",
-    "true",
-    "truncate",
-    "type",
-    "uid",
-    "union",
-    "unique",
-    "update",
-    "user",
-    "using",
-    "validate",
-    "values",
-    "varchar",
-    "varchar2",
-    "varray",
-    "view",
-    "whenever",
-    "where",
-    "with",
-    0
-};
-
 SQLWriter::SQLWriter()
     : m_pEntity(0)
 {
@@ -308,55 +167,6 @@ Uml::ProgrammingLanguage::Enum SQLWriter::language() const
     return Uml::ProgrammingLanguage::SQL;
 }
 
-/**
- * Reimplement method from CodeGenerator.
- */
-QStringList SQLWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("blob"));
-    l.append(QLatin1String("bigint"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("date"));
-    l.append(QLatin1String("datetime"));
-    l.append(QLatin1String("decimal"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("enum"));
-    l.append(QLatin1String("longblob"));
-    l.append(QLatin1String("longtext"));
-    l.append(QLatin1String("mediumblob"));
-    l.append(QLatin1String("mediumint"));
-    l.append(QLatin1String("mediumtext"));
-    l.append(QLatin1String("set"));
-    l.append(QLatin1String("smallint"));
-    l.append(QLatin1String("text"));
-    l.append(QLatin1String("time"));
-    l.append(QLatin1String("timestamp"));
-    l.append(QLatin1String("tinyblob"));
-    l.append(QLatin1String("tinyint"));
-    l.append(QLatin1String("tinytext"));
-    l.append(QLatin1String("varchar"));
-    l.append(QLatin1String("year"));
-    return l;
-}
-
-/**
- * Get list of reserved keywords.
- */
-QStringList SQLWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
 /**
  * Prints out attributes as columns in the table.
  * @param sql the stream we should print to
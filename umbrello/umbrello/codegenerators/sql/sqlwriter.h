@@ -38,10 +38,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList defaultDatatypes();
-
-    virtual QStringList reservedKeywords() const;
-
 protected:
 
     UMLEntity* m_pEntity;
@@ -30,50 +30,6 @@
 #include <QRegExp>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "body",
-    "break",
-    "case",
-    "class",
-    "common",
-    "concat",
-    "configbody",
-    "constructor",
-    "continue",
-    "default",
-    "destructor",
-    "else",
-    "elseif",
-    "for",
-    "foreach",
-    "global",
-    "if",
-    "incr",
-    "lappend",
-    "lindex",
-    "list",
-    "llength",
-    "load",
-    "lrange",
-    "lreplace",
-    "method",
-    "namespace",
-    "private",
-    "proc",
-    "protected",
-    "public",
-    "return",
-    "set",
-    "source",
-    "switch",
-    "then",
-    "upvar",
-    "variable",
-    "virtual",
-    "while",
-    0
-};
-
 /**
  * Constructor, initialises a couple of variables.
  */
@@ -925,20 +881,3 @@ QString TclWriter::getUMLObjectName(UMLObject * obj)
 {
     return (obj != 0) ? obj->name() : QLatin1String("NULL");
 }
-
-/**
- * Get list of reserved keywords.
- * @return   the list of reserved keywords
- */
-QStringList TclWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
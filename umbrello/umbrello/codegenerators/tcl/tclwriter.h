@@ -39,8 +39,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void writeHeaderFile(UMLClassifier * c, QFile & file);
@@ -14,6 +14,7 @@
 
 // local includes
 #include "codedocument.h"
+#include "codeemitter.h"
 #include "codegenerationpolicy.h"
 #include "debug_utils.h"
 #include "uml.h"
@@ -195,12 +196,7 @@ QString TextBlock::getIndentationString(int level) const
     if (!level) {
         level = m_indentationLevel;
     }
-    QString indentAmount = getIndentation();
-    QString indentation;
-    for (int i=0; i<level; ++i) {
-        indentation.append(indentAmount);
-    }
-    return indentation;
+    return getIndentation().repeated(level);
 }
 
 /**
@@ -278,6 +274,8 @@ void TextBlock::release()
 
 /**
  * Format a long text string to be more readable.
+ * Each line of the text is prefixed and ended with the line ending
+ * of the policy, see CodeEmitter::writeLines().
  * @param work               the original text for formatting
  * @param linePrefix         a line prefix
  * @param breakStr           a break string
@@ -288,29 +286,9 @@ void TextBlock::release()
 QString TextBlock::formatMultiLineText(const QString & work, const QString & linePrefix,
         const QString & breakStr, bool addBreak, bool lastLineHasBreak)
 {
-    QString output;
-    QString text = work;
-    QString endLine = getNewLineEndingChars();
-    int matches = text.indexOf(QRegExp(breakStr));
-    if (matches >= 0) {
-        // check that last part of string matches, if not, then
-        // we have to tack on extra match
-        if (!text.contains(QRegExp(breakStr + QLatin1String("\\$"))))
-            matches++;
-
-        for (int i=0; i < matches; ++i) {
-            QString line = text.section(QRegExp(breakStr), i, i);
-            output += linePrefix + line;
-            if ((i != matches-1) || lastLineHasBreak)
-                output += endLine; // add break to line
-        }
-    } else {
-        output = linePrefix + text;
-        if (addBreak)
-            output += breakStr;
-    }
-
-    return output;
+    StringCodeEmitter emitter;
+    emitter.writeLines(work, 0, linePrefix, breakStr, addBreak, lastLineHasBreak);
+    return emitter.text();
 }
 
 /**
@@ -400,22 +378,30 @@ QString TextBlock::decodeText(const QString & text, const QString & endLine)
 }
 
 /**
- * Return the text in the right format. Returned string is empty
+ * Write the text in the right format. Nothing is written
  * if m_writeOutText is false.
- * @return  QString
+ * @param emitter   the emitter receiving the text
  */
-QString TextBlock::toString() const
+void TextBlock::write(CodeEmitter & emitter) const
 {
     // simple output method
     if (m_writeOutText && !m_text.isEmpty()) {
-        QString endLine = UMLApp::app()->commonPolicy()->getNewLineEndingChars();
-        return formatMultiLineText(m_text, getIndentationString(), endLine);
-    }
-    else {
-        return QString();
+        emitter.writeLines(m_text, m_indentationLevel);
     }
 }
 
+/**
+ * Return the text in the right format. Returned string is empty
+ * if m_writeOutText is false.
+ * @return  QString
+ */
+QString TextBlock::toString() const
+{
+    StringCodeEmitter emitter;
+    write(emitter);
+    return emitter.text();
+}
+
 /**
  * Operator '<<' for TextBlock.
  */
@@ -17,6 +17,7 @@
 #include <QObject>
 
 class CodeDocument;
+class CodeEmitter;
 
 /**
  * The fundemental unit of text within an output file containing code.
@@ -57,7 +58,8 @@ public:
 
     virtual QString unformatText(const QString & text, const QString & indent = QString());
 
-    virtual QString toString() const;
+    virtual void write(CodeEmitter & emitter) const;
+    QString toString() const;
 
     static QString encodeText(const QString & text, const QString & endLine);
     static QString decodeText(const QString & text, const QString & endLine);
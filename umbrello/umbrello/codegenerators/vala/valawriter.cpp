@@ -26,85 +26,6 @@
 #include <QRegExp>
 #include <QTextStream>
 
-static const char *reserved_words[] = {
-    "abstract",
-    "as",
-    "base",
-    "bool",
-    "break",
-    "byte",
-    "case",
-    "catch",
-    "char",
-    "checked",
-    "class",
-    "const",
-    "continue",
-    "decimal",
-    "default",
-    "delegate",
-    "do",
-    "double",
-    "else",
-    "enum",
-    "event",
-    "explicit",
-    "extern",
-    "false",
-    "finally",
-    "for",
-    "foreach",
-    "goto",
-    "if",
-    "implicit",
-    "in",
-    "int",
-    "interface",
-    "internal",
-    "is",
-    "lock",
-    "long",
-    "namespace",
-    "new",
-    "null",
-    "object",
-    "operator",
-    "out",
-    "override",
-    "params",
-    "private",
-    "protected",
-    "public",
-    "readonly",
-    "ref",
-    "return",
-    "sbyte",
-    "sealed",
-    "short",
-    "sizeof",
-    "stackalloc",
-    "static",
-    "string",
-    "struct",
-    "switch",
-    "this",
-    "throw",
-    "true",
-    "try",
-    "typeof",
-    "uint",
-    "ulong",
-    "unchecked",
-    "unsafe",
-    "ushort",
-    "using",
-    "virtual",
-    "void",
-    "volatile",
-    "while",
-    0
-};
-
 /**
  * Constructor.
  */
@@ -121,62 +42,6 @@ ValaWriter::~ValaWriter()
 {
 }
 
-/**
- * Get list of predefined data types.
- * @return  the list of default data types
- */
-QStringList ValaWriter::defaultDatatypes()
-{
-    QStringList l;
-    l.append(QLatin1String("bool"));
-    l.append(QLatin1String("char"));
-    l.append(QLatin1String("uchar"));
-    l.append(QLatin1String("unichar"));
-    l.append(QLatin1String("int"));
-    l.append(QLatin1String("int8"));
-    l.append(QLatin1String("int16"));
-    l.append(QLatin1String("int32"));
-    l.append(QLatin1String("int64"));
-    l.append(QLatin1String("uint"));
-    l.append(QLatin1String("uint8"));
-    l.append(QLatin1String("uint16"));
-    l.append(QLatin1String("uint32"));
-    l.append(QLatin1String("uint64"));
-    l.append(QLatin1String("long"));
-    l.append(QLatin1String("ulong"));
-    l.append(QLatin1String("short"));
-    l.append(QLatin1String("ushort"));
-    l.append(QLatin1String("float"));
-    l.append(QLatin1String("double"));
-    l.append(QLatin1String("struct"));
-    l.append(QLatin1String("enum"));
-    l.append(QLatin1String("string"));
-    l.append(QLatin1String("bool[]"));
-    l.append(QLatin1String("char[]"));
-    l.append(QLatin1String("uchar[]"));
-    l.append(QLatin1String("unichar[]"));
-    l.append(QLatin1String("int[]"));
-    l.append(QLatin1String("int8[]"));
-    l.append(QLatin1String("int16[]"));
-    l.append(QLatin1String("int32[]"));
-    l.append(QLatin1String("int64[]"));
-    l.append(QLatin1String("uint[]"));
-    l.append(QLatin1String("uint8[]"));
-    l.append(QLatin1String("uint16[]"));
-    l.append(QLatin1String("uint32[]"));
-    l.append(QLatin1String("uint64[]"));
-    l.append(QLatin1String("long[]"));
-    l.append(QLatin1String("ulong[]"));
-    l.append(QLatin1String("short[]"));
-    l.append(QLatin1String("ushort[]"));
-    l.append(QLatin1String("float[]"));
-    l.append(QLatin1String("double[]"));
-    l.append(QLatin1String("struct[]"));
-    l.append(QLatin1String("enum[]"));
-    l.append(QLatin1String("string[]"));
-    return l;
-}
-
 /**
  * Call this method to generate Vala code for a UMLClassifier
  * @param c the class you want to generate code for.
@@ -842,20 +707,3 @@ Uml::ProgrammingLanguage::Enum ValaWriter::language() const
     return Uml::ProgrammingLanguage::Vala;
 }
 
-/**
- * Get list of reserved keywords.
- * @return list of reserved keywords
- */
-QStringList ValaWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        for (int i = 0; reserved_words[i]; ++i) {
-            keywords.append(QLatin1String(reserved_words[i]));
-        }
-    }
-
-    return keywords;
-}
-
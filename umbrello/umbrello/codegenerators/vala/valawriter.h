@@ -36,10 +36,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
-    QStringList defaultDatatypes();
-
 private:
 
     /// Adds extra indenting if the class is in a container (namespace).
@@ -11,6 +11,8 @@
 
 #include "xmlcodecomment.h"
 
+#include "codeemitter.h"
+
 XMLCodeComment::XMLCodeComment (CodeDocument * doc, const QString & text)
   : CodeComment (doc, text)
 {
@@ -20,22 +22,18 @@ XMLCodeComment::~XMLCodeComment ()
 {
 }
 
-QString XMLCodeComment::toString () const
+void XMLCodeComment::write (CodeEmitter & emitter) const
 {
-    QString output;
-
     // simple output method
     if (getWriteOutText())
     {
-        QString indent = getIndentationString();
-        QString endLine = getNewLineEndingChars();
+        const int level = getIndentationLevel();
         QString body = getText();
-        output.append(indent + QLatin1String("<!-- "));
+        emitter.write(emitter.indentation(level));
+        emitter.write(QLatin1String("<!-- "));
         if (!body.isEmpty()) {
-            output.append(formatMultiLineText (body, indent, endLine));
+            emitter.writeLines(body, level);
         }
-        output.append(indent + QLatin1String("-->") + endLine);
+        emitter.writeLine(level, QLatin1String("-->"));
     }
-
-    return output;
 }
@@ -37,9 +37,9 @@ public:
     virtual ~XMLCodeComment();
 
     /**
-     * @return  QString
+     * @param emitter   the emitter receiving the text
      */
-    QString toString () const;
+    void write (CodeEmitter & emitter) const;
 
 protected:
 
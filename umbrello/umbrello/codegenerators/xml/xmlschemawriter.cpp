@@ -844,33 +844,3 @@ QString XMLSchemaWriter::makeSchemaTag (QString tagName)
     return tagName;
 }
 
-/**
- * Get list of reserved keywords.
- */
-QStringList XMLSchemaWriter::reservedKeywords() const
-{
-    static QStringList keywords;
-
-    if (keywords.isEmpty()) {
-        keywords
-          << QLatin1String("ATTLIST")
-          << QLatin1String("CDATA")
-          << QLatin1String("DOCTYPE")
-          << QLatin1String("ELEMENT")
-          << QLatin1String("ENTITIES")
-          << QLatin1String("ENTITY")
-          << QLatin1String("ID")
-          << QLatin1String("IDREF")
-          << QLatin1String("IDREFS")
-          << QLatin1String("NMTOKEN")
-          << QLatin1String("NMTOKENS")
-          << QLatin1String("NOTATION")
-          << QLatin1String("PUBLIC")
-          << QLatin1String("SHORTREF")
-          << QLatin1String("SYSTEM")
-          << QLatin1String("USEMAP");
-    }
-
-    return keywords;
-}
-
@@ -46,8 +46,6 @@ public:
 
     virtual Uml::ProgrammingLanguage::Enum language() const;
 
-    virtual QStringList reservedKeywords() const;
-
 private:
 
     void writeClassifier(UMLClassifier *c, QTextStream &XMLSchema);
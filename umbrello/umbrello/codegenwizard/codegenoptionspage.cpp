@@ -57,6 +57,8 @@ CodeGenOptionsPage::CodeGenOptionsPage(QWidget *parent)
     ui_includeHeadings->setChecked(m_parentPolicy->getIncludeHeadings());
     ui_headingsDir->setText(m_parentPolicy->getHeadingFileDir());
     overwriteToWidget(m_parentPolicy->getOverwritePolicy())->setChecked(true);
+    ui_parallelGeneration->setChecked(m_parentPolicy->getParallelGeneration());
+    ui_incrementalGeneration->setChecked(m_parentPolicy->getIncrementalGeneration());
 
     ui_SelectEndLineCharsBox->setCurrentIndex(newLineToInteger(m_parentPolicy->getLineEndingType()));
     ui_SelectIndentationTypeBox->setCurrentIndex(indentTypeToInteger(m_parentPolicy->getIndentationType()));
@@ -224,6 +226,8 @@ void CodeGenOptionsPage::apply()
         m_parentPolicy->setIncludeHeadings(ui_includeHeadings->isChecked());
         m_parentPolicy->setHeadingFileDir(ui_headingsDir->text());
         m_parentPolicy->setOverwritePolicy(widgetToOverwrite());
+        m_parentPolicy->setParallelGeneration(ui_parallelGeneration->isChecked());
+        m_parentPolicy->setIncrementalGeneration(ui_incrementalGeneration->isChecked());
         m_parentPolicy->setLineEndingType((CodeGenerationPolicy::NewLineType) ui_SelectEndLineCharsBox->currentIndex());
         m_parentPolicy->setIndentationType((CodeGenerationPolicy::IndentationType) ui_SelectIndentationTypeBox->currentIndex());
         m_parentPolicy->setIndentationAmount(ui_SelectIndentationNumber->value());
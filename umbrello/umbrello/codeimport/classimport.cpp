@@ -24,6 +24,7 @@
 #include "cppimport.h"
 #include "csharpimport.h"
 #include "codeimpthread.h"
+#include "optionstate.h"
 
 // kde includes
 #include <KLocalizedString>
@@ -69,15 +70,34 @@ void ClassImport::initPerFile()
 
 /**
  * Import files.
+ * The files are imported in parallel if enabled in the code import
+ * settings and supported by the importer.
  * @param fileNames  List of files to import.
  */
 bool ClassImport::importFiles(const QStringList& fileNames)
 {
     initialize();
+    UMLDoc *umldoc = UMLApp::app()->document();
+    umldoc->setLoading(true);
+    bool result;
+    if (Settings::optionState().codeImportState.parallelImport && fileNames.size() > 1)
+        result = importFilesInParallel(fileNames);
+    else
+        result = importFilesSerially(fileNames);
+    umldoc->setLoading(false);
+    umldoc->writeToStatusBar(result ? i18nc("ready to status bar", "Ready.") : i18nc("failed to status bar", "Failed."));
+    return result;
+}
+
+/**
+ * Import the files one after another.
+ * @param fileNames  List of files to import.
+ */
+bool ClassImport::importFilesSerially(const QStringList& fileNames)
+{
     UMLDoc *umldoc = UMLApp::app()->document();
     uint processedFilesCount = 0;
     bool result = true;
-    umldoc->setLoading(true);
     foreach (const QString& fileName, fileNames) {
         umldoc->writeToStatusBar(i18n("Importing file: %1 Progress: %2/%3",
                                  fileName, processedFilesCount, fileNames.size()));
@@ -85,11 +105,23 @@ bool ClassImport::importFiles(const QStringList& fileNames)
             result = false;
         processedFilesCount++;
     }
-    umldoc->setLoading(false);
-    umldoc->writeToStatusBar(result ? i18nc("ready to status bar", "Ready.") : i18nc("failed to status bar", "Failed."));
     return result;
 }
 
+/**
+ * Import the files in parallel.
+ * Importers which are able to parse files in worker threads reimplement
+ * this method, the default implementation imports the files one after
+ * another.
+ * The model must be fed in the order of @p fileNames in the calling
+ * thread, so that the result is the same as with importFilesSerially().
+ * @param fileNames  List of files to import.
+ */
+bool ClassImport::importFilesInParallel(const QStringList& fileNames)
+{
+    return importFilesSerially(fileNames);
+}
+
 /**
  * Import a single file.
  * @param fileName  The file to import.
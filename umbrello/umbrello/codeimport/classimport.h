@@ -60,6 +60,9 @@ protected:
      */
     virtual bool parseFile(const QString& fileName) = 0;
 
+    bool importFilesSerially(const QStringList& fileNames);
+    virtual bool importFilesInParallel(const QStringList& fileNames);
+
     void log(const QString& file, const QString& text);
     void log(const QString& text);
 
@@ -13,12 +13,14 @@
 
 #include "lexer.h"
 #include "driver.h"
+#include "parsecache.h"
 #include "kdevcppparser/cpptree2uml.h"
 
 // app includes
 #include "debug_utils.h"
 #include "import_utils.h"
 #include "uml.h"
+#include "umldoc.h"
 #include "umlobject.h"
 #include "package.h"
 #include "enum.h"
@@ -29,13 +31,30 @@
 #include "association.h"
 #include "optionstate.h"
 
+// kde includes
+#include <KLocalizedString>
+#if QT_VERSION < 0x050000
+#include <kglobal.h>
+#include <kstandarddirs.h>
+#endif
+
 // qt includes
+#include <QHash>
 #include <QListWidget>
 #include <QMap>
+#include <QMutex>
+#include <QRunnable>
+#if QT_VERSION >= 0x050000
+#include <QStandardPaths>
+#endif
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
 
 // static members
 CppDriver * CppImport::ms_driver;
-QStringList CppImport::ms_seenFiles;
+ParseCache * CppImport::ms_parseCache = 0;
+QSet<QString> CppImport::ms_seenFiles;
 
 class CppDriver : public Driver
 {
@@ -47,6 +66,151 @@ public:
     }
 };
 
+/**
+ * The result of parsing a translation unit: the problems found, and the
+ * dependences and syntax trees of the file and of the files it includes.
+ * It does not refer to the driver which parsed the file, so that the
+ * driver can parse the next file in another thread while the result is
+ * fed to the model.
+ */
+class CppParseResult
+{
+public:
+    explicit CppParseResult(const QString& file = QString())
+      : fileName(file), success(false), done(false), cacheHits(0), cacheMisses(0)
+    {
+    }
+
+    /**
+     * Take the results for fileName and the files it depends on from
+     * the driver which parsed it.
+     */
+    void collect(const Driver& driver)
+    {
+        problems = driver.problems(fileName);
+        cacheHits = driver.parseCacheHits();
+        cacheMisses = driver.parseCacheMisses();
+        collect(driver, fileName);
+    }
+
+    QMap<QString, Dependence> dependences(const QString& file) const
+    {
+        return m_dependences.value(file);
+    }
+
+    ParsedFilePointer translationUnit(const QString& file) const
+    {
+        return m_units.value(file);
+    }
+
+    void clear()
+    {
+        problems.clear();
+        m_dependences.clear();
+        m_units.clear();
+    }
+
+    QString fileName;
+    bool success;
+    bool done;   ///< set by the worker thread when the file is parsed
+    QList<Problem> problems;
+    int cacheHits;     ///< include files taken from the parse cache
+    int cacheMisses;   ///< include files not found in the parse cache
+
+private:
+    void collect(const Driver& driver, const QString& file)
+    {
+        if (m_dependences.contains(file))
+            return;
+        QMap<QString, Dependence> deps = driver.dependences(file);
+        m_dependences.insert(file, deps);
+        ParsedFilePointer ast = driver.translationUnit(file);
+        if (ast)
+            m_units.insert(file, ast);
+        QMap<QString, Dependence>::ConstIterator it;
+        for (it = deps.constBegin(); it != deps.constEnd(); ++it) {
+            if (it.value().second == Dep_Global || it.key().isEmpty())
+                continue;
+            collect(driver, it.key());
+        }
+    }
+
+    QHash<QString, QMap<QString, Dependence> > m_dependences;
+    QHash<QString, ParsedFilePointer> m_units;
+};
+
+/**
+ * The drivers used by the worker threads of a parallel import.
+ * A driver keeps its state, e.g. the lexer cache, from one file to the
+ * next, but it is used by one thread at a time only.
+ */
+class CppParserPool
+{
+public:
+    explicit CppParserPool(const QList<CppDriver*>& drivers)
+      : m_drivers(drivers),
+        m_freeDrivers(drivers)
+    {
+    }
+
+    ~CppParserPool()
+    {
+        qDeleteAll(m_drivers);
+    }
+
+    CppDriver* acquireDriver()
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_freeDrivers.takeLast();
+    }
+
+    void releaseDriver(CppDriver* driver, CppParseResult* parsed)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_freeDrivers.append(driver);
+        parsed->done = true;
+        m_parsed.wakeAll();
+    }
+
+    void waitFor(CppParseResult* parsed)
+    {
+        QMutexLocker locker(&m_mutex);
+        while (!parsed->done)
+            m_parsed.wait(&m_mutex);
+    }
+
+private:
+    QList<CppDriver*> m_drivers;
+    QList<CppDriver*> m_freeDrivers;
+    QMutex m_mutex;
+    QWaitCondition m_parsed;
+};
+
+/**
+ * Lex, preprocess and parse one translation unit in a worker thread.
+ */
+class CppParseTask : public QRunnable
+{
+public:
+    CppParseTask(CppParseResult* parsed, CppParserPool* pool)
+      : m_parsed(parsed),
+        m_pool(pool)
+    {
+    }
+
+    void run()
+    {
+        CppDriver* driver = m_pool->acquireDriver();
+        m_parsed->success = driver->parseFile(m_parsed->fileName);
+        m_parsed->collect(*driver);
+        m_pool->releaseDriver(driver, m_parsed);
+    }
+
+private:
+    CppParseResult* m_parsed;
+    CppParserPool* m_pool;
+};
+
 /**
  * Constructor.
  */
@@ -69,13 +233,14 @@ CppImport::~CppImport()
  * includes.  It is important that includefiles are fed to the model
  * in proper order so that references between UML objects are created
  * properly.
+ * @param parsed     the parse results of the imported translation unit
  * @param fileName   the file to import
  */
-void CppImport::feedTheModel(const QString& fileName)
+void CppImport::feedTheModel(const CppParseResult& parsed, const QString& fileName)
 {
-    if (ms_seenFiles.indexOf(fileName) != -1)
+    if (ms_seenFiles.contains(fileName))
         return;
-    QMap<QString, Dependence> deps = ms_driver->dependences(fileName);
+    QMap<QString, Dependence> deps = parsed.dependences(fileName);
     if (! deps.empty()) {
         QMap<QString, Dependence>::Iterator it;
         for (it = deps.begin(); it != deps.end(); ++it) {
@@ -87,44 +252,70 @@ void CppImport::feedTheModel(const QString& fileName)
                 continue;
             }
             uDebug() << fileName << ": " << includeFile << " => " << it.value().first;
-            if (ms_seenFiles.indexOf(includeFile) == -1)
-                ms_seenFiles.append(includeFile);
-            feedTheModel(includeFile);
+            ms_seenFiles.insert(includeFile);
+            feedTheModel(parsed, includeFile);
         }
     }
-    ParsedFilePointer ast = ms_driver->translationUnit(fileName);
+    ParsedFilePointer ast = parsed.translationUnit(fileName);
     if (!ast) {
         uError() << fileName << " not found in list of parsed files";
         return;
     }
-    ms_seenFiles.append(fileName);
+    ms_seenFiles.insert(fileName);
     CppTree2Uml modelFeeder(fileName, m_thread);
     modelFeeder.parseTranslationUnit(*ast);
 }
 
 /**
- * Implement abstract operation from ClassImport for C++.
+ * Set up a driver for parsing the imported files.
+ * @param driver   the driver to set up
  */
-void CppImport::initialize()
+void CppImport::setupDriver(CppDriver* driver)
 {
-    // Reset the driver
-    ms_driver->reset();
-    ms_driver->setResolveDependencesEnabled(Settings::optionState().codeImportState.resolveDependencies);
+    driver->setResolveDependencesEnabled(Settings::optionState().codeImportState.resolveDependencies);
+    driver->setParseCache(Settings::optionState().codeImportState.parseCache ? parseCache() : 0);
     // FIXME: port to win32
     // Add some standard include paths
-    ms_driver->addIncludePath(QLatin1String("/usr/include"));
-    ms_driver->addIncludePath(QLatin1String("/usr/include/c++"));
-    ms_driver->addIncludePath(QLatin1String("/usr/include/g++"));
-    ms_driver->addIncludePath(QLatin1String("/usr/local/include"));
+    driver->addIncludePath(QLatin1String("/usr/include"));
+    driver->addIncludePath(QLatin1String("/usr/include/c++"));
+    driver->addIncludePath(QLatin1String("/usr/include/g++"));
+    driver->addIncludePath(QLatin1String("/usr/local/include"));
     const QStringList incPathList = Import_Utils::includePathList();
     if (incPathList.count()) {
         QStringList::ConstIterator end(incPathList.end());
         for (QStringList::ConstIterator i(incPathList.begin()); i != end; ++i) {
-            ms_driver->addIncludePath(*i);
+            driver->addIncludePath(*i);
         }
     }
 }
 
+/**
+ * Return the cache of parsed global include files, which is kept in the
+ * cache directory of the application between imports.
+ */
+ParseCache* CppImport::parseCache()
+{
+    if (!ms_parseCache) {
+#if QT_VERSION >= 0x050000
+        QString directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/cppparser");
+#else
+        QString directory = KGlobal::dirs()->saveLocation("cache", QLatin1String("umbrello/cppparser/"));
+#endif
+        ms_parseCache = new ParseCache(directory);
+    }
+    return ms_parseCache;
+}
+
+/**
+ * Implement abstract operation from ClassImport for C++.
+ */
+void CppImport::initialize()
+{
+    // Reset the driver
+    ms_driver->reset();
+    setupDriver(ms_driver);
+}
+
 /**
  * Reimplement method from ClassImport
  */
@@ -134,15 +325,13 @@ void CppImport::initPerFile()
 }
 
 /**
- * Import a single file.
- * @param fileName  The file to import.
+ * Write the problems found while parsing a file and the use of the
+ * parse cache to the log window.
+ * @param parsed   the parse results of the file
  */
-bool CppImport::parseFile(const QString& fileName) 
+void CppImport::logParseResult(const CppParseResult& parsed)
 {
-    if (ms_seenFiles.indexOf(fileName) != -1)
-        return true;
-    bool result = ms_driver->parseFile(fileName);
-    foreach(const Problem &problem, ms_driver->problems(fileName)) {
+    foreach(const Problem &problem, parsed.problems) {
         QString level;
         if (problem.level() == Problem::Level_Error)
             level = QLatin1String("error");
@@ -158,8 +347,74 @@ bool CppImport::parseFile(const QString& fileName)
                 .arg(problem.column()).arg(level).arg(problem.text());
         UMLApp::app()->logWindow()->addItem(item);
     }
-    if (!result)
+    if (parsed.cacheHits > 0 || parsed.cacheMisses > 0) {
+        QString item = i18n("%1: parse cache: %2 hits, %3 misses",
+                            parsed.fileName, parsed.cacheHits, parsed.cacheMisses);
+        UMLApp::app()->logWindow()->addItem(item);
+    }
+}
+
+/**
+ * Import a single file.
+ * @param fileName  The file to import.
+ */
+bool CppImport::parseFile(const QString& fileName)
+{
+    if (ms_seenFiles.contains(fileName))
+        return true;
+    CppParseResult parsed(fileName);
+    parsed.success = ms_driver->parseFile(fileName);
+    parsed.collect(*ms_driver);
+    logParseResult(parsed);
+    if (!parsed.success)
         return false;
-    feedTheModel(fileName);
+    feedTheModel(parsed, fileName);
     return true;
 }
+
+/**
+ * Import the files in parallel.
+ * Lexing, preprocessing and parsing of the translation units is done by
+ * a pool of threads, each with a driver of its own. The model is fed
+ * with the results in this thread, in the order of @p fileNames, while
+ * the following files are still being parsed.
+ * @param fileNames  List of files to import.
+ */
+bool CppImport::importFilesInParallel(const QStringList& fileNames)
+{
+    QThreadPool threadPool;
+    QList<CppDriver*> drivers;
+    for (int i = 0; i < threadPool.maxThreadCount(); ++i) {
+        CppDriver *driver = new CppDriver();
+        setupDriver(driver);
+        drivers.append(driver);
+    }
+    CppParserPool pool(drivers);
+
+    QVector<CppParseResult> results(fileNames.size());
+    for (int i = 0; i < fileNames.size(); ++i) {
+        results[i].fileName = fileNames.at(i);
+    }
+    for (int i = 0; i < results.size(); ++i) {
+        threadPool.start(new CppParseTask(&results[i], &pool));
+    }
+
+    UMLDoc *umldoc = UMLApp::app()->document();
+    bool result = true;
+    for (int i = 0; i < results.size(); ++i) {
+        CppParseResult& parsed = results[i];
+        umldoc->writeToStatusBar(i18n("Importing file: %1 Progress: %2/%3",
+                                 parsed.fileName, i, results.size()));
+        pool.waitFor(&parsed);
+        initPerFile();
+        logParseResult(parsed);
+        if (parsed.success)
+            feedTheModel(parsed, parsed.fileName);
+        else
+            result = false;
+        // release the syntax trees of the file
+        parsed.clear();
+    }
+    threadPool.waitForDone();
+    return result;
+}
@@ -13,9 +13,12 @@
 
 #include "classimport.h"
 
+#include <QSet>
 #include <QString>
 
 class CppDriver;
+class CppParseResult;
+class ParseCache;
 
 /**
  * C++ code import
@@ -36,12 +39,20 @@ protected:
 
     bool parseFile(const QString& fileName);
 
+    bool importFilesInParallel(const QStringList& fileNames);
+
 private:
 
-    void feedTheModel(const QString& fileName);
+    void logParseResult(const CppParseResult& parsed);
+
+    void feedTheModel(const CppParseResult& parsed, const QString& fileName);
+
+    static void setupDriver(CppDriver* driver);
+    static ParseCache* parseCache();
 
     static CppDriver * ms_driver;
-    static QStringList ms_seenFiles;  ///< auxiliary buffer for feedTheModel()
+    static ParseCache * ms_parseCache;  ///< created when first used
+    static QSet<QString> ms_seenFiles;  ///< auxiliary buffer for feedTheModel()
 
 };
 
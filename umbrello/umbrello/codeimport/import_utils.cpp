@@ -18,6 +18,7 @@
 #include "classifier.h"
 #include "debug_utils.h"
 #include "folder.h"
+#include "keywordtable.h"
 #include "enum.h"
 #include "enumliteral.h"
 #include "messagewidget.h"
@@ -623,11 +624,20 @@ void addIncludePath(const QString& path)
 }
 
 /**
- * Returns true if a type is an actual Datatype
+ * Returns true if a type is an actual Datatype.
+ * Default datatypes of the active language are looked up in the
+ * datatype folder first, before the whole model is searched.
  */
 bool isDatatype(const QString& name, UMLPackage *parentPkg)
 {
     UMLDoc *umldoc = UMLApp::app()->document();
+    const Uml::ProgrammingLanguage::Enum language = UMLApp::app()->activeLanguage();
+    if (Uml::ProgrammingLanguage::defaultDatatypes(language).contains(name)) {
+        UMLFolder *datatypes = umldoc->datatypeFolder();
+        if (Model_Utils::findUMLObject(datatypes->containedObjects(), name,
+                                       UMLObject::ot_Datatype, datatypes) != NULL)
+            return true;
+    }
     UMLObject * o = umldoc->findUMLObject(name, UMLObject::ot_Datatype, parentPkg);
     return (o!=NULL);
 }
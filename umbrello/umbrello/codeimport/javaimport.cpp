@@ -92,22 +92,23 @@ QString JavaImport::joinTypename(const QString& typeName)
  */
 void JavaImport::fillSource(const QString& word)
 {
-    QString lexeme;
-    const uint len = word.length();
-    for (uint i = 0; i < len; ++i) {
+    int start = -1;  // start of the current lexeme, -1 if there is none
+    const int len = word.length();
+    for (int i = 0; i < len; ++i) {
         const QChar& c = word[i];
         if (c.isLetterOrNumber() || c == QLatin1Char('_') || c == QLatin1Char('.')) {
-            lexeme += c;
+            if (start == -1)
+                start = i;
         } else {
-            if (!lexeme.isEmpty()) {
-                m_source.append(lexeme);
-                lexeme.clear();
+            if (start != -1) {
+                m_source.append(word.mid(start, i - start));
+                start = -1;
             }
             m_source.append(QString(c));
         }
     }
-    if (!lexeme.isEmpty())
-        m_source.append(lexeme);
+    if (start != -1)
+        m_source.append(word.mid(start));
 }
 
 /**
@@ -22,7 +22,7 @@
 // qt includes
 #include <QFile>
 #include <QRegExp>
-#include <QTextStream>
+#include <QTextCodec>
 
 QStringList NativeImportBase::m_parsedFiles;  // static, see nativeimportbase.h
 
@@ -313,45 +313,88 @@ bool NativeImportBase::preprocess(QString& line)
 QStringList NativeImportBase::split(const QString& line)
 {
     QStringList list;
-    QString listElement;
+    int start = -1;         // start of the current element, -1 if there is none
     QChar stringIntro = 0;  // buffers the string introducer character
     bool seenSpace = false;
-    QString ln = line.trimmed();
-    for (int i = 0; i < ln.length(); ++i) {
+    const QString ln = line.trimmed();
+    const int len = ln.length();
+    for (int i = 0; i < len; ++i) {
         const QChar& c = ln[i];
         if (stringIntro.toLatin1()) {        // we are in a string
-            listElement += c;
             if (c == stringIntro) {
                 if (ln[i - 1] != QLatin1Char('\\')) {
-                    list.append(listElement);
-                    listElement.clear();
+                    list.append(ln.mid(start, i + 1 - start));
+                    start = -1;
                     stringIntro = 0;  // we are no longer in a string
                 }
             }
         } else if (c == QLatin1Char('"') || c == QLatin1Char('\'')) {
-            if (!listElement.isEmpty()) {
-                list.append(listElement);
+            if (start != -1) {
+                list.append(ln.mid(start, i - start));
             }
-            listElement = stringIntro = c;
+            start = i;
+            stringIntro = c;
             seenSpace = false;
         } else if (c == QLatin1Char(' ') || c == QLatin1Char('\t')) {
             if (seenSpace)
                 continue;
             seenSpace = true;
-            if (!listElement.isEmpty()) {
-                list.append(listElement);
-                listElement.clear();
+            if (start != -1) {
+                list.append(ln.mid(start, i - start));
+                start = -1;
             }
         } else {
-            listElement += c;
+            if (start == -1)
+                start = i;
             seenSpace = false;
         }
     }
-    if (!listElement.isEmpty())
-        list.append(listElement);
+    if (start != -1)
+        list.append(ln.mid(start));
     return list;
 }
 
+/**
+ * Return true if the line consists of white space only.
+ * @param line   the line to check
+ */
+bool NativeImportBase::isBlank(const QString& line)
+{
+    const int len = line.length();
+    for (int i = 0; i < len; ++i) {
+        if (!line[i].isSpace())
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Read the complete contents of an opened file.
+ * The file is mapped into memory if possible and decoded in one go,
+ * which avoids the buffering and per line allocations of QTextStream.
+ * As with QTextStream, a byte order mark selects the UTF encoding,
+ * otherwise the locale encoding is used.
+ * @param file   the opened file
+ * @return the decoded contents of the file
+ */
+QString NativeImportBase::readText(QFile& file)
+{
+    const qint64 size = file.size();
+    if (size <= 0)
+        return QString();
+    QTextCodec *codec = QTextCodec::codecForLocale();
+    uchar *data = file.map(0, size);
+    if (data) {
+        const char *chars = reinterpret_cast<const char*>(data);
+        const QByteArray bytes = QByteArray::fromRawData(chars, size);
+        const QString text = QTextCodec::codecForUtfText(bytes, codec)->toUnicode(chars, size);
+        file.unmap(data);
+        return text;
+    }
+    const QByteArray bytes = file.readAll();
+    return QTextCodec::codecForUtfText(bytes, codec)->toUnicode(bytes);
+}
+
 /**
  * Scan a single line.
  * parseFile() calls this for each line read from the input file.
@@ -374,7 +417,7 @@ void NativeImportBase::scan(const QString& line)
             return;
         ln = ln.left(pos);
     }
-    if (ln.contains(QRegExp(QLatin1String("^\\s*$"))))
+    if (isBlank(ln))
         return;
     const QStringList words = split(ln);
     for (QStringList::ConstIterator it = words.begin(); it != words.end(); ++it) {
@@ -453,16 +496,24 @@ bool NativeImportBase::parseFile(const QString& filename)
     m_source.clear();
     m_srcIndex = 0;
     initVars();
-    QTextStream stream(&file);
+    const qint64 fileSize = file.size();
+    const QString text = readText(file);
+    file.close();
     int lineCount = 0;
-    while (! stream.atEnd()) {
-        QString line = stream.readLine();
+    const int textLength = text.length();
+    for (int start = 0; start < textLength; ) {
+        int end = text.indexOf(QLatin1Char('\n'), start);
+        if (end == -1)
+            end = textLength;
+        int len = end - start;
+        if (len > 0 && text[end - 1] == QLatin1Char('\r'))
+            --len;
         lineCount++;
-        scan(line);
+        scan(text.mid(start, len));
+        start = end + 1;
     }
-    log(nameWithoutPath, QLatin1String("file size: ") + QString::number(file.size()) +
+    log(nameWithoutPath, QLatin1String("file size: ") + QString::number(fileSize) +
                          QLatin1String(" / lines: ") + QString::number(lineCount));
-    file.close();
     // Parse the QStringList m_source.
     m_klass = NULL;
     m_currentAccess = Uml::Visibility::Public;
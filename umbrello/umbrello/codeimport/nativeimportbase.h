@@ -17,6 +17,7 @@
 #include <QString>
 #include <QStringList>
 
+class QFile;
 class UMLPackage;
 class UMLClassifier;
 
@@ -59,6 +60,9 @@ protected:
 
     void scan(const QString& line);
 
+    static bool isBlank(const QString& line);
+    static QString readText(QFile& file);
+
     virtual bool preprocess(QString& line);
 
     virtual QStringList split(const QString& line);
@@ -91,7 +95,7 @@ protected:
     int scopeIndex();
 
     QString                m_singleLineCommentIntro;  ///< start token of a single line comment
-    QStringList            m_source;         ///< the scanned lexemes
+    QStringList            m_source;         ///< the scanned lexemes, each one a copy out of its line
     int                    m_srcIndex;       ///< used for indexing m_source
     QList<UMLPackage *>    m_scope;          ///< stack of scopes for use by the specific importer
     UMLClassifier         *m_klass;          ///< class currently being processed
@@ -59,16 +59,17 @@ void PascalImport::initVars()
  */
 void PascalImport::fillSource(const QString& word)
 {
-    QString lexeme;
-    const uint len = word.length();
-    for (uint i = 0; i < len; ++i) {
+    int start = -1;  // start of the current lexeme, -1 if there is none
+    const int len = word.length();
+    for (int i = 0; i < len; ++i) {
         QChar c = word[i];
         if (c.isLetterOrNumber() || c == QLatin1Char('_') || c == QLatin1Char('.') || c == QLatin1Char('#')) {
-            lexeme += c;
+            if (start == -1)
+                start = i;
         } else {
-            if (!lexeme.isEmpty()) {
-                m_source.append(lexeme);
-                lexeme.clear();
+            if (start != -1) {
+                m_source.append(word.mid(start, i - start));
+                start = -1;
             }
             if (i+1 < len && c == QLatin1Char(':') && word[i + 1] == QLatin1Char('=')) {
                 m_source.append(QLatin1String(":="));
@@ -78,8 +79,8 @@ void PascalImport::fillSource(const QString& word)
             }
         }
     }
-    if (!lexeme.isEmpty())
-        m_source.append(lexeme);
+    if (start != -1)
+        m_source.append(word.mid(start));
 }
 
 /**
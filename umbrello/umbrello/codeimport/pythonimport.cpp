@@ -127,24 +127,25 @@ bool PythonImport::preprocess(QString& line)
  */
 void PythonImport::fillSource(const QString& word)
 {
-    QString lexeme;
-    const uint len = word.length();
-    for (uint i = 0; i < len; ++i) {
+    int start = -1;  // start of the current lexeme, -1 if there is none
+    const int len = word.length();
+    for (int i = 0; i < len; ++i) {
         const QChar& c = word[i];
         if (c.isLetterOrNumber() || c == QLatin1Char('_') || c == QLatin1Char('.')) {
-            lexeme += c;
+            if (start == -1)
+                start = i;
         } else {
-            if (!lexeme.isEmpty()) {
-                m_source.append(lexeme);
+            if (start != -1) {
+                m_source.append(word.mid(start, i - start));
                 m_srcIndex++;
-                lexeme.clear();
+                start = -1;
             }
             m_source.append(QString(c));
             m_srcIndex++;
         }
     }
-    if (!lexeme.isEmpty()) {
-        m_source.append(lexeme);
+    if (start != -1) {
+        m_source.append(word.mid(start));
         m_srcIndex++;
     }
 }
@@ -29,6 +29,7 @@
 #include "codeimportingwizard.h"  //:TODO: circular reference
 #include "debug_utils.h"
 #include "model_utils.h"
+#include "optionstate.h"
 #include "uml.h"
 #include "umldoc.h"
 #include "umllistview.h"
@@ -152,9 +153,30 @@ void CodeImpStatusPage::importCode()
     connect(m_thread, SIGNAL(finished(bool)), this, SLOT(importCodeFile(bool)));
     connect(m_thread, SIGNAL(terminated()), this, SLOT(importCodeStop()));
 #endif
+    if (Settings::optionState().codeImportState.parallelImport && m_files.size() > 1) {
+        importCodeFiles();
+        return;
+    }
     importCodeFile();
 }
 
+/**
+ * Import all files with one worker, which parses them in parallel.
+ */
+void CodeImpStatusPage::importCodeFiles()
+{
+    m_index = m_files.size();
+    messageToLog(QString(), i18np("importing 1 file ...", "importing %1 files ...", m_files.size()));
+    CodeImpThread* worker = new CodeImpThread(m_files);
+    connect(worker, SIGNAL(messageToWiz(QString,QString)), this, SLOT(updateStatus(QString,QString)));
+    connect(worker, SIGNAL(messageToLog(QString,QString)), this, SLOT(messageToLog(QString,QString)));
+    connect(worker, SIGNAL(messageToApp(QString)), this, SLOT(messageToApp(QString)));
+    connect(worker, SIGNAL(finished(bool)), this, SLOT(importCodeFinish()));
+    connect(worker, SIGNAL(aborted()), this, SLOT(importCodeStop()));
+    worker->run();
+    worker->deleteLater();
+}
+
 void CodeImpStatusPage::importCodeFile(bool noError)
 {
     if (m_index > 0) {
@@ -64,6 +64,7 @@ private:
 protected slots:
     void importCode(); ///< start importing
     void importCodeFile(bool noError=true); ///< import single file
+    void importCodeFiles(); ///< import all files at once
     void importNextFile(bool noError=true);
     void importCodeFinish(); ///< finish importing
     void importCodeStop(); ///< cancel importing
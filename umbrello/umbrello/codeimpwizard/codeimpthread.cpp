@@ -38,6 +38,21 @@ CodeImpThread::CodeImpThread(QFileInfo file, QObject* parent)
             this, SLOT(questionAsked(QString,int)));
 }
 
+/**
+ * Constructor.
+ * @param files  Files to import with one importer for which the thread shall be spawned
+ */
+CodeImpThread::CodeImpThread(const QList<QFileInfo>& files, QObject* parent)
+  : QObject(parent),
+    m_files(files)
+{
+    if (!m_files.isEmpty()) {
+        m_file = m_files.first();
+    }
+    connect(this, SIGNAL(askQuestion(QString,int)),
+            this, SLOT(questionAsked(QString,int)));
+}
+
 /**
  * Destructor.
  */
@@ -50,6 +65,10 @@ CodeImpThread::~CodeImpThread()
  */
 void CodeImpThread::run()
 {
+    if (m_files.size() > 1) {
+        importFiles();
+        return;
+    }
     ClassImport *classImporter = ClassImport::createImporterByFileExt(m_file.fileName(), this);
     QString fileName = m_file.absoluteFilePath();
 
@@ -80,6 +99,35 @@ void CodeImpThread::run()
     }
 }
 
+/**
+ * Import all files of the list with one importer, see ClassImport::importFiles().
+ */
+void CodeImpThread::importFiles()
+{
+    ClassImport *classImporter = ClassImport::createImporterByFileExt(m_file.fileName(), this);
+    if (!classImporter) {
+        foreach (const QFileInfo& file, m_files) {
+            emit messageToWiz(file.fileName(), QLatin1String("aborted"));
+        }
+        emit messageToApp(i18n("No code importer for file: %1", m_file.absoluteFilePath()));
+        emit aborted();
+        return;
+    }
+    QStringList fileNames;
+    foreach (const QFileInfo& file, m_files) {
+        fileNames.append(file.absoluteFilePath());
+        emit messageToLog(file.fileName(), QLatin1String("start import..."));
+        emit messageToWiz(file.fileName(), QLatin1String("started"));
+    }
+    bool result = classImporter->importFiles(fileNames);
+    foreach (const QFileInfo& file, m_files) {
+        emit messageToWiz(file.fileName(), result ? QLatin1String("finished") : QString());
+    }
+    emit messageToLog(QString(), result ? QLatin1String("...import finished") : QLatin1String("...import failed"));
+    delete classImporter;
+    emit finished(result);
+}
+
 /**
  * Emit a signal to the main gui thread to show a question box.
  * @param question   the text of the question
@@ -28,7 +28,9 @@
 class ClassImport;
 
 /**
- * Thread class that does the code import work for one file.
+ * Thread class that does the code import work for one file, or for a
+ * list of files, which are parsed in parallel if enabled in the code
+ * import settings.
  * TODO: For a start it is only a QObject and is used to signals messages.
  * @author Andi Fischer
  */
@@ -37,6 +39,7 @@ class CodeImpThread : public QObject
     Q_OBJECT
 public:
     explicit CodeImpThread(QFileInfo file, QObject* parent = 0);
+    explicit CodeImpThread(const QList<QFileInfo>& files, QObject* parent = 0);
     virtual ~CodeImpThread();
 
 public slots:
@@ -58,7 +61,10 @@ private slots:
     void questionAsked(const QString& question, int& answer);
 
 private:
+    void importFiles();
+
     QFileInfo         m_file;
+    QList<QFileInfo>  m_files;
     //QWaitCondition    m_waitCondition;
     //QMutex            m_mutex;
 };
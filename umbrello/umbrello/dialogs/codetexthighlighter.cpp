@@ -24,8 +24,7 @@
 
 #include "codetexthighlighter.h"
 
-#include "codegenerator.h"
-#include "codegenfactory.h"
+#include "keywordtable.h"
 #include "uml.h"
 
 /**
@@ -119,9 +118,7 @@ void CodeTextHighlighter::highlightBlock(const QString &text)
 QStringList CodeTextHighlighter::keywords()
 {
     Uml::ProgrammingLanguage::Enum pl = UMLApp::app()->activeLanguage();
-    CodeGenerator* generator = CodeGenFactory::createObject(pl);
-    QStringList keywordList = generator->reservedKeywords();
-    delete generator;
+    QStringList keywordList = Uml::ProgrammingLanguage::reservedKeywords(pl).toStringList();
 
 //     if (keywordList.size() <= 0) {
 //         keywordList << "\\bchar\\b" << "\\bclass\\b" << "\\bconst\\b"
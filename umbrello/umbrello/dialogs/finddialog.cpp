@@ -70,6 +70,33 @@ UMLFinder::Category FindDialog::category()
         return UMLFinder::All;
 }
 
+/**
+ * Return user selected way to compare the text.
+ * @return mode enum
+ */
+UMLFinder::Mode FindDialog::mode()
+{
+    switch (ui_mode->currentIndex()) {
+    case 1:
+        return UMLFinder::Prefix;
+    case 2:
+        return UMLFinder::RegExp;
+    default:
+        return UMLFinder::Substring;
+    }
+}
+
+/**
+ * Return the texts of the objects to search.
+ * @return combination of UMLFinder::Field values
+ */
+int FindDialog::fields()
+{
+    if (ui_searchAllFields->isChecked())
+        return UMLFinder::Names | UMLFinder::Stereotypes | UMLFinder::Documentation;
+    return UMLFinder::Names;
+}
+
 /**
  * Handles filter radio button group click.
  * @param button (-2=Treeview,-3,-4)
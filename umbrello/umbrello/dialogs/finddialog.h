@@ -30,6 +30,8 @@ public:
     QString text();
     UMLFinder::Filter filter();
     UMLFinder::Category category();
+    UMLFinder::Mode mode();
+    int fields();
 
 protected:
     void showEvent(QShowEvent *event);
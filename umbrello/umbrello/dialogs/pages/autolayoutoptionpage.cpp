@@ -37,6 +37,7 @@ AutoLayoutOptionPage::AutoLayoutOptionPage(QWidget* parent)
     m_autoDotPath->setChecked(Settings::optionState().autoLayoutState.autoDotPath);
     m_dotPath->setText(Settings::optionState().autoLayoutState.dotPath);
     m_showExportLayout->setChecked(Settings::optionState().autoLayoutState.showExportLayout);
+    m_useDot->setChecked(Settings::optionState().autoLayoutState.useDot);
     connect(m_autoDotPath, SIGNAL(toggled(bool)), this, SLOT(slotAutoDotPathCBClicked(bool)));
 
     if (Settings::optionState().autoLayoutState.autoDotPath) {
@@ -59,6 +60,7 @@ void AutoLayoutOptionPage::setDefaults()
 {
     m_autoDotPath->setChecked(true);
     m_showExportLayout->setChecked(false);
+    m_useDot->setChecked(false);
 }
 
 /**
@@ -71,6 +73,7 @@ void AutoLayoutOptionPage::apply()
     Settings::optionState().autoLayoutState.dotPath = m_autoDotPath->isChecked() ? QString()
                                                                                  : m_dotPath->text();
     Settings::optionState().autoLayoutState.showExportLayout = m_showExportLayout->isChecked();
+    Settings::optionState().autoLayoutState.useDot = m_useDot->isChecked();
     emit applyClicked();
 }
 
@@ -36,6 +36,8 @@ CodeImportOptionsPage::CodeImportOptionsPage(QWidget *parent)
     setupUi(this);
     createArtifactCheckBox->setChecked(Settings::optionState().codeImportState.createArtifacts);
     resolveDependenciesCheckBox->setChecked(Settings::optionState().codeImportState.resolveDependencies);
+    parallelImportCheckBox->setChecked(Settings::optionState().codeImportState.parallelImport);
+    parseCacheCheckBox->setChecked(Settings::optionState().codeImportState.parseCache);
 }
 
 /**
@@ -52,6 +54,8 @@ void CodeImportOptionsPage::setDefaults()
 {
     createArtifactCheckBox->setChecked(true);
     resolveDependenciesCheckBox->setChecked(true);
+    parallelImportCheckBox->setChecked(false);
+    parseCacheCheckBox->setChecked(true);
 }
 
 /**
@@ -62,5 +66,7 @@ void CodeImportOptionsPage::apply()
 {
     Settings::optionState().codeImportState.createArtifacts = createArtifactCheckBox->isChecked();
     Settings::optionState().codeImportState.resolveDependencies = resolveDependenciesCheckBox->isChecked();
+    Settings::optionState().codeImportState.parallelImport = parallelImportCheckBox->isChecked();
+    Settings::optionState().codeImportState.parseCache = parseCacheCheckBox->isChecked();
     emit applyClicked();
 }
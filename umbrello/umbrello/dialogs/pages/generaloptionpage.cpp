@@ -78,6 +78,18 @@ GeneralOptionPage::GeneralOptionPage(QWidget* parent)
     m_GeneralWidgets.footerPrintingCB = new QCheckBox(i18n("Turn on footer and page numbers when printing"), m_GeneralWidgets.miscGB);
     m_GeneralWidgets.footerPrintingCB->setChecked(optionState.generalState.footerPrinting);
     miscLayout->addWidget(m_GeneralWidgets.footerPrintingCB, 2, 0);
+
+    m_GeneralWidgets.undoMemoryL = new QLabel(i18n("Undo history kept in memory (MiB):"), m_GeneralWidgets.miscGB);
+    miscLayout->addWidget(m_GeneralWidgets.undoMemoryL, 3, 0);
+#if QT_VERSION >= 0x050000
+    m_GeneralWidgets.undoMemoryISB = new QSpinBox(m_GeneralWidgets.miscGB);
+    m_GeneralWidgets.undoMemoryISB->setRange(1, 4096);
+    m_GeneralWidgets.undoMemoryISB->setSingleStep(1);
+    m_GeneralWidgets.undoMemoryISB->setValue(optionState.generalState.undoMemoryBudget);
+#else
+    m_GeneralWidgets.undoMemoryISB = new KIntSpinBox(1, 4096, 1, optionState.generalState.undoMemoryBudget, m_GeneralWidgets.miscGB);
+#endif
+    miscLayout->addWidget(m_GeneralWidgets.undoMemoryISB, 3, 1);
     topLayout->addWidget(m_GeneralWidgets.miscGB);
 
     //setup autosave settings
@@ -199,6 +211,7 @@ void GeneralOptionPage::apply()
 {
     Settings::OptionState &optionState = Settings::optionState();
     optionState.generalState.undo = m_GeneralWidgets.undoCB->isChecked();
+    optionState.generalState.undoMemoryBudget = m_GeneralWidgets.undoMemoryISB->value();
     optionState.generalState.tabdiagrams = m_GeneralWidgets.tabdiagramsCB->isChecked();
 #ifdef ENABLE_NEW_CODE_GENERATORS
     optionState.generalState.newcodegen = m_GeneralWidgets.newcodegenCB->isChecked();
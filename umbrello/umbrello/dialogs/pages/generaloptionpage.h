@@ -53,8 +53,10 @@ protected:
 
 #if QT_VERSION >= 0x050000
         QSpinBox  * timeISB;
+        QSpinBox  * undoMemoryISB;
 #else
         KIntSpinBox * timeISB;
+        KIntSpinBox * undoMemoryISB;
 #endif
         KComboBox * diagramKB;
         KComboBox * languageKB;
@@ -64,6 +66,7 @@ protected:
         QCheckBox * newcodegenCB;
         QCheckBox * angularLinesCB;
         QCheckBox * footerPrintingCB;
+        QLabel    * undoMemoryL;
         
         QCheckBox * autosaveCB;
         QCheckBox * loadlastCB;
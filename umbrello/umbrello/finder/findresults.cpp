@@ -29,25 +29,27 @@ FindResults::~FindResults()
  * Collect items limited by a filter, a category and a text
  *
  * @param filter filter to limit the search
- * @param category category to search for (currently unsupported)
- * @param  text
+ * @param category category to search for
+ * @param text text to search for
+ * @param mode how the text is compared
+ * @param fields texts of the objects to search, a combination of UMLFinder::Field values
  * @return Number of items found
  */
-int FindResults::collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString &text)
+int FindResults::collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString &text,
+                         UMLFinder::Mode mode, int fields)
 {
-    Q_UNUSED(category);
     clear();
     if (filter == UMLFinder::TreeView) {
         m_listViewFinder.append(UMLListViewFinder());
-        return m_listViewFinder.last().collect(category, text);
+        return m_listViewFinder.last().collect(category, text, mode, fields);
     }
     else if (filter == UMLFinder::CurrentDiagram) {
         m_sceneFinder.append(UMLSceneFinder(UMLApp::app()->currentView()));
-        return m_sceneFinder.last().collect(category, text);
+        return m_sceneFinder.last().collect(category, text, mode, fields);
     }
     else if (filter == UMLFinder::AllDiagrams) {
         m_docFinder.append(UMLDocFinder());
-        return m_docFinder.last().collect(category, text);
+        return m_docFinder.last().collect(category, text, mode, fields);
     }
     return 0;
 }
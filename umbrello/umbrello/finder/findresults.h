@@ -35,7 +35,8 @@ public:
     virtual ~FindResults ();
 
     void clear();
-    int collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString & text);
+    int collect(UMLFinder::Filter filter, UMLFinder::Category category, const QString & text,
+                UMLFinder::Mode mode = UMLFinder::Substring, int fields = UMLFinder::Names);
 
 public slots:
     bool displayNext();
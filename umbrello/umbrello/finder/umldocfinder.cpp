@@ -13,11 +13,17 @@
 // app include
 #include "uml.h"
 #include "umldoc.h"
+#include "umlfindindex.h"
+#include "umlscene.h"
 #include "umlscenefinder.h"
 #include "umlview.h"
 #include "umlwidget.h"
 #include "umlviewlist.h"
 
+// qt includes
+#include <QHash>
+#include <QVector>
+
 UMLDocFinder::UMLDocFinder()
   : UMLFinder()
 {
@@ -27,21 +33,55 @@ UMLDocFinder::~UMLDocFinder()
 {
 }
 
-int UMLDocFinder::collect(UMLFinder::Category category, const QString &text)
+int UMLDocFinder::collect(UMLFinder::Category category, const QString &text, Mode mode, int fields)
 {
     m_sceneFinder.clear();
-    UMLViewList views = UMLApp::app()->document()->viewIterator();
-    int counts = 0;
-    foreach (UMLView *view, views) {
-        UMLSceneFinder finder(view);
-        int count = finder.collect(category, text);
-        if (count > 0) {
-            m_sceneFinder.append(finder);
-            counts += count;
+    UMLDoc *doc = UMLApp::app()->document();
+    QHash<QByteArray, UMLView*> loadedViews;
+    foreach (UMLView *view, doc->loadedViews()) {
+        const Uml::ID::Type id = view->umlScene()->ID();
+        loadedViews.insert(QByteArray(id.data(), int(id.size())), view);
+    }
+
+    // one finder per diagram in the order of the diagrams, loaded diagrams
+    // are searched by their widgets, the others by the find index without
+    // loading them
+    QHash<QByteArray, int> finderOfView;
+    typedef QPair<Uml::ID::Type, QString> ViewName;
+    foreach (const ViewName &viewName, doc->viewNames()) {
+        finderOfView.insert(QByteArray(viewName.first.data(), int(viewName.first.size())), m_sceneFinder.size());
+        m_sceneFinder.append(UMLSceneFinder(viewName.first));
+    }
+    QVector<int> counts(m_sceneFinder.size(), 0);
+    QHash<QByteArray, UMLView*>::const_iterator it;
+    for (it = loadedViews.constBegin(); it != loadedViews.constEnd(); ++it) {
+        const int i = finderOfView.value(it.key(), -1);
+        if (i >= 0) {
+            counts[i] = m_sceneFinder[i].collectWidgets(it.value()->umlScene(), category, text, mode, fields);
+        }
+    }
+    if (loadedViews.count() < m_sceneFinder.size()) {
+        UMLFindIndex *index = doc->findIndex();
+        foreach (UMLObject *o, index->find(text, mode, fields, category)) {
+            foreach (const Uml::ID::Type &viewId, index->diagrams(o)) {
+                const QByteArray key = QByteArray::fromRawData(viewId.data(), int(viewId.size()));
+                const int i = finderOfView.value(key, -1);
+                if (i >= 0 && !loadedViews.contains(key)) {
+                    m_sceneFinder[i].addItem(o->id());
+                    ++counts[i];
+                }
+            }
+        }
+    }
+    int total = 0;
+    for (int i = m_sceneFinder.size() - 1; i >= 0; --i) {
+        if (counts[i] == 0) {
+            m_sceneFinder.removeAt(i);
         }
+        total += counts[i];
     }
     m_index = 0;
-    return counts;
+    return total;
 }
 
 UMLFinder::Result UMLDocFinder::displayNext()
@@ -28,7 +28,7 @@ class UMLDocFinder : public UMLFinder
 public:
     UMLDocFinder();
     virtual ~UMLDocFinder();
-    virtual int collect(Category category, const QString &text);
+    virtual int collect(Category category, const QString &text, Mode mode, int fields);
 
 public slots:
     virtual Result displayNext();
@@ -30,6 +30,8 @@ public:
     typedef enum { All, Classes, Packages, Interfaces, Operations, Attributes } Category;
     typedef enum { TreeView, CurrentDiagram, AllDiagrams } Filter;
     typedef enum { Empty, End, Found, NotFound } Result;
+    typedef enum { Prefix, Substring, RegExp } Mode;
+    typedef enum { Names = 1, Stereotypes = 2, Documentation = 4 } Field;
     UMLFinder();
     virtual ~UMLFinder();
 
@@ -38,9 +40,11 @@ public:
      *
      * @param category Category to search for
      * @param text     Text to search for
+     * @param mode     How the text is compared
+     * @param fields   Texts of the objects to search, a combination of Field values
      * @return Number of items found
      */
-    virtual int collect(Category category, const QString &text) = 0;
+    virtual int collect(Category category, const QString &text, Mode mode, int fields) = 0;
     /**
      * Show next item.
      *
@@ -55,11 +59,11 @@ public:
      */
     virtual Result displayPrevious() = 0;
 
+    static bool includeObject(Category category, UMLObject *o);
+
 protected:
     int m_index;
     QList<Uml::ID::Type> m_items;
-
-    bool includeObject(Category category, UMLObject *o);
 };
 
 #endif // UMLFINDER_H
@@ -0,0 +1,460 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "umlfindindex.h"
+
+// app includes
+#include "associationwidget.h"
+#include "debug_utils.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlobject.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlviewlist.h"
+#include "umlwidget.h"
+
+// qt includes
+#include <QRegExp>
+
+/**
+ * Constructor. The index is empty until the first query.
+ */
+UMLFindIndex::UMLFindIndex()
+  : m_built(false)
+{
+}
+
+/**
+ * Destructor.
+ */
+UMLFindIndex::~UMLFindIndex()
+{
+}
+
+/**
+ * Drop the whole index, it is built again by the next query.
+ * Called when the objects of the document are removed or loaded.
+ */
+void UMLFindIndex::clear()
+{
+    m_built = false;
+    m_entries.clear();
+    m_dirty.clear();
+    m_names.clear();
+    m_trigrams.clear();
+    m_stereotypes.clear();
+    m_diagrams.clear();
+    m_diagramsOfObject.clear();
+}
+
+/**
+ * Return true if the index has been built since it was cleared.
+ */
+bool UMLFindIndex::isBuilt() const
+{
+    return m_built;
+}
+
+/**
+ * Remember an object which has been created or modified. It is
+ * reindexed by the next query.
+ *
+ * @param object   The changed object.
+ */
+void UMLFindIndex::objectChanged(UMLObject *object)
+{
+    if (!m_built || !object) {
+        return;
+    }
+    m_dirty.insert(object, object);
+}
+
+/**
+ * Remove an object which is about to be deleted or has been removed
+ * from the model.
+ *
+ * @param object   The removed object.
+ */
+void UMLFindIndex::objectRemoved(UMLObject *object)
+{
+    if (!m_built || !object) {
+        return;
+    }
+    m_dirty.remove(object);
+    removeObject(object);
+}
+
+/**
+ * Find the objects of the model matching the given text.
+ * The comparison is case insensitive.
+ *
+ * @param text       The text or regular expression to search for.
+ * @param mode       How the text is compared.
+ * @param fields     The texts of the objects to search, a combination
+ *                   of UMLFinder::Field values.
+ * @param category   The object types to search for.
+ * @return  The objects found in no particular order.
+ */
+UMLObjectList UMLFindIndex::find(const QString &text, UMLFinder::Mode mode, int fields, UMLFinder::Category category)
+{
+    update();
+    updateDiagrams();
+
+    UMLObjectList result;
+    QRegExp regExp;
+    if (mode == UMLFinder::RegExp) {
+        regExp = QRegExp(text, Qt::CaseInsensitive);
+        if (!regExp.isValid()) {
+            uWarning() << "invalid regular expression" << text << ":" << regExp.errorString();
+            return result;
+        }
+    }
+    const QString lower = text.toLower();
+    QSet<UMLObject*> found;
+    if (fields & UMLFinder::Names) {
+        found = findNames(lower, mode, regExp);
+    }
+    if (fields & UMLFinder::Stereotypes) {
+        found.unite(findStereotypes(lower, mode, regExp));
+    }
+    if (fields & UMLFinder::Documentation) {
+        found.unite(findDocumentation(lower, mode, regExp));
+    }
+    foreach (UMLObject *o, found) {
+        UMLObject *object = m_entries.value(o).object;
+        if (UMLFinder::includeObject(category, object)) {
+            result.append(object);
+        }
+    }
+    return result;
+}
+
+/**
+ * Return the IDs of the diagrams showing the given object, as known by
+ * the last call of find().
+ *
+ * @param object   The object to look up.
+ */
+QList<Uml::ID::Type> UMLFindIndex::diagrams(UMLObject *object) const
+{
+    QList<Uml::ID::Type> ids;
+    if (!object) {
+        return ids;
+    }
+    foreach (const QByteArray &viewId, m_diagramsOfObject.values(key(object->id()))) {
+        const Uml::ID::Type id(viewId.constData(), viewId.size());
+        if (!ids.contains(id)) {
+            ids.append(id);
+        }
+    }
+    return ids;
+}
+
+/**
+ * Index all objects of the document.
+ */
+void UMLFindIndex::build()
+{
+    clear();
+    m_built = true;
+    foreach (UMLObject *o, UMLApp::app()->document()->objectsInIndex()) {
+        if (o) {
+            addObject(o);
+        }
+    }
+}
+
+/**
+ * Build the index if needed, otherwise reindex the changed objects.
+ */
+void UMLFindIndex::update()
+{
+    if (!m_built) {
+        build();
+        return;
+    }
+    UMLDoc *doc = UMLApp::app()->document();
+    QHash<UMLObject*, QPointer<UMLObject> >::const_iterator it;
+    for (it = m_dirty.constBegin(); it != m_dirty.constEnd(); ++it) {
+        removeObject(it.key());
+        if (it.value() && doc->isInObjectIndex(it.value())) {
+            addObject(it.value());
+        }
+    }
+    m_dirty.clear();
+}
+
+/**
+ * Update the objects of the diagrams whose widget or association list
+ * has changed, and of the diagrams not loaded yet which are not known.
+ * Diagrams which do not exist anymore are removed.
+ */
+void UMLFindIndex::updateDiagrams()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    QHash<QByteArray, UMLView*> loadedViews;
+    foreach (UMLView *view, doc->loadedViews()) {
+        loadedViews.insert(key(view->umlScene()->ID()), view);
+    }
+
+    QSet<QByteArray> viewIds;
+    typedef QPair<Uml::ID::Type, QString> ViewName;
+    foreach (const ViewName &viewName, doc->viewNames()) {
+        const QByteArray viewId = key(viewName.first);
+        viewIds.insert(viewId);
+        QHash<QByteArray, Diagram>::const_iterator it = m_diagrams.constFind(viewId);
+        UMLView *view = loadedViews.value(viewId);
+        if (view) {
+            const UMLWidgetList &widgets = view->umlScene()->widgetList();
+            const AssociationWidgetList &associations = view->umlScene()->associationList();
+            uint fingerprint = uint(widgets.count()) * 31 + uint(associations.count());
+            foreach (UMLWidget *w, widgets) {
+                fingerprint = fingerprint * 31 + uint(quintptr(w)) + uint(quintptr(w->umlObject()));
+            }
+            foreach (AssociationWidget *a, associations) {
+                fingerprint = fingerprint * 31 + uint(quintptr(a)) + uint(quintptr(a->umlObject()));
+            }
+            if (it != m_diagrams.constEnd() && !it->deferred && it->fingerprint == fingerprint) {
+                continue;
+            }
+            QList<QByteArray> objectIds;
+            foreach (UMLWidget *w, widgets) {
+                if (w->umlObject()) {
+                    objectIds.append(key(w->umlObject()->id()));
+                }
+            }
+            foreach (AssociationWidget *a, associations) {
+                if (a->umlObject()) {
+                    objectIds.append(key(a->umlObject()->id()));
+                }
+            }
+            setDiagram(viewId, false, fingerprint, objectIds);
+        } else if (it == m_diagrams.constEnd() || !it->deferred) {
+            QList<QByteArray> objectIds;
+            foreach (const Uml::ID::Type &id, doc->deferredViewObjects(viewName.first)) {
+                objectIds.append(key(id));
+            }
+            setDiagram(viewId, true, 0, objectIds);
+        }
+    }
+
+    foreach (const QByteArray &viewId, m_diagrams.keys()) {
+        if (!viewIds.contains(viewId)) {
+            removeDiagram(viewId);
+        }
+    }
+}
+
+/**
+ * Add the texts of an object to the index.
+ */
+void UMLFindIndex::addObject(UMLObject *object)
+{
+    Entry entry;
+    entry.object = object;
+    entry.name = object->name().toLower();
+    entry.stereotype = object->stereotype().toLower();
+    entry.documentation = object->doc().toLower();
+    m_entries.insert(object, entry);
+
+    m_names.insert(entry.name, object);
+    foreach (quint64 trigram, trigrams(entry.name)) {
+        m_trigrams[trigram].insert(object);
+    }
+    if (!entry.stereotype.isEmpty()) {
+        m_stereotypes[entry.stereotype].insert(object);
+    }
+}
+
+/**
+ * Remove the texts of an object from the index.
+ * The object is not dereferenced, it may have been deleted already.
+ */
+void UMLFindIndex::removeObject(UMLObject *object)
+{
+    QHash<UMLObject*, Entry>::iterator it = m_entries.find(object);
+    if (it == m_entries.end()) {
+        return;
+    }
+    m_names.remove(it->name, object);
+    foreach (quint64 trigram, trigrams(it->name)) {
+        QHash<quint64, QSet<UMLObject*> >::iterator t = m_trigrams.find(trigram);
+        if (t != m_trigrams.end()) {
+            t->remove(object);
+            if (t->isEmpty()) {
+                m_trigrams.erase(t);
+            }
+        }
+    }
+    if (!it->stereotype.isEmpty()) {
+        QHash<QString, QSet<UMLObject*> >::iterator s = m_stereotypes.find(it->stereotype);
+        if (s != m_stereotypes.end()) {
+            s->remove(object);
+            if (s->isEmpty()) {
+                m_stereotypes.erase(s);
+            }
+        }
+    }
+    m_entries.erase(it);
+}
+
+/**
+ * Replace the objects shown on a diagram.
+ */
+void UMLFindIndex::setDiagram(const QByteArray &viewId, bool deferred, uint fingerprint, const QList<QByteArray> &objectIds)
+{
+    removeDiagram(viewId);
+    Diagram diagram;
+    diagram.deferred = deferred;
+    diagram.fingerprint = fingerprint;
+    diagram.objectIds = objectIds;
+    m_diagrams.insert(viewId, diagram);
+    foreach (const QByteArray &objectId, objectIds) {
+        m_diagramsOfObject.insert(objectId, viewId);
+    }
+}
+
+/**
+ * Remove a diagram and the objects shown on it.
+ */
+void UMLFindIndex::removeDiagram(const QByteArray &viewId)
+{
+    QHash<QByteArray, Diagram>::iterator it = m_diagrams.find(viewId);
+    if (it == m_diagrams.end()) {
+        return;
+    }
+    foreach (const QByteArray &objectId, it->objectIds) {
+        m_diagramsOfObject.remove(objectId, viewId);
+    }
+    m_diagrams.erase(it);
+}
+
+/**
+ * Find the objects whose name matches.
+ * Prefixes are looked up in the sorted names, substrings of at least
+ * three characters in the trigrams of the names.
+ */
+QSet<UMLObject*> UMLFindIndex::findNames(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const
+{
+    QSet<UMLObject*> found;
+    if (mode == UMLFinder::Prefix) {
+        QMultiMap<QString, UMLObject*>::const_iterator it = m_names.lowerBound(text);
+        for (; it != m_names.constEnd() && it.key().startsWith(text); ++it) {
+            found.insert(it.value());
+        }
+        return found;
+    }
+    if (mode == UMLFinder::Substring && text.length() >= 3) {
+        // all matching names contain every trigram of the text, it is
+        // sufficient to check the objects of the rarest one
+        const QSet<UMLObject*> *candidates = 0;
+        foreach (quint64 trigram, trigrams(text)) {
+            QHash<quint64, QSet<UMLObject*> >::const_iterator it = m_trigrams.constFind(trigram);
+            if (it == m_trigrams.constEnd()) {
+                return found;
+            }
+            if (!candidates || it->count() < candidates->count()) {
+                candidates = &it.value();
+            }
+        }
+        foreach (UMLObject *o, *candidates) {
+            if (m_entries.value(o).name.contains(text)) {
+                found.insert(o);
+            }
+        }
+        return found;
+    }
+    QHash<UMLObject*, Entry>::const_iterator it;
+    for (it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        if (matches(it->name, text, mode, regExp)) {
+            found.insert(it.key());
+        }
+    }
+    return found;
+}
+
+/**
+ * Find the objects whose stereotype matches. Only the distinct
+ * stereotypes are compared.
+ */
+QSet<UMLObject*> UMLFindIndex::findStereotypes(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const
+{
+    QSet<UMLObject*> found;
+    QHash<QString, QSet<UMLObject*> >::const_iterator it;
+    for (it = m_stereotypes.constBegin(); it != m_stereotypes.constEnd(); ++it) {
+        if (matches(it.key(), text, mode, regExp)) {
+            found.unite(it.value());
+        }
+    }
+    return found;
+}
+
+/**
+ * Find the objects whose documentation matches.
+ */
+QSet<UMLObject*> UMLFindIndex::findDocumentation(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const
+{
+    QSet<UMLObject*> found;
+    QHash<UMLObject*, Entry>::const_iterator it;
+    for (it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        if (!it->documentation.isEmpty() && matches(it->documentation, text, mode, regExp)) {
+            found.insert(it.key());
+        }
+    }
+    return found;
+}
+
+/**
+ * Compare an indexed text with the text searched for.
+ *
+ * @param value    The lower case text of an object.
+ * @param text     The lower case text searched for.
+ * @param mode     How the text is compared.
+ * @param regExp   The regular expression used in mode UMLFinder::RegExp.
+ */
+bool UMLFindIndex::matches(const QString &value, const QString &text, UMLFinder::Mode mode, const QRegExp &regExp)
+{
+    switch (mode) {
+    case UMLFinder::Prefix:
+        return value.startsWith(text);
+    case UMLFinder::Substring:
+        return value.contains(text);
+    case UMLFinder::RegExp:
+        return regExp.indexIn(value) != -1;
+    }
+    return false;
+}
+
+/**
+ * Return the key of an ID in the hashes of the index.
+ */
+QByteArray UMLFindIndex::key(Uml::ID::Type id)
+{
+    return QByteArray(id.data(), int(id.size()));
+}
+
+/**
+ * Return the distinct trigrams of a text, each packed into an integer.
+ */
+QList<quint64> UMLFindIndex::trigrams(const QString &text)
+{
+    QList<quint64> result;
+    for (int i = 0; i + 2 < text.length(); ++i) {
+        const quint64 trigram = (quint64(text.at(i).unicode()) << 32)
+                              | (quint64(text.at(i + 1).unicode()) << 16)
+                              | quint64(text.at(i + 2).unicode());
+        if (!result.contains(trigram)) {
+            result.append(trigram);
+        }
+    }
+    return result;
+}
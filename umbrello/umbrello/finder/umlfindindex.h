@@ -0,0 +1,113 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef UMLFINDINDEX_H
+#define UMLFINDINDEX_H
+
+// app includes
+#include "basictypes.h"
+#include "umlfinder.h"
+#include "umlobjectlist.h"
+
+// qt includes
+#include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QPointer>
+#include <QSet>
+#include <QString>
+
+class UMLObject;
+class QRegExp;
+
+/**
+ * The UMLFindIndex is the search index of a document, used by the
+ * finders and by the --find command line option.
+ *
+ * It keeps the lower case name, stereotype and documentation of every
+ * object of the model. Names are indexed by their trigrams and in sorted
+ * order, stereotypes by their value, so that prefix and substring queries
+ * do not need to look at every object. Regular expressions and the
+ * documentation are matched against the cached texts.
+ *
+ * The index also knows on which diagrams an object is shown, including
+ * diagrams which have not been loaded yet.
+ *
+ * The index is built on the first query after a document has been loaded.
+ * UMLDoc and UMLObject report created, modified and removed objects, which
+ * are reindexed by the next query. The diagrams are checked for changed
+ * widget and association lists on each query.
+ */
+class UMLFindIndex
+{
+public:
+    UMLFindIndex();
+    ~UMLFindIndex();
+
+    void clear();
+    bool isBuilt() const;
+
+    void objectChanged(UMLObject *object);
+    void objectRemoved(UMLObject *object);
+
+    UMLObjectList find(const QString &text,
+                       UMLFinder::Mode mode = UMLFinder::Substring,
+                       int fields = UMLFinder::Names,
+                       UMLFinder::Category category = UMLFinder::All);
+    QList<Uml::ID::Type> diagrams(UMLObject *object) const;
+
+    static bool matches(const QString &value, const QString &text, UMLFinder::Mode mode, const QRegExp &regExp);
+
+private:
+    /**
+     * The indexed texts of an object, all in lower case.
+     */
+    struct Entry {
+        QPointer<UMLObject> object;
+        QString name;
+        QString stereotype;
+        QString documentation;
+    };
+
+    /**
+     * The objects shown on a diagram.
+     */
+    struct Diagram {
+        bool deferred;                ///< the objects were taken from the XMI of a diagram not loaded yet
+        uint fingerprint;             ///< of the widget and association lists the objects were taken from
+        QList<QByteArray> objectIds;
+    };
+
+    void build();
+    void update();
+    void updateDiagrams();
+    void addObject(UMLObject *object);
+    void removeObject(UMLObject *object);
+    void setDiagram(const QByteArray &viewId, bool deferred, uint fingerprint, const QList<QByteArray> &objectIds);
+    void removeDiagram(const QByteArray &viewId);
+
+    QSet<UMLObject*> findNames(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const;
+    QSet<UMLObject*> findStereotypes(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const;
+    QSet<UMLObject*> findDocumentation(const QString &text, UMLFinder::Mode mode, const QRegExp &regExp) const;
+
+    static QByteArray key(Uml::ID::Type id);
+    static QList<quint64> trigrams(const QString &text);
+
+    bool m_built;
+    QHash<UMLObject*, Entry> m_entries;
+    QHash<UMLObject*, QPointer<UMLObject> > m_dirty; ///< objects to be reindexed by the next query
+    QMultiMap<QString, UMLObject*> m_names;          ///< for prefix queries
+    QHash<quint64, QSet<UMLObject*> > m_trigrams;    ///< for substring queries
+    QHash<QString, QSet<UMLObject*> > m_stereotypes;
+    QHash<QByteArray, Diagram> m_diagrams;           ///< by view id
+    QMultiHash<QByteArray, QByteArray> m_diagramsOfObject;
+};
+
+#endif // UMLFINDINDEX_H
@@ -12,6 +12,8 @@
 
 // app include
 #include "uml.h"
+#include "umldoc.h"
+#include "umlfindindex.h"
 #include "umllistview.h"
 #include "umlobject.h"
 
@@ -24,18 +26,11 @@ UMLListViewFinder::~UMLListViewFinder()
 {
 }
 
-int UMLListViewFinder::collect(Category category, const QString &text)
+int UMLListViewFinder::collect(Category category, const QString &text, Mode mode, int fields)
 {
-    Q_UNUSED(category);
-    QList<QTreeWidgetItem*> items = UMLApp::app()->listView()->findItems(text, Qt::MatchContains | Qt::MatchRecursive);
+    UMLObjectList objects = UMLApp::app()->document()->findIndex()->find(text, mode, fields, category);
     m_items.clear();
-    foreach(QTreeWidgetItem *item, items) {
-        UMLListViewItem *ui = dynamic_cast<UMLListViewItem*>(item);
-        if (!ui)
-            continue;
-        UMLObject *o = ui->umlObject();
-        if (!includeObject(category, o))
-            continue;
+    foreach(UMLObject *o, objects) {
         m_items.append(o->id());
     }
 
@@ -23,7 +23,7 @@ class UMLListViewFinder : public UMLFinder
 public:
     UMLListViewFinder();
     virtual ~UMLListViewFinder();
-    virtual int collect(Category category, const QString &text);
+    virtual int collect(Category category, const QString &text, Mode mode, int fields);
 
     virtual Result displayNext();
     virtual Result displayPrevious();
@@ -12,9 +12,33 @@
 
 #include "uml.h"
 #include "umldoc.h"
+#include "umlfindindex.h"
 #include "umllistview.h"
 #include "umlscene.h"
 #include "umlview.h"
+#include "umlwidget.h"
+
+// qt includes
+#include <QRegExp>
+
+/**
+ * Compare the texts of a widget with the lower case text searched for.
+ */
+static bool widgetMatches(UMLWidget *w, const QString &text, UMLFinder::Mode mode, int fields, const QRegExp &regExp)
+{
+    UMLObject *o = w->umlObject();
+    if (fields & UMLFinder::Names) {
+        if (UMLFindIndex::matches(w->name().toLower(), text, mode, regExp))
+            return true;
+        if (!w->instanceName().isEmpty() && UMLFindIndex::matches(w->instanceName().toLower(), text, mode, regExp))
+            return true;
+    }
+    if ((fields & UMLFinder::Stereotypes) && UMLFindIndex::matches(o->stereotype().toLower(), text, mode, regExp))
+        return true;
+    if ((fields & UMLFinder::Documentation) && !o->doc().isEmpty() && UMLFindIndex::matches(o->doc().toLower(), text, mode, regExp))
+        return true;
+    return false;
+}
 
 UMLSceneFinder::UMLSceneFinder(UMLView *view)
   : UMLFinder(),
@@ -22,30 +46,80 @@ UMLSceneFinder::UMLSceneFinder(UMLView *view)
 {
 }
 
+UMLSceneFinder::UMLSceneFinder(Uml::ID::Type id)
+  : UMLFinder(),
+    m_id(id)
+{
+}
+
 UMLSceneFinder::~UMLSceneFinder()
 {
 }
 
-int UMLSceneFinder::collect(Category category, const QString &text)
+int UMLSceneFinder::collect(Category category, const QString &text, Mode mode, int fields)
 {
-    Q_UNUSED(category);
     m_items.clear();
     m_index = -1;
 
-    UMLView *view = UMLApp::app()->document()->findView(m_id);
-    if (!view)
-        return 0;
+    UMLDoc *doc = UMLApp::app()->document();
+    foreach(UMLView *view, doc->loadedViews()) {
+        if (view->umlScene()->ID() == m_id)
+            return collectWidgets(view->umlScene(), category, text, mode, fields);
+    }
 
-    UMLScene *scene = view->umlScene();
+    // a diagram which has not been loaded yet is not loaded for searching,
+    // the find index knows the objects shown on it
+    UMLFindIndex *index = doc->findIndex();
+    foreach(UMLObject *o, index->find(text, mode, fields, category)) {
+        if (index->diagrams(o).contains(m_id))
+            m_items.append(o->id());
+    }
+    return m_items.size();
+}
+
+/**
+ * Collect the widgets of a loaded diagram. The names are taken from
+ * the widgets, including the instance names of object widgets, which
+ * are not known to the find index.
+ *
+ * @param scene    scene of the diagram
+ * @param category Category to search for
+ * @param text     Text to search for
+ * @param mode     How the text is compared
+ * @param fields   Texts of the widgets to search, a combination of Field values
+ * @return Number of items found
+ */
+int UMLSceneFinder::collectWidgets(UMLScene *scene, Category category, const QString &text, Mode mode, int fields)
+{
+    m_items.clear();
+    m_index = -1;
+
+    QRegExp regExp;
+    if (mode == RegExp) {
+        regExp = QRegExp(text, Qt::CaseInsensitive);
+        if (!regExp.isValid())
+            return 0;
+    }
+    const QString lower = text.toLower();
     foreach(UMLWidget* w, scene->widgetList()) {
         if (!includeObject(category, w->umlObject()))
             continue;
-        if (w->name().contains(text, Qt::CaseInsensitive))
+        if (widgetMatches(w, lower, mode, fields, regExp))
             m_items.append(w->id());
     }
     return m_items.size();
 }
 
+/**
+ * Add an item found by a caller which has already queried the find index.
+ *
+ * @param id ID of the uml object shown on the diagram
+ */
+void UMLSceneFinder::addItem(Uml::ID::Type id)
+{
+    m_items.append(id);
+}
+
 UMLFinder::Result UMLSceneFinder::displayNext()
 {
     if (m_items.size() == 0 || UMLApp::app()->document()->findView(m_id) == 0)
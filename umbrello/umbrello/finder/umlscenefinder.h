@@ -13,6 +13,7 @@
 
 #include "umlfinder.h"
 
+class UMLScene;
 class UMLView;
 
 /**
@@ -24,8 +25,11 @@ class UMLSceneFinder : public UMLFinder
 {
 public:
     explicit UMLSceneFinder(UMLView *view);
+    explicit UMLSceneFinder(Uml::ID::Type id);
     virtual ~UMLSceneFinder();
-    virtual int collect(Category category, const QString &text);
+    virtual int collect(Category category, const QString &text, Mode mode, int fields);
+    int collectWidgets(UMLScene *scene, Category category, const QString &text, Mode mode, int fields);
+    void addItem(Uml::ID::Type id);
 
     virtual Result displayNext();
     virtual Result displayPrevious();
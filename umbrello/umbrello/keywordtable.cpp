@@ -0,0 +1,80 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "keywordtable.h"
+
+/**
+ * Return whether the table contains the given word.
+ */
+bool KeywordTable::contains(const QString &word) const
+{
+    return contains(word.constData(), word.length());
+}
+
+/**
+ * Return whether the table contains the given word.
+ * @param word     the characters of the word, need not be terminated
+ * @param length   the number of characters
+ */
+bool KeywordTable::contains(const QChar *word, int length) const
+{
+    if (m_count == 0 || length <= 0)
+        return false;
+
+    const quint32 h = hash(word, length, m_caseSensitive);
+    const quint32 displacement = m_displacements[h % m_bucketCount];
+    const int index = m_slots[slot(h, displacement) & m_slotMask];
+    if (index < 0)
+        return false;
+
+    const char *candidate = m_words[index];
+    for (int i = 0; i < length; ++i) {
+        ushort c = uchar(candidate[i]);
+        ushort u = word[i].unicode();
+        if (c == 0)
+            return false;
+        if (!m_caseSensitive) {
+            c = foldCase(c);
+            u = foldCase(u);
+        }
+        if (c != u)
+            return false;
+    }
+    return candidate[length] == 0;
+}
+
+/**
+ * Return the number of words.
+ */
+int KeywordTable::count() const
+{
+    return m_count;
+}
+
+/**
+ * Return whether words have to match in case.
+ */
+bool KeywordTable::isCaseSensitive() const
+{
+    return m_caseSensitive;
+}
+
+/**
+ * Return the words in the order of the source file.
+ */
+QStringList KeywordTable::toStringList() const
+{
+    QStringList list;
+    list.reserve(m_count);
+    for (int i = 0; i < m_count; ++i)
+        list.append(QString::fromLatin1(m_words[i]));
+    return list;
+}
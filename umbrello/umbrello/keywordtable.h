@@ -0,0 +1,90 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef KEYWORDTABLE_H
+#define KEYWORDTABLE_H
+
+// qt includes
+#include <QString>
+#include <QStringList>
+
+/**
+ * A KeywordTable is the constant set of the reserved keywords or of the
+ * default datatypes of a programming language, see
+ * Uml::ProgrammingLanguage::reservedKeywords() and
+ * Uml::ProgrammingLanguage::defaultDatatypes().
+ *
+ * The tables are generated at build time by tools/keywords2cpp from the
+ * *.keywords files of the code generators. The words are placed by a
+ * minimal perfect hash (hash, displace and compress): the hash of a word
+ * selects a bucket, the displacement of the bucket selects the slot, and
+ * the slot holds the index of the only word that can match. A lookup
+ * therefore compares at most one word and does not allocate memory.
+ *
+ * Tables of case insensitive languages fold ASCII letters for hashing
+ * and comparing, the words themselves are ASCII only.
+ *
+ * The members are public so that the generated tables can be constant
+ * aggregates, they must not be used outside of this class.
+ */
+struct KeywordTable
+{
+    bool contains(const QString &word) const;
+    bool contains(const QChar *word, int length) const;
+    int count() const;
+    bool isCaseSensitive() const;
+    QStringList toStringList() const;
+
+    /**
+     * Fold an ASCII upper case letter to lower case.
+     */
+    static inline ushort foldCase(ushort c)
+    {
+        return (c >= 'A' && c <= 'Z') ? ushort(c + ('a' - 'A')) : c;
+    }
+
+    /**
+     * Return the FNV-1a hash of the UTF-16 code units of a word.
+     */
+    static inline quint32 hash(const QChar *word, int length, bool caseSensitive)
+    {
+        quint32 h = 2166136261u;
+        for (int i = 0; i < length; ++i) {
+            const ushort c = caseSensitive ? word[i].unicode() : foldCase(word[i].unicode());
+            h = (h ^ c) * 16777619u;
+        }
+        return h;
+    }
+
+    /**
+     * Return the unmasked slot of a word hash in a bucket with the given
+     * displacement.
+     */
+    static inline quint32 slot(quint32 hash, quint32 displacement)
+    {
+        quint32 x = hash ^ (displacement * 0x9E3779B9u);
+        x ^= x >> 16;
+        x *= 0x85ebca6bu;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35u;
+        x ^= x >> 16;
+        return x;
+    }
+
+    const char *const *m_words;        ///< in the order of the source file
+    int m_count;
+    const qint16 *m_slots;             ///< index of the word in a slot, -1 if empty
+    quint32 m_slotMask;                ///< number of slots - 1
+    const quint16 *m_displacements;    ///< of the buckets
+    quint32 m_bucketCount;
+    bool m_caseSensitive;
+};
+
+#endif // KEYWORDTABLE_H
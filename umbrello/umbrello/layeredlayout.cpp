@@ -0,0 +1,1007 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "layeredlayout.h"
+
+// qt includes
+#include <QtGlobal>
+
+// system includes
+#include <algorithm>
+#include <climits>
+
+/**
+ * Maximal number of barycenter sweeps of the crossing minimization.
+ */
+static const int MaxSweeps = 24;
+
+/**
+ * The crossing minimization stops after this number of sweeps
+ * without improvement.
+ */
+static const int MaxSweepsWithoutImprovement = 4;
+
+/**
+ * Number of alternating downward and upward passes of the
+ * coordinate assignment.
+ */
+static const int PlacementPasses = 8;
+
+/**
+ * How much stronger virtual vertices are pulled to their neighbours than
+ * nodes, which keeps long edges straight.
+ */
+static const qreal VirtualPriority = 4.0;
+
+/**
+ * How much weaker vertices without neighbours keep their position.
+ */
+static const qreal IsolatedPriority = 0.1;
+
+/**
+ * Minimal distance between the horizontal segments of orthogonal edges.
+ */
+static const qreal TrackDistance = 8.0;
+
+static const int UpperSide = 1;
+static const int LowerSide = 2;
+
+/**
+ * Return whether two coordinates are the same, apart from rounding errors.
+ */
+static bool isSame(qreal a, qreal b)
+{
+    return qAbs(a - b) < 0.01;
+}
+
+static bool lessFirst(const QPair<qreal, int> &a, const QPair<qreal, int> &b)
+{
+    return a.first < b.first;
+}
+
+/**
+ * Constructor.
+ */
+LayeredLayout::LayeredLayout()
+  : m_direction(TopToBottom),
+    m_routing(Orthogonal),
+    m_rankSeparation(36),
+    m_nodeSeparation(36),
+    m_crossings(0),
+    m_cancelled(0)
+{
+}
+
+/**
+ * Set the direction the edges point to.
+ */
+void LayeredLayout::setDirection(Direction direction)
+{
+    m_direction = direction;
+}
+
+/**
+ * Return the direction the edges point to.
+ */
+LayeredLayout::Direction LayeredLayout::direction() const
+{
+    return m_direction;
+}
+
+/**
+ * Return the direction for a dot rankdir attribute.
+ *
+ * @param rankdir   "TB", "BT", "LR" or "RL"
+ */
+LayeredLayout::Direction LayeredLayout::direction(const QString &rankdir)
+{
+    const QString value = rankdir.toUpper();
+    if (value == QLatin1String("BT"))
+        return BottomToTop;
+    else if (value == QLatin1String("LR"))
+        return LeftToRight;
+    else if (value == QLatin1String("RL"))
+        return RightToLeft;
+    return TopToBottom;
+}
+
+/**
+ * Set how the edges are routed.
+ */
+void LayeredLayout::setRouting(Routing routing)
+{
+    m_routing = routing;
+}
+
+/**
+ * Return how the edges are routed.
+ */
+LayeredLayout::Routing LayeredLayout::routing() const
+{
+    return m_routing;
+}
+
+/**
+ * Set the minimal distance between two layers.
+ */
+void LayeredLayout::setRankSeparation(qreal distance)
+{
+    m_rankSeparation = distance;
+}
+
+/**
+ * Return the minimal distance between two layers.
+ */
+qreal LayeredLayout::rankSeparation() const
+{
+    return m_rankSeparation;
+}
+
+/**
+ * Set the minimal distance between two nodes of a layer.
+ */
+void LayeredLayout::setNodeSeparation(qreal distance)
+{
+    m_nodeSeparation = distance;
+}
+
+/**
+ * Return the minimal distance between two nodes of a layer.
+ */
+qreal LayeredLayout::nodeSeparation() const
+{
+    return m_nodeSeparation;
+}
+
+/**
+ * Add a node to the graph.
+ *
+ * @param id     The id of the widget represented by the node.
+ * @param size   The size of the widget.
+ * @return       The index of the node.
+ */
+int LayeredLayout::addNode(const QString &id, const QSizeF &size)
+{
+    Node node;
+    node.id = id;
+    node.size = size;
+    m_nodes.append(node);
+    return m_nodes.size() - 1;
+}
+
+/**
+ * Add an edge to the graph.
+ *
+ * @param source       The index of the node the edge starts at.
+ * @param target       The index of the node the edge points to.
+ * @param weight       How strong the edge pulls its nodes together.
+ * @param constraint   Whether the target is placed in a layer after the source.
+ * @return             The index of the edge.
+ */
+int LayeredLayout::addEdge(int source, int target, double weight, bool constraint)
+{
+    Q_ASSERT(source >= 0 && source < m_nodes.size());
+    Q_ASSERT(target >= 0 && target < m_nodes.size());
+    Edge edge;
+    edge.source = source;
+    edge.target = target;
+    edge.weight = weight;
+    edge.constraint = constraint;
+    m_edges.append(edge);
+    return m_edges.size() - 1;
+}
+
+/**
+ * Remove all nodes and edges.
+ */
+void LayeredLayout::clear()
+{
+    m_nodes.clear();
+    m_edges.clear();
+    m_boundingRect = QRectF();
+    m_crossings = 0;
+}
+
+/**
+ * Return the nodes, with their positions after run().
+ */
+const QVector<LayeredLayout::Node>& LayeredLayout::nodes() const
+{
+    return m_nodes;
+}
+
+/**
+ * Return the edges, with their points after run().
+ */
+const QVector<LayeredLayout::Edge>& LayeredLayout::edges() const
+{
+    return m_edges;
+}
+
+/**
+ * Return the rectangle containing all nodes and edges after run().
+ */
+QRectF LayeredLayout::boundingRect() const
+{
+    return m_boundingRect;
+}
+
+/**
+ * Return the number of crossings between the layers after run(),
+ * a measure of the quality of the layout.
+ */
+int LayeredLayout::crossings() const
+{
+    return m_crossings;
+}
+
+/**
+ * Calculate the layout.
+ *
+ * @param cancelled   When not null, the calculation stops as soon as
+ *                    possible after it has been set to a value other than 0.
+ * @return            false if the calculation has been cancelled
+ */
+bool LayeredLayout::run(const QAtomicInt *cancelled)
+{
+    m_cancelled = cancelled;
+    m_crossings = 0;
+    m_boundingRect = QRectF();
+
+    const int count = m_nodes.size();
+    const bool transposed = m_direction == LeftToRight || m_direction == RightToLeft;
+    m_width = QVector<qreal>(count);
+    m_height = QVector<qreal>(count);
+    for (int i = 0; i < count; ++i) {
+        const QSizeF &size = m_nodes[i].size;
+        m_width[i] = transposed ? size.height() : size.width();
+        m_height[i] = transposed ? size.width() : size.height();
+    }
+    m_rank = QVector<int>(count, 0);
+    m_upper = QVector<QList<Link> >(count);
+    m_lower = QVector<QList<Link> >(count);
+    m_reversed = QVector<bool>(m_edges.size(), false);
+    m_chains = QVector<QVector<int> >(m_edges.size());
+    for (int e = 0; e < m_edges.size(); ++e) {
+        m_edges[e].points.clear();
+        m_edges[e].labelPosition = QPointF();
+    }
+
+    breakCycles();
+    assignRanks();
+    if (isCancelled())
+        return false;
+    createVirtualVertices();
+    if (!orderVertices())
+        return false;
+    assignCoordinates();
+    if (isCancelled())
+        return false;
+    routeEdges();
+    applyDirection();
+    return true;
+}
+
+/**
+ * Return whether the caller of run() asked to stop.
+ */
+bool LayeredLayout::isCancelled() const
+{
+    if (!m_cancelled)
+        return false;
+#if QT_VERSION >= 0x050000
+    return m_cancelled->load() != 0;
+#else
+    return int(*m_cancelled) != 0;
+#endif
+}
+
+/**
+ * Return whether the vertex is a virtual node of an edge.
+ */
+bool LayeredLayout::isVirtual(int vertex) const
+{
+    return vertex >= m_nodes.size();
+}
+
+/**
+ * Reverse the edges closing a cycle, found by an iterative depth first
+ * search, so that the constraining edges form an acyclic graph.
+ */
+void LayeredLayout::breakCycles()
+{
+    const int count = m_nodes.size();
+    QVector<QList<int> > outgoing(count);
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const Edge &edge = m_edges[e];
+        if (edge.constraint && edge.source != edge.target)
+            outgoing[edge.source].append(e);
+    }
+
+    // 0 = not visited, 1 = on the stack, 2 = finished
+    QVector<int> state(count, 0);
+    QVector<QPair<int, int> > stack;
+    for (int root = 0; root < count; ++root) {
+        if (state[root] != 0)
+            continue;
+        state[root] = 1;
+        stack.append(qMakePair(root, 0));
+        while (!stack.isEmpty()) {
+            const int vertex = stack.last().first;
+            const int next = stack.last().second;
+            if (next < outgoing[vertex].size()) {
+                stack.last().second = next + 1;
+                const int e = outgoing[vertex][next];
+                const int target = m_edges[e].target;
+                if (state[target] == 1) {
+                    m_reversed[e] = true;
+                } else if (state[target] == 0) {
+                    state[target] = 1;
+                    stack.append(qMakePair(target, 0));
+                }
+            } else {
+                state[vertex] = 2;
+                stack.resize(stack.size() - 1);
+            }
+        }
+    }
+}
+
+/**
+ * Assign each node the length of the longest path from a source as rank.
+ * Sources are moved down to the layer above their nearest successor
+ * afterwards, so that they do not create long edges.
+ */
+void LayeredLayout::assignRanks()
+{
+    const int count = m_nodes.size();
+    QVector<QList<int> > successors(count);
+    QVector<int> predecessorCount(count, 0);
+    QVector<int> inDegree(count, 0);
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const Edge &edge = m_edges[e];
+        if (!edge.constraint || edge.source == edge.target)
+            continue;
+        const int from = m_reversed[e] ? edge.target : edge.source;
+        const int to = m_reversed[e] ? edge.source : edge.target;
+        successors[from].append(to);
+        ++predecessorCount[to];
+        ++inDegree[to];
+    }
+
+    QVector<int> order;
+    order.reserve(count);
+    for (int vertex = 0; vertex < count; ++vertex) {
+        if (inDegree[vertex] == 0)
+            order.append(vertex);
+    }
+    for (int i = 0; i < order.size(); ++i) {
+        const int vertex = order[i];
+        foreach (int successor, successors[vertex]) {
+            m_rank[successor] = qMax(m_rank[successor], m_rank[vertex] + 1);
+            if (--inDegree[successor] == 0)
+                order.append(successor);
+        }
+    }
+
+    for (int i = order.size() - 1; i >= 0; --i) {
+        const int vertex = order[i];
+        if (predecessorCount[vertex] > 0 || successors[vertex].isEmpty())
+            continue;
+        int rank = INT_MAX;
+        foreach (int successor, successors[vertex])
+            rank = qMin(rank, m_rank[successor]);
+        m_rank[vertex] = rank - 1;
+    }
+}
+
+/**
+ * Split the edges spanning several layers by adding a virtual vertex in
+ * each layer they cross, and link the vertices of adjacent layers.
+ */
+void LayeredLayout::createVirtualVertices()
+{
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const Edge &edge = m_edges[e];
+        if (edge.source == edge.target)
+            continue;
+        m_reversed[e] = m_rank[edge.source] > m_rank[edge.target];
+        const int top = m_reversed[e] ? edge.target : edge.source;
+        const int bottom = m_reversed[e] ? edge.source : edge.target;
+
+        QVector<int> chain;
+        chain.append(top);
+        for (int rank = m_rank[top] + 1; rank < m_rank[bottom]; ++rank) {
+            chain.append(m_rank.size());
+            m_width.append(0);
+            m_height.append(0);
+            m_rank.append(rank);
+            m_upper.append(QList<Link>());
+            m_lower.append(QList<Link>());
+        }
+        chain.append(bottom);
+
+        if (m_rank[top] != m_rank[bottom]) {
+            for (int i = 0; i < chain.size() - 1; ++i) {
+                Link link;
+                link.weight = edge.weight;
+                link.edge = e;
+                link.vertex = chain[i + 1];
+                m_lower[chain[i]].append(link);
+                link.vertex = chain[i];
+                m_upper[chain[i + 1]].append(link);
+            }
+        }
+        m_chains[e] = chain;
+    }
+}
+
+/**
+ * Order the vertices of each layer by alternating downward and upward
+ * barycenter sweeps, keeping the order with the fewest crossings.
+ *
+ * @return false if the calculation has been cancelled
+ */
+bool LayeredLayout::orderVertices()
+{
+    initialOrder();
+    const int layers = m_layers.size();
+    int best = countCrossings();
+    QVector<QVector<int> > bestLayers = m_layers;
+    int withoutImprovement = 0;
+    for (int sweep = 0; sweep < MaxSweeps && best > 0 && withoutImprovement < MaxSweepsWithoutImprovement; ++sweep) {
+        if (isCancelled())
+            return false;
+        if (sweep % 2 == 0) {
+            for (int layer = 1; layer < layers; ++layer)
+                sortLayer(layer, true);
+        } else {
+            for (int layer = layers - 2; layer >= 0; --layer)
+                sortLayer(layer, false);
+        }
+        const int crossings = countCrossings();
+        if (crossings < best) {
+            best = crossings;
+            bestLayers = m_layers;
+            withoutImprovement = 0;
+        } else {
+            ++withoutImprovement;
+        }
+    }
+
+    m_layers = bestLayers;
+    for (int layer = 0; layer < layers; ++layer) {
+        for (int i = 0; i < m_layers[layer].size(); ++i)
+            m_order[m_layers[layer][i]] = i;
+    }
+    m_crossings = best;
+    return true;
+}
+
+/**
+ * Create the initial order of the layers by a breadth first traversal
+ * from the top layer, which keeps connected vertices together.
+ */
+void LayeredLayout::initialOrder()
+{
+    const int count = m_rank.size();
+    int layers = 0;
+    for (int vertex = 0; vertex < count; ++vertex)
+        layers = qMax(layers, m_rank[vertex] + 1);
+
+    QVector<QVector<int> > byRank(layers);
+    for (int vertex = 0; vertex < count; ++vertex)
+        byRank[m_rank[vertex]].append(vertex);
+
+    m_layers = QVector<QVector<int> >(layers);
+    m_order = QVector<int>(count, -1);
+    for (int layer = 0; layer < layers; ++layer) {
+        foreach (int vertex, byRank[layer]) {
+            if (m_order[vertex] < 0) {
+                m_order[vertex] = m_layers[layer].size();
+                m_layers[layer].append(vertex);
+            }
+        }
+        if (layer + 1 == layers)
+            break;
+        foreach (int vertex, m_layers[layer]) {
+            foreach (const Link &link, m_lower[vertex]) {
+                if (m_order[link.vertex] < 0) {
+                    m_order[link.vertex] = m_layers[layer + 1].size();
+                    m_layers[layer + 1].append(link.vertex);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Sort a layer by the weighted barycenter of the neighbours of its
+ * vertices in the adjacent layer. Vertices without neighbours there
+ * keep their position.
+ *
+ * @param layer      The index of the layer.
+ * @param useUpper   Whether the neighbours in the layer above or below are used.
+ */
+void LayeredLayout::sortLayer(int layer, bool useUpper)
+{
+    QVector<int> &vertices = m_layers[layer];
+    QVector<QPair<qreal, int> > keys;
+    keys.reserve(vertices.size());
+    for (int i = 0; i < vertices.size(); ++i) {
+        const QList<Link> &links = useUpper ? m_upper[vertices[i]] : m_lower[vertices[i]];
+        qreal sum = 0;
+        qreal weights = 0;
+        foreach (const Link &link, links) {
+            sum += link.weight * m_order[link.vertex];
+            weights += link.weight;
+        }
+        keys.append(qMakePair(weights > 0 ? sum / weights : qreal(i), vertices[i]));
+    }
+    std::stable_sort(keys.begin(), keys.end(), lessFirst);
+    for (int i = 0; i < keys.size(); ++i) {
+        vertices[i] = keys[i].second;
+        m_order[vertices[i]] = i;
+    }
+}
+
+/**
+ * Return the number of crossings between all layers.
+ */
+int LayeredLayout::countCrossings() const
+{
+    int crossings = 0;
+    for (int layer = 0; layer < m_layers.size() - 1; ++layer)
+        crossings += countCrossings(layer);
+    return crossings;
+}
+
+/**
+ * Return the number of crossings between a layer and the layer below,
+ * which is the number of inversions of the lower ends of the edges when
+ * they are sorted by their upper ends. The inversions are counted with a
+ * binary indexed tree in O(e log v).
+ */
+int LayeredLayout::countCrossings(int layer) const
+{
+    QVector<QPair<int, int> > ends;
+    foreach (int vertex, m_layers[layer]) {
+        foreach (const Link &link, m_lower[vertex])
+            ends.append(qMakePair(m_order[vertex], m_order[link.vertex]));
+    }
+    std::sort(ends.begin(), ends.end());
+
+    const int size = m_layers[layer + 1].size();
+    QVector<int> tree(size + 1, 0);
+    int crossings = 0;
+    for (int i = 0; i < ends.size(); ++i) {
+        const int lower = ends[i].second + 1;
+        int notRightOf = 0;
+        for (int j = lower; j > 0; j -= j & -j)
+            notRightOf += tree[j];
+        crossings += i - notRightOf;
+        for (int j = lower; j <= size; j += j & -j)
+            ++tree[j];
+    }
+    return crossings;
+}
+
+/**
+ * Calculate the position of the vertices along their layers by moving each
+ * layer to its neighbours in alternating downward and upward passes, and
+ * the height of the layers.
+ */
+void LayeredLayout::assignCoordinates()
+{
+    const int layers = m_layers.size();
+    m_x = QVector<qreal>(m_rank.size(), 0);
+    for (int layer = 0; layer < layers; ++layer) {
+        const QVector<int> &vertices = m_layers[layer];
+        qreal x = 0;
+        for (int i = 0; i < vertices.size(); ++i) {
+            if (i > 0)
+                x += gap(vertices[i - 1], vertices[i]);
+            m_x[vertices[i]] = x;
+        }
+    }
+
+    for (int pass = 0; pass < PlacementPasses; ++pass) {
+        if (pass % 2 == 0) {
+            for (int layer = 1; layer < layers; ++layer)
+                placeLayer(layer, UpperSide);
+        } else {
+            for (int layer = layers - 2; layer >= 0; --layer)
+                placeLayer(layer, LowerSide);
+        }
+    }
+    for (int layer = 0; layer < layers; ++layer)
+        placeLayer(layer, UpperSide | LowerSide);
+
+    qreal left = 0;
+    for (int vertex = 0; vertex < m_x.size(); ++vertex) {
+        const qreal x = m_x[vertex] - m_width[vertex] / 2;
+        if (vertex == 0 || x < left)
+            left = x;
+    }
+    for (int vertex = 0; vertex < m_x.size(); ++vertex)
+        m_x[vertex] -= left;
+
+    m_layerHeight = QVector<qreal>(layers, 0);
+    for (int vertex = 0; vertex < m_rank.size(); ++vertex)
+        m_layerHeight[m_rank[vertex]] = qMax(m_layerHeight[m_rank[vertex]], m_height[vertex]);
+}
+
+/**
+ * Move the vertices of a layer as near as possible to the weighted mean
+ * position of their neighbours while keeping their order and separation.
+ *
+ * The best positions are found by an isotonic regression (pool adjacent
+ * violators) of the desired positions minus the minimal offset of each
+ * vertex from the first one, which takes linear time.
+ *
+ * @param layer   The index of the layer.
+ * @param sides   The layers whose neighbours are used, UpperSide and/or LowerSide.
+ */
+void LayeredLayout::placeLayer(int layer, int sides)
+{
+    const QVector<int> &vertices = m_layers[layer];
+    const int count = vertices.size();
+    if (count == 0)
+        return;
+
+    QVector<qreal> offset(count);
+    QVector<qreal> blockWeight;
+    QVector<qreal> blockSum;
+    QVector<int> blockCount;
+    for (int i = 0; i < count; ++i) {
+        const int vertex = vertices[i];
+        qreal sum = 0;
+        qreal weights = 0;
+        if (sides & UpperSide) {
+            foreach (const Link &link, m_upper[vertex]) {
+                sum += link.weight * m_x[link.vertex];
+                weights += link.weight;
+            }
+        }
+        if (sides & LowerSide) {
+            foreach (const Link &link, m_lower[vertex]) {
+                sum += link.weight * m_x[link.vertex];
+                weights += link.weight;
+            }
+        }
+        offset[i] = i == 0 ? 0 : offset[i - 1] + gap(vertices[i - 1], vertex);
+        const qreal target = (weights > 0 ? sum / weights : m_x[vertex]) - offset[i];
+        qreal weight = isVirtual(vertex) ? VirtualPriority : 1.0;
+        if (weights <= 0)
+            weight *= IsolatedPriority;
+
+        blockWeight.append(weight);
+        blockSum.append(weight * target);
+        blockCount.append(1);
+        int last = blockCount.size() - 1;
+        while (last > 0 && blockSum[last - 1] / blockWeight[last - 1] > blockSum[last] / blockWeight[last]) {
+            blockWeight[last - 1] += blockWeight[last];
+            blockSum[last - 1] += blockSum[last];
+            blockCount[last - 1] += blockCount[last];
+            blockWeight.resize(last);
+            blockSum.resize(last);
+            blockCount.resize(last);
+            --last;
+        }
+    }
+
+    int i = 0;
+    for (int block = 0; block < blockCount.size(); ++block) {
+        const qreal value = blockSum[block] / blockWeight[block];
+        for (int j = 0; j < blockCount[block]; ++j, ++i)
+            m_x[vertices[i]] = value + offset[i];
+    }
+}
+
+/**
+ * Return the minimal distance between the centers of two adjacent
+ * vertices of a layer. Virtual vertices are packed closer.
+ */
+qreal LayeredLayout::gap(int left, int right) const
+{
+    qreal separation = m_nodeSeparation;
+    if (isVirtual(left) && isVirtual(right))
+        separation /= 4;
+    else if (isVirtual(left) || isVirtual(right))
+        separation /= 2;
+    return (m_width[left] + m_width[right]) / 2 + separation;
+}
+
+/**
+ * Distribute the ends of the edges along the sides of the nodes, ordered
+ * by the position of the other end, so that edges sharing a node do not
+ * overlap or cross each other at the node. Edges to the layer below and
+ * edges inside a layer leave a node at the bottom, edges from the layer
+ * above enter at the top.
+ */
+void LayeredLayout::assignPorts()
+{
+    const int count = m_nodes.size();
+    m_ports = QVector<QPair<qreal, qreal> >(m_edges.size(), qMakePair(qreal(0), qreal(0)));
+
+    // the other end of the edge and the edge index * 2 + the end of the edge
+    QVector<QVector<QPair<qreal, int> > > bottom(count);
+    QVector<QVector<QPair<qreal, int> > > top(count);
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const QVector<int> &chain = m_chains[e];
+        if (chain.isEmpty())
+            continue;
+        const int first = chain.first();
+        const int last = chain.last();
+        bottom[first].append(qMakePair(m_x[chain[1]], 2 * e));
+        if (m_rank[first] == m_rank[last])
+            bottom[last].append(qMakePair(m_x[first], 2 * e + 1));
+        else
+            top[last].append(qMakePair(m_x[chain[chain.size() - 2]], 2 * e + 1));
+    }
+
+    for (int vertex = 0; vertex < count; ++vertex) {
+        for (int side = 0; side < 2; ++side) {
+            QVector<QPair<qreal, int> > &ends = side == 0 ? top[vertex] : bottom[vertex];
+            std::stable_sort(ends.begin(), ends.end(), lessFirst);
+            const qreal left = m_x[vertex] - m_width[vertex] / 2;
+            for (int i = 0; i < ends.size(); ++i) {
+                const qreal x = left + m_width[vertex] * (i + 1) / (ends.size() + 1);
+                const int e = ends[i].second / 2;
+                if (ends[i].second % 2 == 0)
+                    m_ports[e].first = x;
+                else
+                    m_ports[e].second = x;
+            }
+        }
+    }
+}
+
+/**
+ * Assign the horizontal segments of a channel to tracks so that segments
+ * of the same track do not overlap. The segments are assigned in the order
+ * of their left end to the first free track, which needs the smallest
+ * possible number of tracks.
+ *
+ * @param segments   The segments of the channel.
+ * @param tracks     Is set to the number of tracks used.
+ */
+void LayeredLayout::assignTracks(QVector<Segment> &segments, int &tracks) const
+{
+    QVector<QPair<qreal, int> > byLeft;
+    byLeft.reserve(segments.size());
+    for (int i = 0; i < segments.size(); ++i)
+        byLeft.append(qMakePair(segments[i].left, i));
+    std::stable_sort(byLeft.begin(), byLeft.end(), lessFirst);
+
+    QVector<qreal> trackEnd;
+    for (int i = 0; i < byLeft.size(); ++i) {
+        Segment &segment = segments[byLeft[i].second];
+        int track = 0;
+        while (track < trackEnd.size() && trackEnd[track] + TrackDistance / 2 > segment.left)
+            ++track;
+        if (track == trackEnd.size())
+            trackEnd.append(segment.right);
+        else
+            trackEnd[track] = segment.right;
+        segment.track = track;
+    }
+    tracks = trackEnd.size();
+}
+
+/**
+ * Calculate the points of the edges and the position of the layers.
+ *
+ * Orthogonal edges run vertically through the layers and change their
+ * position along the layers in the channel below a layer, on a track of
+ * their own. The channels are made high enough for their tracks.
+ */
+void LayeredLayout::routeEdges()
+{
+    const int layers = m_layers.size();
+    assignPorts();
+
+    // collect the horizontal segments, the channel of a layer is below it
+    // the position of each vertex of an edge along the layers, nearly
+    // equal positions are made equal to avoid tiny steps
+    QVector<QVector<qreal> > positions(m_edges.size());
+    QVector<QVector<Segment> > channels(layers);
+    QVector<QVector<int> > segmentOfStep(m_edges.size());
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const QVector<int> &chain = m_chains[e];
+        if (chain.isEmpty())
+            continue;
+        const int steps = chain.size() - 1;
+        QVector<qreal> &x = positions[e];
+        x.append(m_ports[e].first);
+        for (int i = 1; i < steps; ++i)
+            x.append(isSame(m_x[chain[i]], x.last()) ? x.last() : m_x[chain[i]]);
+        x.append(isSame(m_ports[e].second, x.last()) && m_rank[chain.first()] != m_rank[chain.last()]
+                 ? x.last() : m_ports[e].second);
+
+        segmentOfStep[e] = QVector<int>(steps, -1);
+        if (m_routing != Orthogonal)
+            continue;
+        for (int step = 0; step < steps; ++step) {
+            const qreal from = x[step];
+            const qreal to = x[step + 1];
+            if (from == to && m_rank[chain[step]] != m_rank[chain[step + 1]])
+                continue;
+            Segment segment;
+            segment.edge = e;
+            segment.left = qMin(from, to);
+            segment.right = qMax(from, to);
+            segment.track = 0;
+            QVector<Segment> &channel = channels[m_rank[chain[step]]];
+            segmentOfStep[e][step] = channel.size();
+            channel.append(segment);
+        }
+    }
+
+    QVector<int> tracks(layers, 0);
+    QVector<qreal> channelHeight(layers, 0);
+    for (int layer = 0; layer < layers; ++layer) {
+        assignTracks(channels[layer], tracks[layer]);
+        if (layer < layers - 1 || tracks[layer] > 0)
+            channelHeight[layer] = qMax(m_rankSeparation, (tracks[layer] + 1) * TrackDistance);
+    }
+
+    m_layerTop = QVector<qreal>(layers + 1, 0);
+    for (int layer = 0; layer < layers; ++layer)
+        m_layerTop[layer + 1] = m_layerTop[layer] + m_layerHeight[layer] + channelHeight[layer];
+
+    // the node positions are kept as centers until applyDirection()
+    for (int vertex = 0; vertex < m_nodes.size(); ++vertex) {
+        const int layer = m_rank[vertex];
+        m_nodes[vertex].position = QPointF(m_x[vertex], m_layerTop[layer] + m_layerHeight[layer] / 2);
+    }
+
+    for (int e = 0; e < m_edges.size(); ++e) {
+        const QVector<int> &chain = m_chains[e];
+        if (chain.isEmpty())
+            continue;
+        const int steps = chain.size() - 1;
+        QList<QPointF> points;
+        for (int step = 0; step < steps; ++step) {
+            const int upper = chain[step];
+            const int lower = chain[step + 1];
+            const int layer = m_rank[upper];
+            const qreal from = positions[e][step];
+            const qreal to = positions[e][step + 1];
+            const qreal layerBottom = m_layerTop[layer] + m_layerHeight[layer];
+            const qreal upperBottom = isVirtual(upper) ? layerBottom
+                                                       : layerBottom - (m_layerHeight[layer] - m_height[upper]) / 2;
+            if (m_rank[lower] == layer) {
+                const qreal lowerBottom = layerBottom - (m_layerHeight[layer] - m_height[lower]) / 2;
+                if (m_routing == Orthogonal) {
+                    const Segment &segment = channels[layer][segmentOfStep[e][step]];
+                    const qreal y = layerBottom + channelHeight[layer] * (segment.track + 1) / (tracks[layer] + 1);
+                    points << QPointF(from, upperBottom) << QPointF(from, y)
+                           << QPointF(to, y) << QPointF(to, lowerBottom);
+                } else {
+                    const qreal y = m_layerTop[layer] + m_layerHeight[layer] / 2;
+                    const bool leftToRight = m_x[upper] < m_x[lower];
+                    points << QPointF(m_x[upper] + (leftToRight ? 1 : -1) * m_width[upper] / 2, y)
+                           << QPointF(m_x[lower] + (leftToRight ? -1 : 1) * m_width[lower] / 2, y);
+                }
+                continue;
+            }
+
+            const int lowerLayer = m_rank[lower];
+            const qreal lowerTop = isVirtual(lower) ? m_layerTop[lowerLayer]
+                                                    : m_layerTop[lowerLayer] + (m_layerHeight[lowerLayer] - m_height[lower]) / 2;
+            if (m_routing == Orthogonal) {
+                points << QPointF(from, upperBottom);
+                if (segmentOfStep[e][step] >= 0) {
+                    const Segment &segment = channels[layer][segmentOfStep[e][step]];
+                    const qreal y = layerBottom + channelHeight[layer] * (segment.track + 1) / (tracks[layer] + 1);
+                    points << QPointF(from, y) << QPointF(to, y);
+                }
+                points << QPointF(to, lowerTop);
+            } else {
+                if (step == 0)
+                    points << QPointF(from, upperBottom);
+                if (step == steps - 1)
+                    points << QPointF(to, lowerTop);
+                else
+                    points << QPointF(to, m_layerTop[lowerLayer] + m_layerHeight[lowerLayer] / 2);
+            }
+        }
+
+        points = simplified(points);
+        if (m_reversed[e])
+            std::reverse(points.begin(), points.end());
+
+        // the label is placed at the middle of the longest segment
+        qreal longest = -1;
+        for (int i = 0; i < points.size() - 1; ++i) {
+            const QPointF d = points[i + 1] - points[i];
+            const qreal length = qAbs(d.x()) + qAbs(d.y());
+            if (length > longest) {
+                longest = length;
+                m_edges[e].labelPosition = (points[i] + points[i + 1]) / 2;
+            }
+        }
+        m_edges[e].points = points;
+    }
+}
+
+/**
+ * Return the points without duplicates and without points in the middle
+ * of a horizontal or vertical line.
+ */
+QList<QPointF> LayeredLayout::simplified(const QList<QPointF> &points)
+{
+    QList<QPointF> result;
+    foreach (const QPointF &point, points) {
+        if (!result.isEmpty() && isSame(result.last().x(), point.x()) && isSame(result.last().y(), point.y()))
+            continue;
+        const int size = result.size();
+        if (size >= 2) {
+            const QPointF &a = result[size - 2];
+            const QPointF &b = result[size - 1];
+            if ((isSame(a.x(), b.x()) && isSame(b.x(), point.x())) ||
+                (isSame(a.y(), b.y()) && isSame(b.y(), point.y()))) {
+                result.last() = point;
+                continue;
+            }
+        }
+        result.append(point);
+    }
+    return result;
+}
+
+/**
+ * Map a point from the coordinates used while calculating the layout,
+ * with the layers from top to bottom, to the requested direction.
+ *
+ * @param point    The point with x along and y across the layers.
+ * @param extent   The extent of the layout across the layers.
+ */
+QPointF LayeredLayout::mapped(const QPointF &point, qreal extent) const
+{
+    switch (m_direction) {
+    case BottomToTop:
+        return QPointF(point.x(), extent - point.y());
+    case LeftToRight:
+        return QPointF(point.y(), point.x());
+    case RightToLeft:
+        return QPointF(extent - point.y(), point.x());
+    default:
+        return point;
+    }
+}
+
+/**
+ * Rotate or mirror the layout into the requested direction, convert the
+ * node centers to top left corners and calculate the bounding rectangle.
+ */
+void LayeredLayout::applyDirection()
+{
+    const qreal extent = m_layerTop.isEmpty() ? 0 : m_layerTop.last();
+    for (int i = 0; i < m_nodes.size(); ++i) {
+        Node &node = m_nodes[i];
+        const QPointF center = mapped(node.position, extent);
+        node.position = center - QPointF(node.size.width() / 2, node.size.height() / 2);
+        const QRectF rect(node.position, node.size);
+        m_boundingRect = i == 0 ? rect : m_boundingRect.united(rect);
+    }
+    for (int e = 0; e < m_edges.size(); ++e) {
+        Edge &edge = m_edges[e];
+        for (int i = 0; i < edge.points.size(); ++i) {
+            const QPointF point = mapped(edge.points[i], extent);
+            edge.points[i] = point;
+            m_boundingRect.setCoords(qMin(m_boundingRect.left(), point.x()), qMin(m_boundingRect.top(), point.y()),
+                                     qMax(m_boundingRect.right(), point.x()), qMax(m_boundingRect.bottom(), point.y()));
+        }
+        edge.labelPosition = mapped(edge.labelPosition, extent);
+    }
+}
@@ -0,0 +1,171 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef LAYEREDLAYOUT_H
+#define LAYEREDLAYOUT_H
+
+// qt includes
+#include <QAtomicInt>
+#include <QList>
+#include <QPair>
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QString>
+#include <QVector>
+
+/**
+ * The class LayeredLayout calculates a layered (Sugiyama style) layout of
+ * a directed graph, the way dot does for the diagrams of LayoutGenerator.
+ *
+ * The graph is a snapshot of the widgets and associations of a diagram,
+ * the class does not access the scene and may therefore be run in a
+ * separate thread, see LayoutJob.
+ *
+ * The layout is calculated in the usual phases:
+ * - cycles are broken by reversing the back edges found by a depth first
+ *   search,
+ * - the nodes are assigned to layers by their longest path from a source,
+ *   edges spanning several layers get a virtual node in each layer,
+ * - the crossings between adjacent layers are reduced by barycenter sweeps,
+ * - the coordinates inside the layers are calculated by placing each node
+ *   as near as possible to its neighbours without changing the order,
+ * - the edges are routed orthogonally through the channels between the
+ *   layers, or as polylines through their virtual nodes.
+ *
+ * All coordinates are in scene units with the origin at the top left of
+ * the layout.
+ */
+class LayeredLayout
+{
+public:
+    enum Direction {
+        TopToBottom,
+        BottomToTop,
+        LeftToRight,
+        RightToLeft
+    };
+
+    enum Routing {
+        Orthogonal,
+        Polyline
+    };
+
+    struct Node {
+        QString id;
+        QSizeF size;
+        QPointF position;          ///< top left corner, set by run()
+    };
+
+    struct Edge {
+        int source;
+        int target;
+        double weight;             ///< influence on the position of the nodes
+        bool constraint;           ///< whether the edge is used for layering
+        QList<QPointF> points;     ///< from source to target, set by run()
+        QPointF labelPosition;     ///< set by run()
+    };
+
+    LayeredLayout();
+
+    void setDirection(Direction direction);
+    Direction direction() const;
+    static Direction direction(const QString &rankdir);
+
+    void setRouting(Routing routing);
+    Routing routing() const;
+
+    void setRankSeparation(qreal distance);
+    qreal rankSeparation() const;
+    void setNodeSeparation(qreal distance);
+    qreal nodeSeparation() const;
+
+    int addNode(const QString &id, const QSizeF &size);
+    int addEdge(int source, int target, double weight = 1.0, bool constraint = true);
+    void clear();
+
+    const QVector<Node>& nodes() const;
+    const QVector<Edge>& edges() const;
+
+    bool run(const QAtomicInt *cancelled = 0);
+
+    QRectF boundingRect() const;
+    int crossings() const;
+
+private:
+    /**
+     * A neighbour of a vertex in the adjacent layer.
+     */
+    struct Link {
+        int vertex;
+        double weight;
+        int edge;
+    };
+
+    /**
+     * The horizontal part of an orthogonal edge in a channel between
+     * two layers.
+     */
+    struct Segment {
+        int edge;
+        qreal left;
+        qreal right;
+        int track;
+    };
+
+    bool isCancelled() const;
+    bool isVirtual(int vertex) const;
+
+    void breakCycles();
+    void assignRanks();
+    void createVirtualVertices();
+    bool orderVertices();
+    void initialOrder();
+    void sortLayer(int layer, bool useUpper);
+    int countCrossings() const;
+    int countCrossings(int layer) const;
+    void assignCoordinates();
+    void placeLayer(int layer, int sides);
+    void routeEdges();
+    void assignPorts();
+    void assignTracks(QVector<Segment> &segments, int &tracks) const;
+    void applyDirection();
+    QPointF mapped(const QPointF &point, qreal extent) const;
+
+    qreal gap(int left, int right) const;
+    static QList<QPointF> simplified(const QList<QPointF> &points);
+
+    Direction m_direction;
+    Routing m_routing;
+    qreal m_rankSeparation;
+    qreal m_nodeSeparation;
+    QVector<Node> m_nodes;
+    QVector<Edge> m_edges;
+    QRectF m_boundingRect;
+    int m_crossings;
+
+    // state of run(), vertices are the nodes followed by the virtual nodes
+    const QAtomicInt *m_cancelled;
+    QVector<qreal> m_width;            ///< extent of a vertex along its layer
+    QVector<qreal> m_height;           ///< extent of a vertex across its layer
+    QVector<int> m_rank;
+    QVector<int> m_order;              ///< index of a vertex in its layer
+    QVector<qreal> m_x;                ///< center of a vertex along its layer
+    QVector<QVector<int> > m_layers;
+    QVector<QList<Link> > m_upper;     ///< neighbours in the layer above
+    QVector<QList<Link> > m_lower;     ///< neighbours in the layer below
+    QVector<bool> m_reversed;          ///< edges pointing upwards
+    QVector<QVector<int> > m_chains;   ///< vertices of an edge from top to bottom
+    QVector<QPair<qreal, qreal> > m_ports; ///< top and bottom port of an edge
+    QVector<qreal> m_layerTop;         ///< with the total extent as last entry
+    QVector<qreal> m_layerHeight;
+};
+
+#endif // LAYEREDLAYOUT_H
@@ -15,7 +15,9 @@
 #include "cmds.h"
 #include "debug_utils.h"
 #include "floatingtextwidget.h"
+#include "layoutjob.h"
 #include "uml.h"
+#include "umldoc.h"
 #include "umlwidget.h"
 
 // kde includes
@@ -28,9 +30,11 @@
 
 // qt includes
 #include <QDir>
+#include <QEventLoop>
 #include <QFile>
 #include <QHash>
 #include <QProcess>
+#include <QProgressDialog>
 #include <QRegExp>
 #if QT_VERSION >= 0x050000
 #include <QStandardPaths>
@@ -39,6 +43,9 @@
 #include <QTemporaryFile>
 //#include <QTextStream>
 
+// system includes
+#include <algorithm>
+
 #define LAYOUTGENERATOR_DEBUG
 //#define LAYOUTGENERATOR_DATA_DEBUG
 
@@ -75,6 +82,7 @@ static QString textViewer()
  * constructor
 */
 LayoutGenerator::LayoutGenerator()
+  : m_routed(false)
 {
     setUseFullNodeLabels(false);
 }
@@ -133,14 +141,29 @@ QString LayoutGenerator::currentDotPath()
 /**
  * generate layout and apply it to the given diagram.
  *
+ * The built-in layout generator is used unless the user prefers dot
+ * and dot has been found, or the layout asks for another generator.
+ *
  * @return true if generating succeeded
 */
 bool LayoutGenerator::generate(UMLScene *scene, const QString &variant)
 {
+    m_nodes.clear();
+    m_edges.clear();
+    m_edgeLabelPosition.clear();
+    m_routed = false;
+
+    QString diagramType = Uml::DiagramType::toString(scene->type()).toLower();
+    readConfigFile(diagramType, variant);
+    bool dotFound = isEnabled();
+    if (m_generator == QLatin1String("dot") &&
+            (!Settings::optionState().autoLayoutState.useDot || !dotFound))
+        return generateLayered(scene);
+
     QTemporaryFile in;
     QTemporaryFile out;
     QTemporaryFile xdotOut;
-    if (!isEnabled()) {
+    if (!dotFound) {
         uWarning() << "Could not apply autolayout because graphviz installation has not been found.";
         return false;
     }
@@ -203,6 +226,179 @@ bool LayoutGenerator::generate(UMLScene *scene, const QString &variant)
     return true;
 }
 
+/**
+ * Generate the layout with the built-in layout generator.
+ *
+ * The layout is calculated in a separate thread from a snapshot of the
+ * widgets and associations. A progress dialog allows to cancel the
+ * calculation of large diagrams. The result is stored in the same form
+ * as the output of dot, so that it is applied by apply().
+ *
+ * @return true if the layout has been calculated
+ */
+bool LayoutGenerator::generateLayered(UMLScene *scene)
+{
+    LayeredLayout layout;
+    setupLayout(layout);
+
+    QHash<QString, int> nodeIndex;
+    foreach(UMLWidget *widget, scene->widgetList()) {
+        if (widget->baseType() == WidgetBase::wt_Text)
+            continue;
+        QString id = fixID(Uml::ID::toString(widget->localID()));
+        nodeIndex[id] = layout.addNode(id, QSizeF(widget->width(), widget->height()));
+    }
+
+    QStringList edgeIds;
+    foreach(AssociationWidget *assoc, scene->associationList()) {
+        bool swap = isSwapped(assoc);
+        QString tail = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(swap ? Uml::RoleType::A : Uml::RoleType::B)));
+        QString head = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(swap ? Uml::RoleType::B : Uml::RoleType::A)));
+        if (!nodeIndex.contains(tail) || !nodeIndex.contains(head))
+            continue;
+        double weight;
+        bool constraint;
+        edgeParameters(assoc, weight, constraint);
+        layout.addEdge(nodeIndex[tail], nodeIndex[head], weight, constraint);
+        edgeIds.append(edgeId(assoc));
+    }
+
+    // The result is applied to the scene, so the document must not be
+    // closed or edited while the job runs: small layouts are waited for,
+    // larger ones show an application modal progress dialog.
+    LayoutJob job(layout);
+    QProgressDialog progress(i18n("Calculating layout..."), i18n("Cancel"), 0, 0, UMLApp::app());
+    progress.setWindowModality(Qt::ApplicationModal);
+    progress.setMinimumDuration(0);
+    QEventLoop loop;
+    QObject::connect(&job, SIGNAL(finished()), &loop, SLOT(quit()));
+    QObject::connect(&progress, SIGNAL(canceled()), &job, SLOT(cancel()));
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->blockClose(true);
+    job.start();
+    if (!job.wait(500)) {
+        progress.setValue(0);
+        progress.show();
+        loop.exec();
+        job.wait();
+    }
+    doc->blockClose(false);
+    if (!job.success()) {
+        uDebug() << "layout calculation has been cancelled";
+        return false;
+    }
+
+    // convert to the coordinates of dot, which are based on the
+    // bottom/left corner and the node centers
+    const LayeredLayout &result = job.layout();
+    const QRectF bounds = result.boundingRect();
+    m_boundingRect = QRectF(0, 0, bounds.width(), bounds.height());
+    foreach(const LayeredLayout::Node &node, result.nodes()) {
+        QPointF center = node.position - bounds.topLeft()
+                         + QPointF(node.size.width() / 2, node.size.height() / 2);
+        m_nodes[node.id] = QRectF(center.x(), bounds.height() - center.y(),
+                                  node.size.width(), node.size.height());
+    }
+    for (int i = 0; i < result.edges().size(); ++i) {
+        const LayeredLayout::Edge &edge = result.edges().at(i);
+        if (edge.points.isEmpty())
+            continue;
+        EdgePoints points;
+        foreach(const QPointF &p, edge.points)
+            points.append(QPointF(p.x() - bounds.left(), bounds.bottom() - p.y()));
+        m_edges[edgeIds[i]] = points;
+        m_edgeLabelPosition[edgeIds[i]] = QPointF(edge.labelPosition.x() - bounds.left(),
+                                                  bounds.bottom() - edge.labelPosition.y());
+    }
+    m_routed = true;
+    return true;
+}
+
+/**
+ * Set the direction, the distances and the routing of the built-in
+ * layout generator from the layout configure file read last.
+ * The distances of dot are given in inches.
+ */
+void LayoutGenerator::setupLayout(LayeredLayout &layout)
+{
+    QString graph = m_dotParameters.value(QLatin1String("graph"));
+    foreach(const QString &attribute, graph.split(QLatin1Char(','), QString::SkipEmptyParts)) {
+        QString key = attribute.section(QLatin1Char('='), 0, 0).trimmed();
+        QString value = attribute.section(QLatin1Char('='), 1).trimmed().remove(QLatin1Char('"'));
+        if (key == QLatin1String("rankdir"))
+            layout.setDirection(LayeredLayout::direction(value));
+        else if (key == QLatin1String("ranksep"))
+            layout.setRankSeparation(value.toDouble() * m_scale);
+        else if (key == QLatin1String("nodesep"))
+            layout.setNodeSeparation(value.toDouble() * m_scale);
+    }
+
+    if (m_configFileName.isEmpty())
+        return;
+    KDesktopFile desktopFile(m_configFileName);
+    KConfigGroup settings(&desktopFile, "X-UMBRELLO-Dot-Settings");
+    if (settings.readEntry("router", "orthogonal") == QLatin1String("polyline"))
+        layout.setRouting(LayeredLayout::Polyline);
+}
+
+/**
+ * Return the weight and the constraint attribute of the ranking
+ * parameters of an association, as used by dot.
+ *
+ * @param assoc        The association.
+ * @param weight       Is set to the weight of the edge, 1.0 by default.
+ * @param constraint   Is set to false if the edge should not be used for ranking.
+ */
+void LayoutGenerator::edgeParameters(AssociationWidget *assoc, double &weight, bool &constraint)
+{
+    weight = 1.0;
+    constraint = true;
+
+    QString type = Uml::AssociationType::toString(assoc->associationType()).toLower();
+    QString key = QLatin1String("ranking::type::") + type;
+    QString parameters;
+    if (m_edgeParameters.contains(key))
+        parameters = m_edgeParameters[key];
+    else if (m_edgeParameters.contains(QLatin1String("ranking::type::default")))
+        parameters = m_edgeParameters[QLatin1String("ranking::type::default")];
+
+    foreach(const QString &parameter, parameters.split(QLatin1Char(','), QString::SkipEmptyParts)) {
+        QString name = parameter.section(QLatin1Char('='), 0, 0).trimmed();
+        QString value = parameter.section(QLatin1Char('='), 1).trimmed().remove(QLatin1Char('"'));
+        if (name == QLatin1String("weight"))
+            weight = value.toDouble();
+        else if (name == QLatin1String("constraint"))
+            constraint = value != QLatin1String("false");
+    }
+}
+
+/**
+ * Return true if the edge of an association points from role A to role B.
+ * By default the edges point from role B to role A.
+ */
+bool LayoutGenerator::isSwapped(AssociationWidget *assoc)
+{
+    QString type = Uml::AssociationType::toString(assoc->associationType()).toLower();
+    QString key = QLatin1String("id::type::") + type;
+    if (m_edgeParameters.contains(key))
+        return m_edgeParameters[key] == QLatin1String("swap");
+    else if (m_edgeParameters.contains(QLatin1String("id::type::default")))
+        return m_edgeParameters[QLatin1String("id::type::default")] == QLatin1String("swap");
+    return false;
+}
+
+/**
+ * Return the id of the edge of an association, which is made of
+ * the ids of the widgets at the tail and the head of the edge.
+ */
+QString LayoutGenerator::edgeId(AssociationWidget *assoc)
+{
+    if (isSwapped(assoc))
+        return fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::A)) + Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::B)));
+    else
+        return fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::B)) + Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::A)));
+}
+
 /**
  * apply auto layout to the given scene
  * @param scene
@@ -212,14 +408,7 @@ bool LayoutGenerator::apply(UMLScene *scene)
 {
     foreach(AssociationWidget *assoc, scene->associationList()) {
         AssociationLine *path = assoc->associationLine();
-        QString type = Uml::AssociationType::toString(assoc->associationType()).toLower();
-        QString key = QLatin1String("type::") + type;
-
-        QString id;
-        if (m_edgeParameters.contains(QLatin1String("id::") + key) && m_edgeParameters[QLatin1String("id::") + key] == QLatin1String("swap"))
-            id = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::A)) + Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::B)));
-        else
-            id = fixID(Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::B)) + Uml::ID::toString(assoc->widgetLocalIDForRole(Uml::RoleType::A)));
+        QString id = edgeId(assoc);
 
         // adjust associations not used in the dot file
         if (!m_edges.contains(id)) {
@@ -274,7 +463,22 @@ bool LayoutGenerator::apply(UMLScene *scene)
     UMLApp::app()->endMacro();
 
     foreach(AssociationWidget *assoc, scene->associationList()) {
-        assoc->calculateEndingPoints();
+        QString id = edgeId(assoc);
+        if (m_routed && m_edges.contains(id)) {
+            // the edge points run from tail to head, the association
+            // line from role A to role B
+            EdgePoints p = m_edges[id];
+            if (!isSwapped(assoc))
+                std::reverse(p.begin(), p.end());
+            AssociationLine *path = assoc->associationLine();
+            while(path->count() > 2)
+                path->removePoint(1);
+            path->setEndPoints(mapToScene(p.first()), mapToScene(p.last()));
+            for(int i = 1; i < p.size() - 1; i++)
+                path->insertPoint(i, mapToScene(p[i]));
+        } else {
+            assoc->calculateEndingPoints();
+        }
         if (assoc->associationLine())
             assoc->associationLine()->update();
         assoc->resetTextPositions();
@@ -11,18 +11,28 @@
 #ifndef LAYOUTGENERATOR_H
 
 #include "dotgenerator.h"
+#include "layeredlayout.h"
 #include "optionstate.h"
 
 //// qt includes
 #include <QRectF>
 
+class AssociationWidget;
+
 /**
  * The class LayoutGenerator provides calculated layouts of diagrams.
  *
- * It uses the dot executable from the graphviz package for calculation
- * of widget positions.
+ * The widget positions are calculated by the built-in LayeredLayout, or by
+ * the dot executable from the graphviz package if the user prefers it or
+ * the layout asks for another graphviz generator.
+ *
+ * The built-in layout is calculated in a separate thread from a snapshot
+ * of the displayed widgets and associations. It uses the attributes of
+ * the same layout configure file as dot (rankdir, ranksep, nodesep and the
+ * edge weights) and routes the associations orthogonally, unless the
+ * entry router=polyline is found in the X-UMBRELLO-Dot-Settings group.
  *
- * The implementation calls dot with information from the displayed
+ * The dot implementation calls dot with information from the displayed
  * widgets and associations by creating a temporary dot file based on a
  * layout configure file, which is located in the umbrello/layouts subdir of
  * the "data" resource type. The config file is determined from the
@@ -57,11 +67,18 @@ public:
     QPointF mapToScene(const QPointF &p);
 
 protected:
+    bool generateLayered(UMLScene *scene);
+    void setupLayout(LayeredLayout &layout);
+    void edgeParameters(AssociationWidget *assoc, double &weight, bool &constraint);
+    bool isSwapped(AssociationWidget *assoc);
+    QString edgeId(AssociationWidget *assoc);
+
     QRectF m_boundingRect;
     NodeType m_nodes;      ///< list of nodes found in parsed dot file
     EdgeType m_edges;      ///< list of edges found in parsed dot file
     QHash<QString, QPointF> m_edgeLabelPosition; ///< contains global node parameters
     QString m_dotPath;     ///< contains path to dot executable
+    bool m_routed;         ///< the edges contain all points of the association lines
 
     friend QDebug operator<<(QDebug out, LayoutGenerator &c);
 };
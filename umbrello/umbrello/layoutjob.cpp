@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "layoutjob.h"
+
+/**
+ * Constructor.
+ *
+ * @param layout   The graph to be laid out.
+ * @param parent   Parent object for QThread constructor.
+ */
+LayoutJob::LayoutJob(const LayeredLayout &layout, QObject *parent)
+  : QThread(parent),
+    m_layout(layout),
+    m_cancelled(0),
+    m_success(false)
+{
+}
+
+/**
+ * Return the calculated layout. Valid after the job has finished.
+ */
+const LayeredLayout &LayoutJob::layout() const
+{
+    return m_layout;
+}
+
+/**
+ * Return whether the layout has been calculated completely.
+ * Valid after the job has finished.
+ */
+bool LayoutJob::success() const
+{
+    return m_success;
+}
+
+/**
+ * Stop the calculation, may be called from any thread.
+ */
+void LayoutJob::cancel()
+{
+#if QT_VERSION >= 0x050000
+    m_cancelled.store(1);
+#else
+    m_cancelled = 1;
+#endif
+}
+
+/**
+ * Calculate the layout.
+ */
+void LayoutJob::run()
+{
+    m_success = m_layout.run(&m_cancelled);
+}
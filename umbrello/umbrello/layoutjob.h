@@ -0,0 +1,52 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef LAYOUTJOB_H
+#define LAYOUTJOB_H
+
+#include "layeredlayout.h"
+
+#include <QAtomicInt>
+#include <QThread>
+
+/**
+ * This class calculates a LayeredLayout in a separate thread.
+ *
+ * The layout is a snapshot of a diagram created in the GUI thread, the
+ * result is read with layout() after the thread has finished and applied
+ * to the diagram in the GUI thread again. The calculation may be stopped
+ * with cancel() at any time.
+ *
+ * @short Calculates a diagram layout in a separate thread
+ * Bugs and comments to umbrello-devel@kde.org or http://bugs.kde.org
+ */
+class LayoutJob : public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit LayoutJob(const LayeredLayout &layout, QObject *parent = 0);
+
+    const LayeredLayout &layout() const;
+    bool success() const;
+
+public slots:
+    void cancel();
+
+protected:
+    void run();
+
+private:
+    LayeredLayout m_layout;
+    QAtomicInt m_cancelled;
+    bool m_success;
+};
+
+#endif
@@ -1163,29 +1163,23 @@ void ListPopupMenu::insertLayoutItems(UMLView *view)
           << mt_Apply_Layout4 << mt_Apply_Layout5
           << mt_Apply_Layout6 << mt_Apply_Layout7
           << mt_Apply_Layout8 << mt_Apply_Layout9;
-    LayoutGenerator generator;
-    if (generator.isEnabled()) {
-        QHash<QString, QString> configFiles;
-        if (LayoutGenerator::availableConfigFiles(view->umlScene(), configFiles)) {
-            int i = 0;
-            foreach(const QString &key, configFiles.keys()) { // krazy:exclude=foreach
-                if (i >= types.size())
-                    break;
-                if (key == QLatin1String("export") &&
-                        !Settings::optionState().autoLayoutState.showExportLayout)
-                    continue;
-                insert(types[i], QPixmap(), i18n("apply '%1'", configFiles[key]));
-                QAction* action = getAction(types[i]);
-                QMap<QString, QVariant> map = action->data().toMap();
-                map[toString(dt_ApplyLayout)] = QVariant(key);
-                action->setData(QVariant(map));
-                i++;
-            }
-            addSeparator();
+    QHash<QString, QString> configFiles;
+    if (LayoutGenerator::availableConfigFiles(view->umlScene(), configFiles)) {
+        int i = 0;
+        foreach(const QString &key, configFiles.keys()) { // krazy:exclude=foreach
+            if (i >= types.size())
+                break;
+            if (key == QLatin1String("export") &&
+                    !Settings::optionState().autoLayoutState.showExportLayout)
+                continue;
+            insert(types[i], QPixmap(), i18n("apply '%1'", configFiles[key]));
+            QAction* action = getAction(types[i]);
+            QMap<QString, QVariant> map = action->data().toMap();
+            map[toString(dt_ApplyLayout)] = QVariant(key);
+            action->setData(QVariant(map));
+            i++;
         }
-    }
-    else {
-        uWarning() << "Could not add autolayout entries because graphviz installation has not been found.";
+        addSeparator();
     }
 }
 
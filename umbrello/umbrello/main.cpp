@@ -13,9 +13,12 @@
 #include "uml.h"
 #include "version.h"
 #include "umldoc.h"
+#include "optionstate.h"
 #include "cmdlineexportallviewsevent.h"
 #include "umlviewimageexportermodel.h"
 #include "umbrellosettings.h"
+#include "umlfindindex.h"
+#include "umlobject.h"
 
 // kde includes
 #include <kaboutdata.h>
@@ -89,14 +92,28 @@ void exportAllViews(QCommandLineParser *parser, const QStringList &exportOpt);
 void exportAllViews(KCmdLineArgs *args, const QStringList &exportOpt);
 #endif
 
+/**
+ * Print the objects of the document matching the given text, one per line
+ * with their type and the diagrams they are shown on, using the find index
+ * of the document.
+ *
+ * @param text The text or regular expression to search for.
+ * @param mode "substring", "prefix" or "regexp".
+ * @return The exit code of the application.
+ */
+int findInModel(const QString &text, const QString &mode);
+
 #if QT_VERSION >= 0x050000
 static const QString URL            = QStringLiteral("url");
 static const QString EXPORT         = QStringLiteral("export");
 static const QString EXPORT_FORMATS = QStringLiteral("export-formats");
 static const QString IMPORT_FILES   = QStringLiteral("import-files");
+static const QString PARALLEL_IMPORT = QStringLiteral("parallel-import");
 static const QString USE_FOLDERS    = QStringLiteral("use-folders");
 static const QString DIRECTORY      = QStringLiteral("directory");
 static const QString LANGUAGES      = QStringLiteral("languages");
+static const QString FIND           = QStringLiteral("find");
+static const QString FIND_MODE      = QStringLiteral("find-mode");
 #endif
 
 int main(int argc, char *argv[])
@@ -157,8 +174,14 @@ int main(int argc, char *argv[])
                 QCommandLineOption(DIRECTORY, i18n("The local directory to save the exported diagrams in.")));
     args->addOption(
                 QCommandLineOption(IMPORT_FILES, i18n("Import files.")));
+    args->addOption(
+                QCommandLineOption(PARALLEL_IMPORT, i18n("Parse the imported files in parallel.")));
     args->addOption(
                 QCommandLineOption(USE_FOLDERS, i18n("Keep the tree structure used to store the views in the document in the target directory.")));
+    args->addOption(
+                QCommandLineOption(FIND, i18n("Print the objects of the model matching the text and exit."), QStringLiteral("text")));
+    args->addOption(
+                QCommandLineOption(FIND_MODE, i18n("How the text of --find is compared: substring, prefix or regexp."), QStringLiteral("mode")));
     aboutData.setupCommandLine(args);
 
     args->process(app);
@@ -172,8 +195,11 @@ int main(int argc, char *argv[])
     options.add("export-formats", ki18n("list available export extensions"));
     options.add("directory <url>", ki18n("the local directory to save the exported diagrams in"), I18N_NOOP("the directory of the file"));
     options.add("import-files", ki18n("import files"));
+    options.add("parallel-import", ki18n("parse the imported files in parallel"));
     options.add("languages", ki18n("list supported languages"));
     options.add("use-folders", ki18n("keep the tree structure used to store the views in the document in the target directory"));
+    options.add("find <text>", ki18n("print the objects of the model matching the text and exit"));
+    options.add("find-mode <mode>", ki18n("how the text of --find is compared: substring, prefix or regexp"), "substring");
     KCmdLineArgs::addCmdLineOptions(options); // Add our own options.
     KApplication app;
 #endif
@@ -215,6 +241,9 @@ int main(int argc, char *argv[])
         if (args->isSet(IMPORT_FILES)) {
             QStringList importList = args->values(IMPORT_FILES);
             if (importList.size() > 0) {
+                if (args->isSet(PARALLEL_IMPORT)) {
+                    Settings::optionState().codeImportState.parallelImport = true;
+                }
                 uml->newDocument();
                 uml->importFiles(&importList);
             }
@@ -224,6 +253,9 @@ int main(int argc, char *argv[])
             QStringList importList;
             for (int i = 0; i < args->count(); i++)
                 importList.append(args->url(i).toLocalFile());
+            if (args->isSet("parallel-import")) {
+                Settings::optionState().codeImportState.parallelImport = true;
+            }
             uml->newDocument();
             uml->importFiles(&importList);
         }
@@ -231,6 +263,16 @@ int main(int argc, char *argv[])
         else
             initDocument(args);
 
+#if QT_VERSION >= 0x050000
+        if (args->isSet(FIND)) {
+            int result = findInModel(args->value(FIND), args->value(FIND_MODE));
+#else
+        if (args->isSet("find")) {
+            int result = findInModel(args->getOption("find"), args->getOption("find-mode"));
+#endif
+            delete uml;
+            return result;
+        }
 
         // export option
 #if QT_VERSION >= 0x050000
@@ -250,7 +292,7 @@ int main(int argc, char *argv[])
 #if QT_VERSION >= 0x050000
 bool showGUI(QCommandLineParser *parser)
 {
-    if (parser->isSet(EXPORT) || parser->isSet(EXPORT_FORMATS)) {
+    if (parser->isSet(EXPORT) || parser->isSet(EXPORT_FORMATS) || parser->isSet(FIND)) {
         return false;
     }
     return true;
@@ -299,7 +341,7 @@ void exportAllViews(QCommandLineParser *parser, const QStringList &exportOpt)
 #else
 bool showGUI(KCmdLineArgs *args)
 {
-    if (args->getOptionList("export").size() > 0 || args->isSet("export-formats")) {
+    if (args->getOptionList("export").size() > 0 || args->isSet("export-formats") || args->isSet("find")) {
         return false;
     }
     return true;
@@ -345,3 +387,34 @@ void exportAllViews(KCmdLineArgs *args, const QStringList &exportOpt)
     kapp->postEvent(UMLApp::app(), new CmdLineExportAllViewsEvent(extension, directory, useFolders));
 }
 #endif
+
+int findInModel(const QString &text, const QString &mode)
+{
+    UMLFinder::Mode findMode = UMLFinder::Substring;
+    if (mode == QLatin1String("prefix")) {
+        findMode = UMLFinder::Prefix;
+    } else if (mode == QLatin1String("regexp")) {
+        findMode = UMLFinder::RegExp;
+    } else if (!mode.isEmpty() && mode != QLatin1String("substring")) {
+        fprintf(stderr, "%s\n", qPrintable(i18n("Unknown find mode: %1", mode)));
+        return 1;
+    }
+
+    UMLDoc *doc = UMLApp::app()->document();
+    QHash<QString, QString> viewNames;
+    typedef QPair<Uml::ID::Type, QString> ViewName;
+    foreach (const ViewName &viewName, doc->viewNames()) {
+        viewNames.insert(Uml::ID::toString(viewName.first), viewName.second);
+    }
+    UMLFindIndex *index = doc->findIndex();
+    const int fields = UMLFinder::Names | UMLFinder::Stereotypes | UMLFinder::Documentation;
+    foreach (UMLObject *o, index->find(text, findMode, fields)) {
+        QStringList diagrams;
+        foreach (const Uml::ID::Type &id, index->diagrams(o)) {
+            diagrams.append(viewNames.value(Uml::ID::toString(id)));
+        }
+        fprintf(stdout, "%s\t%s\t%s\n", qPrintable(o->fullyQualifiedName()),
+                qPrintable(QString(o->baseTypeStr())), qPrintable(diagrams.join(QLatin1String(", "))));
+    }
+    return 0;
+}
@@ -34,6 +34,7 @@
 #include "umlscene.h"
 #include "umlview.h"
 #include "codegenerator.h"
+#include "keywordtable.h"
 
 // kde includes
 #include <KLocalizedString>
@@ -559,27 +560,15 @@ bool isCommonXMIAttribute(const QString &tag)
 }
 
 /**
- * Return true if the given type is common among the majority
- * of programming languages, such as "bool" or "boolean".
- * TODO: Make this depend on the active programming language.
+ * Return true if the given type is a default datatype of the
+ * active programming language, such as "bool" or "boolean".
  */
 bool isCommonDataType(QString type)
 {
-    CodeGenerator *gen = UMLApp::app()->generator();
-    if (gen == NULL)
+    if (UMLApp::app()->generator() == NULL)
         return false;
-    const bool caseSensitive = UMLApp::app()->activeLanguageIsCaseSensitive();
-    const QStringList dataTypes = gen->defaultDatatypes();
-    QStringList::ConstIterator end(dataTypes.end());
-    for (QStringList::ConstIterator it = dataTypes.begin(); it != end; ++it) {
-        if (caseSensitive) {
-            if (type == *it)
-                return true;
-        } else if (type.toLower() == (*it).toLower()) {
-            return true;
-        }
-    }
-    return false;
+    const Uml::ProgrammingLanguage::Enum language = UMLApp::app()->activeLanguage();
+    return Uml::ProgrammingLanguage::defaultDatatypes(language).contains(type);
 }
 
 /**
@@ -130,6 +130,8 @@ namespace Settings {
     {
         element.setAttribute(QLatin1String("createartifacts"), createArtifacts);
         element.setAttribute(QLatin1String("resolvedependencies"), resolveDependencies);
+        element.setAttribute(QLatin1String("parallelimport"), parallelImport);
+        element.setAttribute(QLatin1String("parsecache"), parseCache);
     }
 
     /**
@@ -144,6 +146,10 @@ namespace Settings {
         createArtifacts = (bool)temp.toInt();
         temp = element.attribute(QLatin1String("resolvedependencies"), QLatin1String("0"));
         resolveDependencies = (bool)temp.toInt();
+        temp = element.attribute(QLatin1String("parallelimport"), QLatin1String("0"));
+        parallelImport = (bool)temp.toInt();
+        temp = element.attribute(QLatin1String("parsecache"), QLatin1String("0"));
+        parseCache = (bool)temp.toInt();
 
         return true;
     }
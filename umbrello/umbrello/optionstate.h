@@ -35,6 +35,7 @@ class GeneralState {
 public:
     GeneralState()
       : undo(false),
+        undoMemoryBudget(32),
         tabdiagrams(false),
         newcodegen(false),
         angularlines(false),
@@ -50,6 +51,7 @@ public:
     }
 
     bool undo;
+    int undoMemoryBudget;    ///< MiB the undo history may keep in memory
     bool tabdiagrams;
     bool newcodegen;
     bool angularlines;
@@ -141,7 +143,9 @@ public:
         lineEndingType(CodeGenerationPolicy::UNIX),
 #endif
         modnamePolicy(CodeGenerationPolicy::No),
-        overwritePolicy(CodeGenerationPolicy::Ok)
+        overwritePolicy(CodeGenerationPolicy::Ok),
+        parallelGeneration(false),
+        incrementalGeneration(false)
     {
     }
 
@@ -159,6 +163,8 @@ public:
     CodeGenerationPolicy::ModifyNamePolicy modnamePolicy;
     QDir outputDirectory;
     CodeGenerationPolicy::OverwritePolicy overwritePolicy;
+    bool parallelGeneration;
+    bool incrementalGeneration;
 
     class CPPCodeGenerationState {
     public:
@@ -239,7 +245,9 @@ class CodeImportState {
 public:
     CodeImportState()
       : createArtifacts(false),
-        resolveDependencies(false)
+        resolveDependencies(false),
+        parallelImport(false),
+        parseCache(false)
     {
     }
 
@@ -248,13 +256,16 @@ public:
 
     bool createArtifacts;
     bool resolveDependencies;
+    bool parallelImport;
+    bool parseCache;
 };
 
 class AutoLayoutState {
 public:
     AutoLayoutState()
      : autoDotPath(false),
-       showExportLayout(false)
+       showExportLayout(false),
+       useDot(false)
     {
     }
 
@@ -264,6 +275,7 @@ public:
     bool autoDotPath;  ///< determine path to dot executable automatically
     QString dotPath;  ///< path to dot executable
     bool showExportLayout;  ///< flag for display export layout
+    bool useDot;  ///< use dot instead of the built-in layout generator
 };
 
 class OptionState {
@@ -0,0 +1,223 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "pngstreamwriter.h"
+
+// qt includes
+#include <QIODevice>
+
+// system includes
+#include <zlib.h>
+
+/**
+ * Size of the output buffer of the compressor and minimum size of the
+ * IDAT chunks written, except for the last one.
+ */
+static const int BufferSize = 64 * 1024;
+
+/**
+ * Append a 32 bit value in network byte order.
+ */
+static void appendUInt32(QByteArray &data, quint32 value)
+{
+    data.append(char((value >> 24) & 0xff));
+    data.append(char((value >> 16) & 0xff));
+    data.append(char((value >> 8) & 0xff));
+    data.append(char(value & 0xff));
+}
+
+/**
+ * Constructor.
+ *
+ * @param device   The open device the image is written to.
+ */
+PngStreamWriter::PngStreamWriter(QIODevice &device)
+  : m_device(device),
+    m_stream(0),
+    m_width(0),
+    m_height(0),
+    m_rows(0),
+    m_ok(false)
+{
+}
+
+/**
+ * Destructor, releases the compressor.
+ */
+PngStreamWriter::~PngStreamWriter()
+{
+    if (m_stream) {
+        deflateEnd(m_stream);
+        delete m_stream;
+    }
+}
+
+/**
+ * Write the PNG signature and the image header.
+ *
+ * @param width    The width of the image in pixels.
+ * @param height   The height of the image in pixels.
+ * @return  True if the header was written.
+ */
+bool PngStreamWriter::writeHeader(int width, int height)
+{
+    if (width <= 0 || height <= 0 || m_stream) {
+        return false;
+    }
+    m_width = width;
+    m_height = height;
+    m_stream = new z_stream;
+    m_stream->zalloc = Z_NULL;
+    m_stream->zfree = Z_NULL;
+    m_stream->opaque = Z_NULL;
+    if (deflateInit(m_stream, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        delete m_stream;
+        m_stream = 0;
+        return false;
+    }
+    m_row.resize(1 + 3 * width);
+
+    static const char signature[] = { char(137), 'P', 'N', 'G', '\r', '\n', char(26), '\n' };
+    m_ok = m_device.write(signature, sizeof(signature)) == sizeof(signature);
+
+    QByteArray header;
+    appendUInt32(header, width);
+    appendUInt32(header, height);
+    header.append(char(8));  // bit depth
+    header.append(char(2));  // color type RGB
+    header.append(char(0));  // compression method deflate
+    header.append(char(0));  // filter method
+    header.append(char(0));  // no interlace
+    return writeChunk("IHDR", header);
+}
+
+/**
+ * Write the next band of rows.
+ *
+ * @param tiles   The tiles of the band from left to right. All tiles
+ *                have the same height, their widths add up to the width
+ *                of the image.
+ * @return  True if the rows were written.
+ */
+bool PngStreamWriter::writeRows(const QVector<QImage> &tiles)
+{
+    if (!m_ok || tiles.isEmpty()) {
+        return false;
+    }
+    const int height = tiles.first().height();
+    int width = 0;
+    QVector<QImage> rgbTiles;
+    rgbTiles.reserve(tiles.count());
+    foreach (const QImage &tile, tiles) {
+        if (tile.height() != height) {
+            return false;
+        }
+        width += tile.width();
+        rgbTiles.append(tile.convertToFormat(QImage::Format_RGB32));
+    }
+    if (width != m_width || m_rows + height > m_height) {
+        return false;
+    }
+
+    char *row = m_row.data();
+    for (int y = 0; y < height; ++y) {
+        int offset = 0;
+        row[offset++] = 0;  // filter type None
+        foreach (const QImage &tile, rgbTiles) {
+            const QRgb *line = reinterpret_cast<const QRgb*>(tile.constScanLine(y));
+            for (int x = 0; x < tile.width(); ++x) {
+                row[offset++] = char(qRed(line[x]));
+                row[offset++] = char(qGreen(line[x]));
+                row[offset++] = char(qBlue(line[x]));
+            }
+        }
+        if (!compress(row, m_row.size(), false)) {
+            return false;
+        }
+    }
+    m_rows += height;
+    return true;
+}
+
+/**
+ * Flush the compressor and write the end of the image. All rows of the
+ * image must have been written.
+ *
+ * @return  True if the complete image was written.
+ */
+bool PngStreamWriter::finish()
+{
+    if (!m_ok || m_rows != m_height) {
+        return false;
+    }
+    return compress(0, 0, true) && writeChunk("IEND", QByteArray());
+}
+
+/**
+ * Pass data to the compressor and write the compressed data as IDAT
+ * chunks of at least BufferSize bytes.
+ *
+ * @param data   The data to compress.
+ * @param size   The size of the data.
+ * @param last   Whether to flush the compressor at the end of the image.
+ */
+bool PngStreamWriter::compress(const char *data, int size, bool last)
+{
+    char buffer[BufferSize];
+    m_stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    m_stream->avail_in = size;
+    int result;
+    do {
+        m_stream->next_out = reinterpret_cast<Bytef*>(buffer);
+        m_stream->avail_out = BufferSize;
+        result = deflate(m_stream, last ? Z_FINISH : Z_NO_FLUSH);
+        if (result == Z_STREAM_ERROR) {
+            m_ok = false;
+            return false;
+        }
+        m_compressed.append(buffer, BufferSize - m_stream->avail_out);
+        if (m_compressed.size() >= BufferSize) {
+            if (!writeChunk("IDAT", m_compressed)) {
+                return false;
+            }
+            m_compressed.clear();
+        }
+    } while (m_stream->avail_out == 0 || (last && result != Z_STREAM_END));
+
+    if (last && !m_compressed.isEmpty()) {
+        if (!writeChunk("IDAT", m_compressed)) {
+            return false;
+        }
+        m_compressed.clear();
+    }
+    return true;
+}
+
+/**
+ * Write a chunk with its length and checksum.
+ *
+ * @param type   The four letter type of the chunk.
+ * @param data   The contents of the chunk.
+ */
+bool PngStreamWriter::writeChunk(const char *type, const QByteArray &data)
+{
+    QByteArray chunk;
+    chunk.reserve(12 + data.size());
+    appendUInt32(chunk, data.size());
+    chunk.append(type, 4);
+    chunk.append(data);
+    const uLong crc = crc32(0L, reinterpret_cast<const Bytef*>(chunk.constData() + 4), 4 + data.size());
+    appendUInt32(chunk, crc);
+    if (m_device.write(chunk) != chunk.size()) {
+        m_ok = false;
+    }
+    return m_ok;
+}
@@ -0,0 +1,57 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef PNGSTREAMWRITER_H
+#define PNGSTREAMWRITER_H
+
+// qt includes
+#include <QByteArray>
+#include <QImage>
+#include <QVector>
+
+class QIODevice;
+struct z_stream_s;
+
+/**
+ * The PngStreamWriter writes a PNG image whose rows are passed in bands,
+ * so that the complete image never has to be held in memory.
+ *
+ * After writeHeader() the rows of the image are passed from top to bottom
+ * with writeRows(), each band as a list of tiles which are placed side by
+ * side. The rows are compressed as they arrive and written as IDAT chunks;
+ * finish() flushes the compressor and closes the image.
+ *
+ * The image is written as 8 bit RGB without alpha channel.
+ */
+class PngStreamWriter
+{
+public:
+    explicit PngStreamWriter(QIODevice &device);
+    ~PngStreamWriter();
+
+    bool writeHeader(int width, int height);
+    bool writeRows(const QVector<QImage> &tiles);
+    bool finish();
+
+private:
+    bool compress(const char *data, int size, bool last);
+    bool writeChunk(const char *type, const QByteArray &data);
+
+    QIODevice &m_device;
+    z_stream_s *m_stream;
+    QByteArray m_row;         ///< the filter byte and pixels of one row
+    QByteArray m_compressed;  ///< compressed data not written yet
+    int m_width;
+    int m_height;
+    int m_rows;               ///< number of rows written so far
+    bool m_ok;
+};
+
+#endif
@@ -829,6 +829,7 @@ DEBUG(DBG_SRC) << "acceptProposedAction";  //:TODO:fischer
             KMessageBox::error(this, msg, i18n("Operation Name Invalid"), 0);
             return;
         }
+        m_doc->beginChangeBatch();
         UMLOperation* newOp = static_cast<UMLOperation*>(op->clone());
 
         UMLClassifier *oldClassifier = dynamic_cast<UMLClassifier*>(op->parent());
@@ -839,6 +840,7 @@ DEBUG(DBG_SRC) << "acceptProposedAction";  //:TODO:fischer
 
         newClassifier->addOperation(newOp);
         m_doc->signalUMLObjectCreated(newOp);  //:TODO: really?
+        m_doc->commitChangeBatch();
     }
     else if (t == UMLObject::ot_Attribute) {
         DEBUG(DBG_SRC) << "Moving attribute";
@@ -850,6 +852,7 @@ DEBUG(DBG_SRC) << "acceptProposedAction";  //:TODO:fischer
             KMessageBox::error(this, msg, i18n("Attribute Name Invalid"), 0);
             return;
         }
+        m_doc->beginChangeBatch();
         UMLAttribute* newAtt = static_cast<UMLAttribute*>(att->clone());
 
         UMLClassifier *oldClassifier = dynamic_cast<UMLClassifier*>(att->parent());
@@ -860,6 +863,7 @@ DEBUG(DBG_SRC) << "acceptProposedAction";  //:TODO:fischer
 
         newClassifier->addAttribute(newAtt);
         m_doc->signalUMLObjectCreated(newAtt);  //:TODO: really?
+        m_doc->commitChangeBatch();
     }
 //    emit moved();
     refactor(m_umlObject);  //:TODO:fischer
@@ -31,6 +31,7 @@
 // code generation
 #include "advancedcodegenerator.h"
 #include "codegenerationpolicy.h"
+#include "codegenerationrecord.h"
 #include "codegenfactory.h"
 #include "codegenpolicyext.h"
 #include "simplecodegenerator.h"
@@ -1043,6 +1044,7 @@ void UMLApp::saveOptions()
     Settings::OptionState& optionState = Settings::optionState();
 
     UmbrelloSettings::setUndo(optionState.generalState.undo);
+    UmbrelloSettings::setUndoMemoryBudget(optionState.generalState.undoMemoryBudget);
     UmbrelloSettings::setTabdiagrams(optionState.generalState.tabdiagrams);
     UmbrelloSettings::setNewcodegen(optionState.generalState.newcodegen);
     UmbrelloSettings::setAngularlines(optionState.generalState.angularlines);
@@ -1050,6 +1052,7 @@ void UMLApp::saveOptions()
     UmbrelloSettings::setAutoDotPath(optionState.autoLayoutState.autoDotPath);
     UmbrelloSettings::setDotPath(optionState.autoLayoutState.dotPath);
     UmbrelloSettings::setShowExportLayout(optionState.autoLayoutState.showExportLayout);
+    UmbrelloSettings::setUseDot(optionState.autoLayoutState.useDot);
     UmbrelloSettings::setAutosave(optionState.generalState.autosave);
     UmbrelloSettings::setTime(optionState.generalState.time);
     UmbrelloSettings::setAutosavetime(optionState.generalState.autosavetime);
@@ -1148,6 +1151,8 @@ void UMLApp::saveOptions()
 
     UmbrelloSettings::setCreateArtifacts(optionState.codeImportState.createArtifacts);
     UmbrelloSettings::setResolveDependencies(optionState.codeImportState.resolveDependencies);
+    UmbrelloSettings::setParallelImport(optionState.codeImportState.parallelImport);
+    UmbrelloSettings::setParseCache(optionState.codeImportState.parseCache);
 
 #if QT_VERSION >= 0x050000
     UmbrelloSettings::self()->save();
@@ -1261,6 +1266,9 @@ void UMLApp::readProperties(const KConfigGroup & cfg)     //:TODO: applyMainWind
  */
 bool UMLApp::queryClose()
 {
+    if (m_doc->isCloseBlocked()) {
+        return false;
+    }
     if (m_doc->saveModified()) {
         saveOptions();
         m_doc->closeDocument();
@@ -1478,7 +1486,8 @@ void UMLApp::slotFind()
         return;
     }
 
-    int count = m_d->findResults.collect(m_d->findDialog.filter(), m_d->findDialog.category(), m_d->findDialog.text());
+    int count = m_d->findResults.collect(m_d->findDialog.filter(), m_d->findDialog.category(), m_d->findDialog.text(),
+                                         m_d->findDialog.mode(), m_d->findDialog.fields());
 
     UMLApp::app()->document()->writeToStatusBar(i18n("'%1': %2 found", m_d->findDialog.text(), count));
     slotFindNext();
@@ -2078,7 +2087,7 @@ void UMLApp::slotApplyPrefs()
         if (stackBrowsing != tabBrowsing) {
             // Diagram Representation Modified
             UMLView* currentView;
-            UMLViewList views = m_doc->viewIterator();
+            UMLViewList views = m_doc->loadedViews();
 
             if (tabBrowsing) {
                 currentView = static_cast<UMLView*>(m_viewStack->currentWidget());
@@ -2159,6 +2168,7 @@ bool UMLApp::isUndoEnabled()
 void UMLApp::enableUndo(bool enable)
 {
     m_undoEnabled = enable;
+    Uml::XMISnapshot::setMemoryBudget(qint64(Settings::optionState().generalState.undoMemoryBudget) * 1024 * 1024);
     editRedo->setVisible(enable);
     editUndo->setVisible(enable);
     viewShowCmdHistory->setVisible(enable);
@@ -2252,6 +2262,7 @@ void UMLApp::readOptionState()
     UmbrelloSettings::self()->readConfig();
 #endif
     optionState.generalState.undo = UmbrelloSettings::undo();
+    optionState.generalState.undoMemoryBudget = UmbrelloSettings::undoMemoryBudget();
     optionState.generalState.tabdiagrams = UmbrelloSettings::tabdiagrams();
 #ifdef ENABLE_NEW_CODE_GENERATORS
     optionState.generalState.newcodegen = UmbrelloSettings::newcodegen();
@@ -2262,6 +2273,7 @@ void UMLApp::readOptionState()
     optionState.autoLayoutState.autoDotPath =  UmbrelloSettings::autoDotPath();
     optionState.autoLayoutState.dotPath =  UmbrelloSettings::dotPath();
     optionState.autoLayoutState.showExportLayout =  UmbrelloSettings::showExportLayout();
+    optionState.autoLayoutState.useDot =  UmbrelloSettings::useDot();
     optionState.generalState.autosave =  UmbrelloSettings::autosave();
     optionState.generalState.time =  UmbrelloSettings::time(); //old autosavetime value kept for compatibility
     optionState.generalState.autosavetime =  UmbrelloSettings::autosavetime();
@@ -2349,6 +2361,8 @@ void UMLApp::readOptionState()
     // code importer options
     optionState.codeImportState.createArtifacts = UmbrelloSettings::createArtifacts();
     optionState.codeImportState.resolveDependencies = UmbrelloSettings::resolveDependencies();
+    optionState.codeImportState.parallelImport = UmbrelloSettings::parallelImport();
+    optionState.codeImportState.parseCache = UmbrelloSettings::parseCache();
 
     // general config options will be read when created
 }
@@ -2370,6 +2384,8 @@ void UMLApp::viewCodeDocument(UMLClassifier* classifier)
                 Settings::OptionState& optionState = Settings::optionState();
                 CodeViewerDialog * dialog = generator->getCodeViewerDialog(this, cdoc, optionState.codeViewerState);
                 dialog->exec();
+                // the code may have been edited, write it with the next run
+                generator->generationRecord()->invalidate(cdoc);
                 optionState.codeViewerState = dialog->state();
                 delete dialog;
                 dialog = NULL;
@@ -2807,13 +2823,28 @@ void UMLApp::slotUpdateViews()
 
     menu->clear();
 
-    UMLViewList views = m_doc->viewIterator();
+    // diagrams which have not been loaded yet are only listed
+    typedef QPair<Uml::ID::Type, QString> ViewName;
+    foreach (const ViewName &name, m_doc->viewNames()) {
+        QAction *action = menu->addAction(name.second);
+        action->setData(Uml::ID::toString(name.first));
+    }
+    connect(menu, SIGNAL(triggered(QAction*)), this, SLOT(slotShowView(QAction*)), Qt::UniqueConnection);
+
+    UMLViewList views = m_doc->loadedViews();
     foreach (UMLView *view, views) {
-        menu->addAction(view->umlScene()->name(), view->umlScene(), SLOT(slotShowView()));
         view->umlScene()->fileLoaded();
     }
 }
 
+/**
+ * Show the diagram of an action of the "show_view" menu.
+ */
+void UMLApp::slotShowView(QAction* action)
+{
+    m_doc->changeCurrentView(Uml::ID::fromString(action->data().toString()));
+}
+
 /**
  * Import the source files that are in fileList.
  */
@@ -3004,6 +3035,10 @@ void UMLApp::slotCloseDiagram(int index)
         }
         m_tabWidget->removeTab(index);
         view->umlScene()->setIsOpen(false);
+        // a closed diagram is loaded again when it is shown
+        if (m_doc->lazyDiagramLoad()) {
+            m_doc->unloadView(view);
+        }
     }
 }
 #else
@@ -3020,6 +3055,10 @@ void UMLApp::slotCloseDiagram(QWidget* tab)
         }
         m_tabWidget->removeTab(m_tabWidget->indexOf(view));
         view->umlScene()->setIsOpen(false);
+        // a closed diagram is loaded again when it is shown
+        if (m_doc->lazyDiagramLoad()) {
+            m_doc->unloadView(view);
+        }
     }
 }
 #endif
@@ -3338,23 +3377,22 @@ void UMLApp::slotChangeTabLeft()
         m_tabWidget->setCurrentIndex(m_tabWidget->currentIndex() - 1);
         return;
     }
-    UMLViewList views = m_doc->viewIterator();
-    UMLView *currView = m_view;
+    QList<QPair<Uml::ID::Type, QString> > views = m_doc->viewNames();
     int viewIndex = 0;
-    if ((viewIndex = views.indexOf(currView)) < 0) {
+    for (; viewIndex < views.count() && m_view; ++viewIndex) {
+        if (views[viewIndex].first == m_view->umlScene()->ID()) {
+            break;
+        }
+    }
+    if (!m_view || viewIndex == views.count()) {
         uError() << "currView not found in viewlist";
         return;
     }
-    UMLView* prevView = NULL;
     if (viewIndex != 0) {
-        prevView = views.begin()[viewIndex -1 ];
-    }
-
-    if ((currView = prevView) != NULL) {
-        setCurrentView(currView);
+        setCurrentView(m_doc->findView(views[viewIndex - 1].first));
     }
     else {
-        setCurrentView(views.last());
+        setCurrentView(m_doc->findView(views.last().first));
     }
 }
 
@@ -3368,20 +3406,22 @@ void UMLApp::slotChangeTabRight()
         m_tabWidget->setCurrentIndex(m_tabWidget->currentIndex() + 1);
         return;
     }
-    UMLViewList views = m_doc->viewIterator();
-    UMLView *currView = m_view;
+    QList<QPair<Uml::ID::Type, QString> > views = m_doc->viewNames();
     int viewIndex = 0;
-    if ((viewIndex = views.indexOf(currView)) < 0) {
+    for (; viewIndex < views.count() && m_view; ++viewIndex) {
+        if (views[viewIndex].first == m_view->umlScene()->ID()) {
+            break;
+        }
+    }
+    if (!m_view || viewIndex == views.count()) {
         uError() << "currView not found in viewlist";
         return;
     }
-    UMLView* nextView = NULL;
     if (viewIndex < views.count()-1) {
-        nextView = views.begin()[viewIndex + 1];
-        setCurrentView(nextView);
+        setCurrentView(m_doc->findView(views[viewIndex + 1].first));
     }
     else
-        setCurrentView(views.first());
+        setCurrentView(m_doc->findView(views.first().first));
 }
 
 /* for debugging only
@@ -3562,6 +3602,14 @@ void UMLApp::beginMacro(const QString & text)
     m_pUndoStack->beginMacro(text);
 }
 
+/**
+ * Return whether a U/R command macro has been begun and not ended yet.
+ */
+bool UMLApp::hasBegunMacro() const
+{
+    return m_hasBegunMacro;
+}
+
 /**
  * End an U/R command macro
  */
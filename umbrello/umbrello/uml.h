@@ -185,6 +185,7 @@ public:
 
     void beginMacro(const QString & text);
     void endMacro();
+    bool hasBegunMacro() const;
 
     void setActiveLanguage(Uml::ProgrammingLanguage::Enum pl);
     Uml::ProgrammingLanguage::Enum activeLanguage() const;
@@ -272,6 +273,7 @@ public slots:
     void slotImportClass();
     void slotImportProject();
     void slotUpdateViews();
+    void slotShowView(QAction* action);
     void slotShowTreeView(bool state);
     void slotShowDebugView(bool state);
     void slotShowDocumentationView(bool state);
@@ -44,7 +44,11 @@
 #include "umlscene.h"
 #include "version.h"
 #include "worktoolbar.h"
+#include "xmistreamloader.h"
+#include "xmisavejob.h"
+#include "xmistreamwriter.h"
 #include "stereotypesmodel.h"
+#include "umlfindindex.h"
 
 // kde includes
 #include <kio/job.h>
@@ -109,13 +113,23 @@ UMLDoc::UMLDoc()
 #endif
     m_pChangeLog(0),
     m_bLoading(false),
+    m_changeBatchDepth(0),
+    m_batchedModifiedFlag(false),
+    m_batchedNotifications(0),
+    m_deliveredNotifications(0),
+    m_bStreamingLoad(true),
+    m_bLazyDiagramLoad(true),
+    m_bStreamingSave(true),
     m_Doc(QString()),
     m_pAutoSaveTimer(0),
+    m_pSaveJob(0),
     m_nViewID(Uml::ID::None),
     m_bTypesAreResolved(true),
     m_pCurrentRoot(0),
     m_bClosing(false),
-    m_stereotypesModel(new StereotypesModel(&m_stereoList))
+    m_closeBlocked(0),
+    m_stereotypesModel(new StereotypesModel(&m_stereoList)),
+    m_findIndex(new UMLFindIndex)
 {
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i)
         m_root[i] = 0;
@@ -184,6 +198,11 @@ UMLDoc::~UMLDoc()
     disconnect(m_pAutoSaveTimer, SIGNAL(timeout()), this, SLOT(slotAutoSave()));
     delete m_pAutoSaveTimer;
 
+    // let a running background save complete its file
+    if (m_pSaveJob) {
+        m_pSaveJob->wait();
+    }
+
     m_root[Uml::ModelType::Logical]->removeObject(m_datatypeRoot);
     delete m_datatypeRoot;
 
@@ -193,6 +212,7 @@ UMLDoc::~UMLDoc()
     delete m_pChangeLog;
     qDeleteAll(m_stereoList);
     delete m_stereotypesModel;
+    delete m_findIndex;
 }
 
 /**
@@ -260,28 +280,55 @@ void UMLDoc::removeView(UMLView *view, bool enforceCurrentView)
     UMLView *currentView = UMLApp::app()->currentView();
     if (currentView == view) {
         UMLApp::app()->setCurrentView(0);
-        UMLViewList viewList;
-        m_root[Uml::ModelType::Logical]->appendViews(viewList);
-        UMLView* firstView = 0;
-        if (!viewList.isEmpty()) {
-            firstView =  viewList.first();
-        }
+        // only the diagram which becomes current is loaded
+        QList<QPair<Uml::ID::Type, QString> > names;
+        m_root[Uml::ModelType::Logical]->appendViewNames(names);
 
-        if (!firstView && enforceCurrentView) {  //create a diagram
+        if (names.isEmpty() && enforceCurrentView) {  //create a diagram
             QString name = createDiagramName(Uml::DiagramType::Class, false);
             createDiagram(m_root[Uml::ModelType::Logical], Uml::DiagramType::Class, name);
             qApp->processEvents();
-            m_root[Uml::ModelType::Logical]->appendViews(viewList);
-            firstView = viewList.first();
+            m_root[Uml::ModelType::Logical]->appendViewNames(names);
         }
 
-        if (firstView) {
-            changeCurrentView(firstView->umlScene()->ID());
+        if (!names.isEmpty()) {
+            changeCurrentView(names.first().first);
             UMLApp::app()->setDiagramMenuItemsState(true);
         }
     }
 }
 
+/**
+ * Replace a view by its XMI to release the memory of its widgets. The
+ * view is loaded again by findView() when it is needed. The current view
+ * is not unloaded.
+ *
+ * @param view   Pointer to the UMLView to unload.
+ */
+void UMLDoc::unloadView(UMLView *view)
+{
+    if (!view || view == UMLApp::app()->currentView()) {
+        return;
+    }
+    UMLFolder *f = view->umlScene()->folder();
+    if (f == 0) {
+        uError() << view->umlScene()->name() << ": view->getFolder() returns NULL";
+        return;
+    }
+    DEBUG(DBG_SRC) << "<" << view->umlScene()->name() << ">";
+    // the documentation window may refer to the view
+    DocWindow* dw = UMLApp::app()->docWindow();
+    if (dw) {
+        dw->updateDocumentation(true);
+    }
+    if (UMLApp::app()->listView()) {
+        disconnect(this, SIGNAL(sigObjectRemoved(UMLObject*)),
+                   view->umlScene(), SLOT(slotObjectRemoved(UMLObject*)));
+    }
+    f->unloadView(view);
+    UMLApp::app()->slotUpdateViews();
+}
+
 /**
  * Sets the URL of the document.
  *
@@ -720,6 +767,7 @@ bool UMLDoc::openDocument(const KUrl& url, const char* format /* =0 */)
         newDocument();
         return false;
     }
+    beginChangeBatch();
     setModified(false);
     initSaveTimer();
 
@@ -727,6 +775,7 @@ bool UMLDoc::openDocument(const KUrl& url, const char* format /* =0 */)
     UMLApp::app()->clearUndoStack();
     // for compatibility
     addDefaultStereotypes();
+    commitChangeBatch();
 
     return true;
 }
@@ -745,6 +794,12 @@ bool UMLDoc::saveDocument(const KUrl& url, const char * format)
 #endif
 {
     Q_UNUSED(format);
+    // an autosave still running must not overwrite the file saved now
+    // with an older snapshot
+    if (m_pSaveJob) {
+        m_pSaveJob->cancel();
+        m_pSaveJob->wait();
+    }
     m_doc_url = url;
     bool uploaded = true;
 
@@ -754,18 +809,7 @@ bool UMLDoc::saveDocument(const KUrl& url, const char * format)
 #else
     QString strFileName = url.path(KUrl::RemoveTrailingSlash);
 #endif
-    QFileInfo fileInfo(strFileName);
-    QString fileExt = fileInfo.completeSuffix();
-    QString fileFormat = QLatin1String("xmi");
-    if (fileExt == QLatin1String("xmi") || fileExt == QLatin1String("bak.xmi")) {
-        fileFormat = QLatin1String("xmi");
-    } else if (fileExt == QLatin1String("xmi.tgz") || fileExt == QLatin1String("bak.xmi.tgz")) {
-        fileFormat = QLatin1String("tgz");
-    } else if (fileExt == QLatin1String("xmi.tar.bz2") || fileExt == QLatin1String("bak.xmi.tar.bz2")) {
-        fileFormat = QLatin1String("bz2");
-    } else {
-        fileFormat = QLatin1String("xmi");
-    }
+    QString fileFormat = XMISaveJob::fileFormat(strFileName);
 
     initSaveTimer();
 
@@ -946,6 +990,72 @@ bool UMLDoc::saveDocument(const KUrl& url, const char * format)
     return uploaded;
 }
 
+/**
+ * Saves the document to the given local file without blocking the GUI.
+ *
+ * A snapshot of the model is taken with saveToXMI() into memory, the
+ * compression and the writing of the file is done by a @ref XMISaveJob
+ * in a separate thread. sigBackgroundSaveProgress() and
+ * sigBackgroundSaveFinished() report the progress and the result.
+ * Unlike saveDocument() the url of the document and its modified state
+ * are not changed. Remote files are saved with saveDocument().
+ *
+ * @param url   The filename in KUrl format.
+ * @return  True if the save has been started, false if another
+ *          background save is still running.
+ */
+#if QT_VERSION >= 0x050000
+bool UMLDoc::saveDocumentInBackground(const QUrl& url)
+#else
+bool UMLDoc::saveDocumentInBackground(const KUrl& url)
+#endif
+{
+    if (!url.isLocalFile()) {
+        return saveDocument(url);
+    }
+    if (m_pSaveJob) {
+        DEBUG(DBG_SRC) << "previous save to " << m_pSaveJob->fileName() << " still running";
+        return false;
+    }
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    saveToXMI(buffer);
+    buffer.close();
+
+    m_pSaveJob = new XMISaveJob(buffer.data(), url.toLocalFile(), this);
+    connect(m_pSaveJob, SIGNAL(progress(qint64,qint64)), this, SIGNAL(sigBackgroundSaveProgress(qint64,qint64)));
+    connect(m_pSaveJob, SIGNAL(saved(bool,QString)), this, SLOT(slotBackgroundSaveFinished(bool,QString)));
+    m_pSaveJob->start(QThread::LowPriority);
+    return true;
+}
+
+/**
+ * Return whether a save started by saveDocumentInBackground() is running.
+ */
+bool UMLDoc::isSavingInBackground() const
+{
+    return m_pSaveJob != 0;
+}
+
+/**
+ * Called when the @ref XMISaveJob has finished.
+ */
+void UMLDoc::slotBackgroundSaveFinished(bool success, const QString& errorMessage)
+{
+    XMISaveJob *job = m_pSaveJob;
+    m_pSaveJob = 0;
+    if (job) {
+        job->wait();
+        if (success) {
+            writeToStatusBar(i18n("Saved %1", job->fileName()));
+        } else if (!job->isCancelled()) {
+            writeToStatusBar(errorMessage);
+        }
+        job->deleteLater();
+    }
+    emit sigBackgroundSaveFinished(success, errorMessage);
+}
+
 /**
  * Sets up the signals needed by the program for it to work.
  */
@@ -996,20 +1106,161 @@ UMLView * UMLDoc::findView(Uml::DiagramType::Enum type, const QString &name,
  */
 UMLObject* UMLDoc::findObjectById(Uml::ID::Type id)
 {
-    UMLObject *o = 0;
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
         if (id == m_root[i]->id()) {
             return m_root[i];
         }
-        o = m_root[i]->findObjectById(id);
-        if (o) {
-            return o;
-        }
+    }
+    UMLObject *o = m_objectIndex.value(QByteArray::fromRawData(id.data(), int(id.size())));
+    if (o && o->id() == id) {
+        return o;
     }
     o = findStereotypeById(id);
     return o;
 }
 
+/**
+ * Adds the given object and all objects contained in it to the ID index
+ * used by findObjectById().
+ * Nothing is done if the object is not located inside the model tree,
+ * i.e. neither its owning package nor its parent classifier are indexed.
+ *
+ * @param object   The @ref UMLObject to add.
+ */
+void UMLDoc::addToObjectIndex(UMLObject *object)
+{
+    if (!object) {
+        return;
+    }
+    const Uml::ID::Type id = object->id();
+    if (id == Uml::ID::None) {
+        return;
+    }
+    m_objectIndex.insert(QByteArray(id.data(), int(id.size())), object);
+    m_findIndex->objectChanged(object);
+
+    UMLClassifier *c = dynamic_cast<UMLClassifier*>(object);
+    if (c) {
+        foreach (UMLObject *o, c->subordinates()) {
+            uIgnoreZeroPointer(o);
+            // associations are indexed through their owning package
+            if (o->baseType() != UMLObject::ot_Association) {
+                addToObjectIndex(o);
+            }
+        }
+    }
+    UMLPackage *pkg = dynamic_cast<UMLPackage*>(object);
+    if (pkg) {
+        foreach (UMLObject *o, pkg->containedObjects()) {
+            uIgnoreZeroPointer(o);
+            addToObjectIndex(o);
+        }
+    }
+    if (object->baseType() == UMLObject::ot_Association) {
+        UMLAssociation *assoc = static_cast<UMLAssociation*>(object);
+        addToObjectIndex(assoc->getUMLRole(Uml::RoleType::A));
+        addToObjectIndex(assoc->getUMLRole(Uml::RoleType::B));
+    }
+}
+
+/**
+ * Removes the given object and all objects contained in it from the
+ * ID index used by findObjectById().
+ *
+ * @param object   The @ref UMLObject to remove.
+ */
+void UMLDoc::removeFromObjectIndex(UMLObject *object)
+{
+    if (!object) {
+        return;
+    }
+    const Uml::ID::Type id = object->id();
+    const QByteArray key = QByteArray::fromRawData(id.data(), int(id.size()));
+    QHash<QByteArray, QPointer<UMLObject> >::iterator it = m_objectIndex.find(key);
+    if (it != m_objectIndex.end() && it.value() == object) {
+        m_objectIndex.erase(it);
+    }
+    m_findIndex->objectRemoved(object);
+
+    UMLClassifier *c = dynamic_cast<UMLClassifier*>(object);
+    if (c) {
+        foreach (UMLObject *o, c->subordinates()) {
+            uIgnoreZeroPointer(o);
+            if (o->baseType() != UMLObject::ot_Association) {
+                removeFromObjectIndex(o);
+            }
+        }
+    }
+    UMLPackage *pkg = dynamic_cast<UMLPackage*>(object);
+    if (pkg) {
+        foreach (UMLObject *o, pkg->containedObjects()) {
+            uIgnoreZeroPointer(o);
+            removeFromObjectIndex(o);
+        }
+    }
+    if (object->baseType() == UMLObject::ot_Association) {
+        UMLAssociation *assoc = static_cast<UMLAssociation*>(object);
+        removeFromObjectIndex(assoc->getUMLRole(Uml::RoleType::A));
+        removeFromObjectIndex(assoc->getUMLRole(Uml::RoleType::B));
+    }
+}
+
+/**
+ * Updates the ID index after the ID of an indexed object has changed,
+ * e.g. when a pasted object gets a new ID via the @ref IDChangeLog.
+ * Objects which are not indexed under the old ID are left alone.
+ *
+ * @param object   The @ref UMLObject with the new ID already set.
+ * @param oldID    The previous ID of the object.
+ */
+void UMLDoc::changeObjectIndexID(UMLObject *object, Uml::ID::Type oldID)
+{
+    if (!object || oldID == object->id()) {
+        return;
+    }
+    const QByteArray oldKey = QByteArray::fromRawData(oldID.data(), int(oldID.size()));
+    QHash<QByteArray, QPointer<UMLObject> >::iterator it = m_objectIndex.find(oldKey);
+    if (it == m_objectIndex.end() || it.value() != object) {
+        return;
+    }
+    m_objectIndex.erase(it);
+    const Uml::ID::Type id = object->id();
+    m_objectIndex.insert(QByteArray(id.data(), int(id.size())), object);
+}
+
+/**
+ * Return true if the given object is part of the model tree, i.e. it is
+ * one of the root folders or it is present in the ID index.
+ *
+ * @param object   The @ref UMLObject to check.
+ */
+bool UMLDoc::isInObjectIndex(UMLObject *object)
+{
+    if (!object) {
+        return false;
+    }
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        if (object == m_root[i]) {
+            return true;
+        }
+    }
+    const Uml::ID::Type id = object->id();
+    return m_objectIndex.value(QByteArray::fromRawData(id.data(), int(id.size()))) == object;
+}
+
+/**
+ * Return all objects of the ID index, i.e. all objects contained in the
+ * model tree except the root folders, in no particular order.
+ */
+UMLObjectList UMLDoc::objectsInIndex() const
+{
+    UMLObjectList objects;
+    foreach (const QPointer<UMLObject> &o, m_objectIndex) {
+        objects.append(o);
+    }
+    return objects;
+}
+
 /**
  * Used to find a @ref UMLObject by its type and name.
  *
@@ -1326,6 +1577,7 @@ void UMLDoc::removeAssociation (UMLAssociation * assoc, bool doSetModified /*=tr
         uError() << assoc->name() << ": parent package is not set !";
         return;
     }
+    removeFromDeferredViews(assoc);
     pkg->removeObject(assoc);
 
     if (doSetModified) {  // so we will save our document
@@ -1508,6 +1760,25 @@ bool UMLDoc::closing() const
     return m_bClosing;
 }
 
+/**
+ * Keep the document from being closed by UMLApp::queryClose() while a
+ * job refers to its diagrams. Calls can be nested, each blockClose(true)
+ * needs a blockClose(false).
+ * @param block   true when a job starts, false when it has finished
+ */
+void UMLDoc::blockClose(bool block)
+{
+    m_closeBlocked += block ? 1 : -1;
+}
+
+/**
+ * Return whether closing the document has been blocked with blockClose().
+ */
+bool UMLDoc::isCloseBlocked() const
+{
+    return m_closeBlocked > 0;
+}
+
 /**
  * Creates the name of the given diagram type.
  * @param type         The type of diagram to create.
@@ -1835,6 +2106,8 @@ void UMLDoc::removeUMLObject(UMLObject* umlobject, bool deleteObject)
     UMLApp::app()->docWindow()->updateDocumentation(true);
     UMLObject::ObjectType type = umlobject->baseType();
 
+    // diagrams not loaded yet would keep referring to the object
+    removeFromDeferredViews(umlobject);
     umlobject->setUMLStereotype(0);  // triggers possible cleanup of UMLStereotype
     if (dynamic_cast<UMLClassifierListItem*>(umlobject))  {
         UMLClassifier* parent = dynamic_cast<UMLClassifier*>(umlobject->parent());
@@ -1968,9 +2241,86 @@ Uml::ID::Type UMLDoc::modelID() const
  * It is virtual and calls the corresponding saveToXMI() functions
  * of the derived classes.
  *
+ * Unless streaming has been disabled by setStreamingSave(), the file is
+ * written with the @ref XMIStreamWriter, which creates the same output
+ * as the QDomDocument based code without holding the whole model in a
+ * QDomDocument.
+ *
  * @param file   The file to be saved to.
  */
 void UMLDoc::saveToXMI(QIODevice& file)
+{
+    if (!m_bStreamingSave) {
+        saveXMIDocument(file);
+        return;
+    }
+    XMIStreamWriter writer(file);
+    writer.writeStartDocument();
+
+    QDomDocument doc;
+    writer.writeStartElement(createXMIElement(doc));
+    writer.writeElement(createXMIHeader(doc));
+
+    writer.writeStartElement(doc.createElement(QLatin1String("XMI.content")));
+    writer.writeStartElement(createModelElement(doc));
+    QDomElement ownedNS = doc.createElement(QLatin1String("UML:Namespace.ownedElement"));
+    saveStereotypesToXMI(doc, ownedNS);
+    writer.writeStartElement(ownedNS);
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        m_root[i]->streamToXMI(writer);
+    }
+    writer.writeEndElement();  // UML:Namespace.ownedElement
+    writer.writeEndElement();  // UML:Model
+    writer.writeEndElement();  // XMI.content
+
+    // Save the XMI extensions: docsettings, diagrams, listview, and codegeneration.
+    QDomElement extensions = doc.createElement(QLatin1String("XMI.extensions"));
+    extensions.setAttribute(QLatin1String("xmi.extender"), QLatin1String("umbrello"));
+    extensions.appendChild(createDocSettingsElement(doc));
+    writer.writeStartElement(extensions);
+
+    //  save listview
+    UMLApp::app()->listView()->saveToXMI(doc, extensions);
+    writer.writeChildren(extensions);
+
+    // save code generator
+    CodeGenerator *codegen = UMLApp::app()->generator();
+    if (codegen) {
+        QDomElement codeGenElement = doc.createElement(QLatin1String("codegeneration"));
+        codegen->saveToXMI(doc, codeGenElement);
+        writer.writeElement(codeGenElement);
+    }
+    writer.writeEndElement();  // XMI.extensions
+
+    writer.writeEndDocument();
+}
+
+/**
+ * Return whether saveToXMI() uses the @ref XMIStreamWriter.
+ */
+bool UMLDoc::streamingSave() const
+{
+    return m_bStreamingSave;
+}
+
+/**
+ * Select the writer used by saveToXMI().
+ *
+ * @param state   True for the @ref XMIStreamWriter,
+ *                false for the QDomDocument based code.
+ */
+void UMLDoc::setStreamingSave(bool state)
+{
+    m_bStreamingSave = state;
+}
+
+/**
+ * Save the model as a XMI file by building a QDomDocument of the
+ * complete model.
+ *
+ * @param file   The file to be saved to.
+ */
+void UMLDoc::saveXMIDocument(QIODevice& file)
 {
     QDomDocument doc;
 
@@ -1979,14 +2329,73 @@ void UMLDoc::saveToXMI(QIODevice& file)
                                         QString::fromLatin1("version=\"1.0\" encoding=\"UTF-8\""));
     doc.appendChild(xmlHeading);
 
+    QDomElement root = createXMIElement(doc);
+    doc.appendChild(root);
+
+    root.appendChild(createXMIHeader(doc));
+
+    QDomElement content = doc.createElement(QLatin1String("XMI.content"));
+
+    QDomElement contentNS = doc.createElement(QLatin1String("UML:Namespace.contents"));
+
+    QDomElement objectsElement = createModelElement(doc);
+
+    QDomElement ownedNS = doc.createElement(QLatin1String("UML:Namespace.ownedElement"));
+
+    saveStereotypesToXMI(doc, ownedNS);
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        m_root[i]->saveToXMI(doc, ownedNS);
+    }
+
+    objectsElement.appendChild(ownedNS);
+
+    content.appendChild(objectsElement);
+
+    root.appendChild(content);
+
+    // Save the XMI extensions: docsettings, diagrams, listview, and codegeneration.
+    QDomElement extensions = doc.createElement(QLatin1String("XMI.extensions"));
+    extensions.setAttribute(QLatin1String("xmi.extender"), QLatin1String("umbrello"));
+
+    extensions.appendChild(createDocSettingsElement(doc));
+
+    //  save listview
+    UMLApp::app()->listView()->saveToXMI(doc, extensions);
+
+    // save code generator
+    CodeGenerator *codegen = UMLApp::app()->generator();
+    if (codegen) {
+        QDomElement codeGenElement = doc.createElement(QLatin1String("codegeneration"));
+        codegen->saveToXMI(doc, codeGenElement);
+        extensions.appendChild(codeGenElement);
+    }
+
+    root.appendChild(extensions);
+
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+    stream << doc.toString();
+}
+
+/**
+ * Auxiliary to saveToXMI(): Create the <XMI> root element.
+ */
+QDomElement UMLDoc::createXMIElement(QDomDocument& doc)
+{
     QDomElement root = doc.createElement(QLatin1String("XMI"));
     root.setAttribute(QLatin1String("xmi.version"), QLatin1String("1.2"));
     QDateTime now = QDateTime::currentDateTime();
     root.setAttribute(QLatin1String("timestamp"), now.toString(Qt::ISODate));
     root.setAttribute(QLatin1String("verified"), QLatin1String("false"));
     root.setAttribute(QLatin1String("xmlns:UML"), QLatin1String("http://schema.omg.org/spec/UML/1.3"));
-    doc.appendChild(root);
+    return root;
+}
 
+/**
+ * Auxiliary to saveToXMI(): Create the <XMI.header> element.
+ */
+QDomElement UMLDoc::createXMIHeader(QDomDocument& doc)
+{
     QDomElement header = doc.createElement(QLatin1String("XMI.header"));
     QDomElement meta = doc.createElement(QLatin1String("XMI.metamodel"));
     meta.setAttribute(QLatin1String("xmi.name"), QLatin1String("UML"));
@@ -2039,12 +2448,15 @@ void UMLDoc::saveToXMI(QIODevice& file)
     // See comment on <XMI.model> above
     // header.appendChild(model);
     header.appendChild(meta);
-    root.appendChild(header);
-
-    QDomElement content = doc.createElement(QLatin1String("XMI.content"));
-
-    QDomElement contentNS = doc.createElement(QLatin1String("UML:Namespace.contents"));
+    return header;
+}
 
+/**
+ * Auxiliary to saveToXMI(): Create the <UML:Model> element which holds
+ * the root folders.
+ */
+QDomElement UMLDoc::createModelElement(QDomDocument& doc)
+{
     QDomElement objectsElement = doc.createElement(QLatin1String("UML:Model"));
     objectsElement.setAttribute(QLatin1String("xmi.id"), Uml::ID::toString(m_modelID));
     objectsElement.setAttribute(QLatin1String("name"), m_Name);
@@ -2052,9 +2464,15 @@ void UMLDoc::saveToXMI(QIODevice& file)
     objectsElement.setAttribute(QLatin1String("isAbstract"), QLatin1String("false"));
     objectsElement.setAttribute(QLatin1String("isRoot"), QLatin1String("false"));
     objectsElement.setAttribute(QLatin1String("isLeaf"), QLatin1String("false"));
+    return objectsElement;
+}
 
-    QDomElement ownedNS = doc.createElement(QLatin1String("UML:Namespace.ownedElement"));
-
+/**
+ * Auxiliary to saveToXMI(): Save the stereotypes to the given
+ * <UML:Namespace.ownedElement> element.
+ */
+void UMLDoc::saveStereotypesToXMI(QDomDocument& doc, QDomElement& ownedNS)
+{
     // Save stereotypes and toplevel datatypes first so that upon loading
     // they are known first.
     // There is a bug causing duplication of the same stereotype in m_stereoList.
@@ -2067,20 +2485,13 @@ void UMLDoc::saveToXMI(QIODevice& file)
             stereoNames.append(stName);
         }
     }
-    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
-        m_root[i]->saveToXMI(doc, ownedNS);
-    }
-
-    objectsElement.appendChild(ownedNS);
-
-    content.appendChild(objectsElement);
-
-    root.appendChild(content);
-
-    // Save the XMI extensions: docsettings, diagrams, listview, and codegeneration.
-    QDomElement extensions = doc.createElement(QLatin1String("XMI.extensions"));
-    extensions.setAttribute(QLatin1String("xmi.extender"), QLatin1String("umbrello"));
+}
 
+/**
+ * Auxiliary to saveToXMI(): Create the <docsettings> extension element.
+ */
+QDomElement UMLDoc::createDocSettingsElement(QDomDocument& doc)
+{
     QDomElement docElement = doc.createElement(QLatin1String("docsettings"));
     Uml::ID::Type viewID = Uml::ID::None;
     UMLView *currentView = UMLApp::app()->currentView();
@@ -2090,24 +2501,7 @@ void UMLDoc::saveToXMI(QIODevice& file)
     docElement.setAttribute(QLatin1String("viewid"), Uml::ID::toString(viewID));
     docElement.setAttribute(QLatin1String("documentation"), m_Doc);
     docElement.setAttribute(QLatin1String("uniqueid"), Uml::ID::toString(UniqueID::get()));
-    extensions.appendChild(docElement);
-
-    //  save listview
-    UMLApp::app()->listView()->saveToXMI(doc, extensions);
-
-    // save code generator
-    CodeGenerator *codegen = UMLApp::app()->generator();
-    if (codegen) {
-        QDomElement codeGenElement = doc.createElement(QLatin1String("codegeneration"));
-        codegen->saveToXMI(doc, codeGenElement);
-        extensions.appendChild(codeGenElement);
-    }
-
-    root.appendChild(extensions);
-
-    QTextStream stream(&file);
-    stream.setCodec("UTF-8");
-    stream << doc.toString();
+    return docElement;
 }
 
 /**
@@ -2215,6 +2609,10 @@ short UMLDoc::encoding(QIODevice & file)
  * is already known it can be passed to the function. If this info
  * isn't given, loadFromXMI will check which encoding was used.
  *
+ * Unicode files are read with the @ref XMIStreamLoader unless
+ * streaming has been disabled by setStreamingLoad(), all other
+ * files are read into a QDomDocument as a whole.
+ *
  * @param file     The file to be loaded.
  * @param encode   The encoding used.
  */
@@ -2230,6 +2628,92 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
         }
         file.reset();
     }
+
+    m_nViewID = Uml::ID::None;
+    bool status = false;
+    if (encode == ENC_UNICODE && m_bStreamingLoad) {
+        XMIStreamLoader loader(this);
+        status = loader.load(file);
+    } else {
+        status = loadXMIDocument(file, encode);
+    }
+    if (!status) {
+        return false;
+    }
+
+    resolveTypes();
+    // set a default code generator if no <XMI.extensions><codegeneration> tag seen
+    if (UMLApp::app()->generator() == 0) {
+        UMLApp::app()->setGenerator(UMLApp::app()->defaultLanguage());
+    }
+    emit sigWriteToStatusBar(i18n("Setting up the document..."));
+    qApp->processEvents();  // give UI events a chance
+    activateAllViews();
+
+    UMLView *viewToBeSet = 0;
+    if (m_nViewID != Uml::ID::None) {
+        viewToBeSet = findView(m_nViewID);
+    }
+    if (viewToBeSet) {
+        changeCurrentView(m_nViewID);
+    } else {
+        QString name = createDiagramName(Uml::DiagramType::Class, false);
+        createDiagram(m_root[Uml::ModelType::Logical], Uml::DiagramType::Class, name);
+        m_pCurrentRoot = m_root[Uml::ModelType::Logical];
+    }
+    emit sigResetStatusbarProgress();
+    return true;
+}
+
+/**
+ * Return whether loadFromXMI() uses the @ref XMIStreamLoader for
+ * Unicode files.
+ */
+bool UMLDoc::streamingLoad() const
+{
+    return m_bStreamingLoad;
+}
+
+/**
+ * Select the loader used by loadFromXMI() for Unicode files.
+ *
+ * @param state   True for the @ref XMIStreamLoader,
+ *                false for the QDomDocument based loader.
+ */
+void UMLDoc::setStreamingLoad(bool state)
+{
+    m_bStreamingLoad = state;
+}
+
+/**
+ * Return whether loadFromXMI() keeps the diagrams as XMI and creates
+ * their views only when they are needed.
+ */
+bool UMLDoc::lazyDiagramLoad() const
+{
+    return m_bLazyDiagramLoad;
+}
+
+/**
+ * Select whether loadFromXMI() creates the views of all diagrams at once
+ * or only when they are shown, printed, exported or searched.
+ *
+ * @param state   True to load the diagrams when they are needed.
+ */
+void UMLDoc::setLazyDiagramLoad(bool state)
+{
+    m_bLazyDiagramLoad = state;
+}
+
+/**
+ * Load the model from an XMI file by building a QDomDocument of
+ * the complete file.
+ *
+ * @param file     The file to be loaded.
+ * @param encode   The encoding used.
+ */
+bool UMLDoc::loadXMIDocument(QIODevice & file, short encode)
+{
     QTextStream stream(&file);
     if (encode == ENC_UNICODE) {
         stream.setCodec("UTF-8");
@@ -2263,7 +2747,6 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
         return false;
     }
 
-    m_nViewID = Uml::ID::None;
     for (node = node.firstChild(); !node.isNull(); node = node.nextSibling()) {
         if (node.isComment()) {
             continue;
@@ -2295,9 +2778,7 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
                 uWarning() << "failed load on objects";
                 return false;
             }
-            m_Name = element.attribute(QLatin1String("name"), i18n("UML Model"));
-            UMLListView *lv = UMLApp::app()->listView();
-            lv->setTitle(0, m_Name);
+            setModelName(element.attribute(QLatin1String("name"), i18n("UML Model")));
             recognized = true;
         }
         if (outerTag != QLatin1String("XMI.content")) {
@@ -2323,103 +2804,112 @@ bool UMLDoc::loadFromXMI(QIODevice & file, short encode)
                     uWarning() << "failed load on objects";
                     return false;
                 }
-                m_Name = element.attribute(QLatin1String("name"), i18n("UML Model"));
-                UMLListView *lv = UMLApp::app()->listView();
-                lv->setTitle(0, m_Name);
-                seen_UMLObjects = true;
-            } else if (tagEq(tag, QLatin1String("Package")) ||
-                       tagEq(tag, QLatin1String("Class")) ||
-                       tagEq(tag, QLatin1String("Interface"))) {
-                // These tests are only for foreign XMI files that
-                // are missing the <Model> tag (e.g. NSUML)
-                QString stID = element.attribute(QLatin1String("stereotype"));
-                UMLObject *pObject = Object_Factory::makeObjectFromXMI(tag, stID);
-                if (!pObject) {
-                    uWarning() << "Unknown type of umlobject to create: " << tag;
-                    // We want a best effort, therefore this is handled as a
-                    // soft error.
-                    continue;
-                }
-                UMLObject::ObjectType ot = pObject->baseType();
-                // Set the parent root folder.
-                UMLPackage *pkg = 0;
-                if (ot != UMLObject::ot_Stereotype) {
-                    if (ot == UMLObject::ot_Datatype) {
-                        pkg = m_datatypeRoot;
-                    } else {
-                        Uml::ModelType::Enum guess = Model_Utils::guessContainer(pObject);
-                        if (guess != Uml::ModelType::N_MODELTYPES) {
-                            pkg = m_root[guess];
-                        }
-                        else {
-                            uError() << "Guess is Uml::ModelType::N_MODELTYPES - package not set correctly for "
-                                     << pObject->name() << " / base type " << pObject->baseTypeStr();
-                            pkg = m_root[Uml::ModelType::Logical];
-                        }
-                    }
-                }
-                pObject->setUMLPackage(pkg);
-                bool status = pObject->loadFromXMI(element);
-                if (!status) {
-                    delete pObject;
-                    return false;
-                }
+                setModelName(element.attribute(QLatin1String("name"), i18n("UML Model")));
                 seen_UMLObjects = true;
-            } else if (tagEq(tag, QLatin1String("TaggedValue"))) {
-                // This tag is produced here, i.e. outside of <UML:Model>,
-                // by the Unisys.JCR.1 Rose-to-XMI tool.
-                if (! seen_UMLObjects) {
-                    DEBUG(DBG_SRC) << "skipping TaggedValue because not seen_UMLObjects";
-                    continue;
-                }
-                tag = element.attribute(QLatin1String("tag"));
-                if (tag != QLatin1String("documentation")) {
-                    continue;
-                }
-                QString modelElement = element.attribute(QLatin1String("modelElement"));
-                if (modelElement.isEmpty()) {
-                    DEBUG(DBG_SRC) << "skipping TaggedValue(documentation) because "
-                                   << "modelElement.isEmpty()";
-                    continue;
-                }
-                UMLObject *o = findObjectById(Uml::ID::fromString(modelElement));
-                if (o == 0) {
-                    DEBUG(DBG_SRC) << "TaggedValue(documentation): cannot find object"
-                                   << " for modelElement " << modelElement;
-                    continue;
-                }
-                QString value = element.attribute(QLatin1String("value"));
-                if (! value.isEmpty()) {
-                    o->setDoc(value);
-                }
-            } else {
-                // for backward compatibility
-                loadExtensionsFromXMI(child);
+            } else if (!loadContentElementFromXMI(element, seen_UMLObjects)) {
+                return false;
             }
         }
     }
+    return true;
+}
 
-    resolveTypes();
-    // set a default code generator if no <XMI.extensions><codegeneration> tag seen
-    if (UMLApp::app()->generator() == 0) {
-        UMLApp::app()->setGenerator(UMLApp::app()->defaultLanguage());
-    }
-    emit sigWriteToStatusBar(i18n("Setting up the document..."));
-    qApp->processEvents();  // give UI events a chance
-    activateAllViews();
+/**
+ * Set the model name read from the <UML:Model> tag and show it
+ * in the list view.
+ *
+ * @param name   The name of the model.
+ */
+void UMLDoc::setModelName(const QString &name)
+{
+    m_Name = name;
+    UMLListView *lv = UMLApp::app()->listView();
+    lv->setTitle(0, m_Name);
+}
 
-    UMLView *viewToBeSet = 0;
-    if (m_nViewID != Uml::ID::None) {
-        viewToBeSet = findView(m_nViewID);
-    }
-    if (viewToBeSet) {
-        changeCurrentView(m_nViewID);
+/**
+ * Load a child of the <XMI.content> element which is not the
+ * <UML:Model> itself.
+ * These are only present in foreign XMI files or in files of old
+ * Umbrello versions.
+ *
+ * @param element          The child element of <XMI.content>.
+ * @param seenUMLObjects   Set to true when UML objects have been loaded;
+ *                         TaggedValues are only applied after that.
+ * @return  False on a fatal error.
+ */
+bool UMLDoc::loadContentElementFromXMI(QDomElement & element, bool & seenUMLObjects)
+{
+    QString tag = element.tagName();
+    if (tagEq(tag, QLatin1String("Package")) ||
+        tagEq(tag, QLatin1String("Class")) ||
+        tagEq(tag, QLatin1String("Interface"))) {
+        // These tests are only for foreign XMI files that
+        // are missing the <Model> tag (e.g. NSUML)
+        QString stID = element.attribute(QLatin1String("stereotype"));
+        UMLObject *pObject = Object_Factory::makeObjectFromXMI(tag, stID);
+        if (!pObject) {
+            uWarning() << "Unknown type of umlobject to create: " << tag;
+            // We want a best effort, therefore this is handled as a
+            // soft error.
+            return true;
+        }
+        UMLObject::ObjectType ot = pObject->baseType();
+        // Set the parent root folder.
+        UMLPackage *pkg = 0;
+        if (ot != UMLObject::ot_Stereotype) {
+            if (ot == UMLObject::ot_Datatype) {
+                pkg = m_datatypeRoot;
+            } else {
+                Uml::ModelType::Enum guess = Model_Utils::guessContainer(pObject);
+                if (guess != Uml::ModelType::N_MODELTYPES) {
+                    pkg = m_root[guess];
+                }
+                else {
+                    uError() << "Guess is Uml::ModelType::N_MODELTYPES - package not set correctly for "
+                             << pObject->name() << " / base type " << pObject->baseTypeStr();
+                    pkg = m_root[Uml::ModelType::Logical];
+                }
+            }
+        }
+        pObject->setUMLPackage(pkg);
+        bool status = pObject->loadFromXMI(element);
+        if (!status) {
+            delete pObject;
+            return false;
+        }
+        seenUMLObjects = true;
+    } else if (tagEq(tag, QLatin1String("TaggedValue"))) {
+        // This tag is produced here, i.e. outside of <UML:Model>,
+        // by the Unisys.JCR.1 Rose-to-XMI tool.
+        if (! seenUMLObjects) {
+            DEBUG(DBG_SRC) << "skipping TaggedValue because not seen_UMLObjects";
+            return true;
+        }
+        tag = element.attribute(QLatin1String("tag"));
+        if (tag != QLatin1String("documentation")) {
+            return true;
+        }
+        QString modelElement = element.attribute(QLatin1String("modelElement"));
+        if (modelElement.isEmpty()) {
+            DEBUG(DBG_SRC) << "skipping TaggedValue(documentation) because "
+                           << "modelElement.isEmpty()";
+            return true;
+        }
+        UMLObject *o = findObjectById(Uml::ID::fromString(modelElement));
+        if (o == 0) {
+            DEBUG(DBG_SRC) << "TaggedValue(documentation): cannot find object"
+                           << " for modelElement " << modelElement;
+            return true;
+        }
+        QString value = element.attribute(QLatin1String("value"));
+        if (! value.isEmpty()) {
+            o->setDoc(value);
+        }
     } else {
-        QString name = createDiagramName(Uml::DiagramType::Class, false);
-        createDiagram(m_root[Uml::ModelType::Logical], Uml::DiagramType::Class, name);
-        m_pCurrentRoot = m_root[Uml::ModelType::Logical];
+        // for backward compatibility
+        loadExtensionsFromXMI(element);
     }
-    emit sigResetStatusbarProgress();
     return true;
 }
 
@@ -2451,6 +2941,14 @@ StereotypesModel *UMLDoc::stereotypesModel()
     return m_stereotypesModel;
 }
 
+/**
+ * Return the search index of the model used by the finders.
+ */
+UMLFindIndex *UMLDoc::findIndex()
+{
+    return m_findIndex;
+}
+
 /**
  * Ensures the XMI file is a valid UML file.
  * Currently only checks for metamodel=UML.
@@ -2789,6 +3287,8 @@ void UMLDoc::removeAllObjects()
     for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
         m_root[i]->removeAllObjects();
     }
+    m_objectIndex.clear();
+    m_findIndex->clear();
 }
 
 /**
@@ -2920,6 +3420,7 @@ void UMLDoc::print(QPrinter * pPrinter, DiagramPrintPage * selectPage)
 
 /**
  * Return the list of views for this document.
+ * Diagrams which have not been loaded yet are loaded.
  *
  * @return  List of UML views.
  */
@@ -2932,6 +3433,67 @@ UMLViewList UMLDoc::viewIterator()
     return accumulator;
 }
 
+/**
+ * Return the list of views for this document which have already been
+ * loaded. Unlike viewIterator() it does not load deferred diagrams.
+ *
+ * @return  List of UML views.
+ */
+UMLViewList UMLDoc::loadedViews()
+{
+    UMLViewList accumulator;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        m_root[i]->appendLoadedViews(accumulator, true);
+    }
+    return accumulator;
+}
+
+/**
+ * Return the IDs and names of all views of this document in the order
+ * of viewIterator(), without loading any diagram.
+ *
+ * @return  List of view IDs and names.
+ */
+QList<QPair<Uml::ID::Type, QString> > UMLDoc::viewNames()
+{
+    QList<QPair<Uml::ID::Type, QString> > names;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        m_root[i]->appendViewNames(names, true);
+    }
+    return names;
+}
+
+/**
+ * Return the IDs of the objects shown on a diagram which has not been
+ * loaded yet, as found in its XMI.
+ *
+ * @param viewId   The ID of the diagram.
+ * @return  The IDs, or an empty list if the diagram is loaded or unknown.
+ */
+QList<Uml::ID::Type> UMLDoc::deferredViewObjects(Uml::ID::Type viewId) const
+{
+    QList<Uml::ID::Type> objectIds;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        if (m_root[i]->deferredViewObjects(viewId, objectIds)) {
+            break;
+        }
+    }
+    return objectIds;
+}
+
+/**
+ * Update the diagrams which have not been loaded yet and show the given
+ * object before it is removed, see UMLFolder::removeFromDeferredViews().
+ *
+ * @param object   The object to be removed.
+ */
+void UMLDoc::removeFromDeferredViews(UMLObject *object)
+{
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        m_root[i]->removeFromDeferredViews(object);
+    }
+}
+
 /**
  * Sets the modified flag for the document after a modifying
  * action on the view connected to the document.
@@ -2942,6 +3504,12 @@ void UMLDoc::setModified(bool modified /*=true*/)
 {
     if (!m_bLoading) {
         m_modified = modified;
+        if (m_changeBatchDepth > 0) {
+            // the main window is updated when the batch is committed
+            m_batchedModifiedFlag = true;
+            ++m_batchedNotifications;
+            return;
+        }
         UMLApp::app()->setModified(modified);
     }
 }
@@ -3067,6 +3635,101 @@ void UMLDoc::endPaste()
     }
 }
 
+/**
+ * Opens a change batch. Until the batch is committed, the modified()
+ * signals of the changed objects and the modified state of the main
+ * window are collected instead of being delivered at once: each object
+ * changed in the batch is notified only once when the batch is
+ * committed, no matter how many of its properties were set.
+ * Batches may be nested, the outermost commitChangeBatch() delivers
+ * the collected notifications.
+ * While the document is loading no notifications are sent at all, so
+ * there is nothing to collect; do not open a batch around loading.
+ */
+void UMLDoc::beginChangeBatch()
+{
+    ++m_changeBatchDepth;
+}
+
+/**
+ * Closes a change batch opened with beginChangeBatch() and, if it is
+ * the outermost one, delivers one modified() signal for each object
+ * changed in the batch which still exists.
+ */
+void UMLDoc::commitChangeBatch()
+{
+    if (m_changeBatchDepth == 0) {
+        uWarning() << "no change batch has been opened";
+        return;
+    }
+    if (--m_changeBatchDepth > 0) {
+        return;
+    }
+    const QList<QPointer<UMLObject> > objects = m_batchedObjects;
+    m_batchedObjects.clear();
+    m_batchedObjectIndex.clear();
+    uint delivered = 0;
+    foreach (const QPointer<UMLObject> &object, objects) {
+        if (object) {
+            object->emitModified();
+            ++delivered;
+        }
+    }
+    if (m_batchedModifiedFlag) {
+        m_batchedModifiedFlag = false;
+        UMLApp::app()->setModified(m_modified);
+        ++delivered;
+    }
+    m_deliveredNotifications += delivered;
+    DEBUG(DBG_SRC) << "delivered" << delivered << "notifications,"
+                   << savedNotificationCount() << "saved so far";
+}
+
+/**
+ * Returns true while a change batch is open.
+ */
+bool UMLDoc::isBatchingChanges() const
+{
+    return m_changeBatchDepth > 0;
+}
+
+/**
+ * Records the modification of an object within the open change batch.
+ * Called by UMLObject::emitModified().
+ *
+ * @param object   The modified object.
+ */
+void UMLDoc::batchModified(UMLObject *object)
+{
+    ++m_batchedNotifications;
+    QHash<UMLObject*, int>::const_iterator it = m_batchedObjectIndex.constFind(object);
+    // the address may belong to an object deleted within the batch
+    if (it != m_batchedObjectIndex.constEnd() && m_batchedObjects.at(it.value()) == object) {
+        return;
+    }
+    m_batchedObjectIndex[object] = m_batchedObjects.count();
+    m_batchedObjects.append(object);
+}
+
+/**
+ * Returns the number of notifications collected by change batches
+ * since the application was started.
+ */
+uint UMLDoc::batchedNotificationCount() const
+{
+    return m_batchedNotifications;
+}
+
+/**
+ * Returns the number of notifications change batches have saved,
+ * i.e. the collected ones which were not delivered because the same
+ * object or the modified state had already been notified in the batch.
+ */
+uint UMLDoc::savedNotificationCount() const
+{
+    return m_batchedNotifications - m_deliveredNotifications;
+}
+
 /**
  * Assigns a New ID to an Object, and also logs the assignment
  * to its internal ChangeLog.
@@ -3212,18 +3875,8 @@ void UMLDoc::slotAutoSave()
         tempUrl.setScheme(QLatin1String("file"));
 #endif
         tempUrl.setPath(QDir::homePath() + i18n("/autosave%1", QLatin1String(".xmi")));
-        saveDocument(tempUrl);
-        setUrlUntitled();
-        m_modified = true;
-        UMLApp::app()->setModified(m_modified);
     } else {
         // 2004-05-17 Achim Spangler
-#if QT_VERSION >= 0x050000
-        QUrl orgDocUrl = m_doc_url;
-#else
-        KUrl orgDocUrl = m_doc_url;
-#endif
-        QString orgFileName = m_doc_url.fileName();
         // don't overwrite manually saved file with autosave content
         QString fileName = tempUrl.fileName();
         Settings::OptionState optionState = Settings::optionState();
@@ -3234,22 +3887,10 @@ void UMLDoc::slotAutoSave()
         tempUrl.setFileName(fileName);
 #endif
         // End Achim Spangler
-
-        saveDocument(tempUrl);
-        // 2004-05-17 Achim Spangler
-        // re-activate m_modified if autosave is writing to other file
-        // than the main project file->autosave-suffix != ".xmi"
-        if (optionState.generalState.autosavesuffix != QLatin1String(".xmi")) {
-            m_modified = true;
-            UMLApp::app()->setModified(m_modified);
-        }
-        // restore original file name -
-        // UMLDoc::saveDocument() sets doc_url to filename which is given as autosave-filename
-        setUrl(orgDocUrl);
-        UMLApp * pApp = UMLApp::app();
-        pApp->setCaption(orgFileName, isModified());
-        // End Achim Spangler
     }
+    // The url and the modified state of the document are left alone,
+    // the model stays modified until it is saved by the user.
+    saveDocumentInBackground(tempUrl);
 }
 
 /**
@@ -30,6 +30,11 @@
 #endif
 
 // qt includes
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QPointer>
 #if QT_VERSION >= 0x050000
 #include <QUrl>
 #endif
@@ -49,9 +54,11 @@ class QPrinter;
 
 class IDChangeLog;
 class StereotypesModel;
+class UMLFindIndex;
 class UMLPackage;
 class UMLFolder;
 class DiagramPrintPage;
+class XMISaveJob;
 
 /**
  * UMLDoc provides a document object for a document-view model.
@@ -81,6 +88,7 @@ public:
 
     void addView(UMLView *view);
     void removeView(UMLView *view, bool enforceOneView = true);
+    void unloadView(UMLView *view);
     void setMainViewID(Uml::ID::Type viewID);
     void changeCurrentView(Uml::ID::Type id);
     void activateAllViews();
@@ -96,15 +104,18 @@ public:
 #if QT_VERSION >= 0x050000
     bool openDocument(const QUrl& url, const char *format = 0);
     bool saveDocument(const QUrl& url, const char *format = 0);
+    bool saveDocumentInBackground(const QUrl& url);
     const QUrl& url() const;
     void setUrl(const QUrl& url);
 #else
     bool openDocument(const KUrl& url, const char *format = 0);
     bool saveDocument(const KUrl& url, const char *format = 0);
+    bool saveDocumentInBackground(const KUrl& url);
     const KUrl& url() const;
     void setUrl(const KUrl& url);
 #endif
     void setUrlUntitled();
+    bool isSavingInBackground() const;
 
     void setupSignals();
 
@@ -136,6 +147,12 @@ public:
 
     UMLObject* findObjectById(Uml::ID::Type id);
 
+    void addToObjectIndex(UMLObject *object);
+    void removeFromObjectIndex(UMLObject *object);
+    void changeObjectIndexID(UMLObject *object, Uml::ID::Type oldID);
+    bool isInObjectIndex(UMLObject *object);
+    UMLObjectList objectsInIndex() const;
+
     UMLObject* findUMLObject(const QString &name,
                              UMLObject::ObjectType type = UMLObject::ot_UMLObject,
                              UMLObject *currentObj = 0);
@@ -163,15 +180,26 @@ public:
 
     virtual void saveToXMI(QIODevice& file);
 
+    bool streamingSave() const;
+    void setStreamingSave(bool state);
+
     short encoding(QIODevice & file);
 
     virtual bool loadFromXMI(QIODevice& file, short encode = ENC_UNKNOWN);
 
+    bool streamingLoad() const;
+    void setStreamingLoad(bool state);
+
+    bool lazyDiagramLoad() const;
+    void setLazyDiagramLoad(bool state);
+
     bool validateXMIHeader(QDomNode& headerNode);
 
     bool loadUMLObjectsFromXMI(QDomElement & element);
     void loadExtensionsFromXMI(QDomNode & node);
     bool loadDiagramsFromXMI(QDomNode & node);
+    bool loadContentElementFromXMI(QDomElement & element, bool & seenUMLObjects);
+    void setModelName(const QString &name);
 
     void signalDiagramRenamed(UMLView * view);
     void signalUMLObjectCreated(UMLObject * o);
@@ -187,6 +215,10 @@ public:
     void print(QPrinter * pPrinter, DiagramPrintPage * selectPage);
 
     UMLViewList viewIterator();
+    UMLViewList loadedViews();
+    QList<QPair<Uml::ID::Type, QString> > viewNames();
+    QList<Uml::ID::Type> deferredViewObjects(Uml::ID::Type viewId) const;
+    void removeFromDeferredViews(UMLObject *object);
 
     bool assignNewIDs(UMLObject* obj);
 
@@ -204,6 +236,13 @@ public:
     void beginPaste();
     void endPaste();
 
+    void beginChangeBatch();
+    void commitChangeBatch();
+    bool isBatchingChanges() const;
+    void batchModified(UMLObject *object);
+    uint batchedNotificationCount() const;
+    uint savedNotificationCount() const;
+
     Uml::ID::Type assignNewID(Uml::ID::Type oldID);
 
     void setDocumentation(const QString &doc);
@@ -218,6 +257,9 @@ public:
 
     bool closing() const;
 
+    void blockClose(bool block);
+    bool isCloseBlocked() const;
+
     void addDefaultDatatypes();
     void createDatatype(const QString &name);
 
@@ -235,10 +277,18 @@ public:
     void resolveTypes();
 
     StereotypesModel *stereotypesModel();
+    UMLFindIndex *findIndex();
 
 private:
     void initSaveTimer();
     void createDatatypeFolder();
+    bool loadXMIDocument(QIODevice& file, short encode);
+    void saveXMIDocument(QIODevice& file);
+    QDomElement createXMIElement(QDomDocument& doc);
+    QDomElement createXMIHeader(QDomDocument& doc);
+    QDomElement createModelElement(QDomDocument& doc);
+    void saveStereotypesToXMI(QDomDocument& doc, QDomElement& ownedNS);
+    QDomElement createDocSettingsElement(QDomDocument& doc);
 
     /**
      * Array of predefined root folders.
@@ -260,6 +310,14 @@ private:
      */
     UMLStereotypeList m_stereoList;
 
+    /**
+     * Index of all objects contained in the model tree by their xmi.id.
+     * It is maintained by UMLPackage and UMLClassifier when objects are
+     * added or removed and by UMLObject when an ID changes, which makes
+     * findObjectById() a hash lookup instead of a walk over all folders.
+     */
+    QHash<QByteArray, QPointer<UMLObject> > m_objectIndex;
+
     QString m_Name; ///< name of this model as stored in the <UML:Model> tag
     Uml::ID::Type m_modelID; ///< xmi.id of this model in the <UML:Model>
     int m_count;   ///< auxiliary counter for the progress bar
@@ -279,6 +337,45 @@ private:
      */
     bool m_bLoading;
 
+    /**
+     * Nesting level of beginChangeBatch(), 0 if no change batch is open.
+     */
+    int m_changeBatchDepth;
+
+    /**
+     * The objects modified within the open change batch, in the order
+     * of their first modification, with their position in the list.
+     */
+    QList<QPointer<UMLObject> > m_batchedObjects;
+    QHash<UMLObject*, int> m_batchedObjectIndex;
+
+    /**
+     * true if setModified() has been called within the open change batch
+     */
+    bool m_batchedModifiedFlag;
+
+    /**
+     * Notifications collected by change batches, and the ones delivered
+     * when the batches were committed.
+     */
+    uint m_batchedNotifications;
+    uint m_deliveredNotifications;
+
+    /**
+     * true if Unicode files are loaded with the XMIStreamLoader
+     */
+    bool m_bStreamingLoad;
+
+    /**
+     * true if the diagrams of a loaded document are only read when needed
+     */
+    bool m_bLazyDiagramLoad;
+
+    /**
+     * true if the model is saved with the XMIStreamWriter
+     */
+    bool m_bStreamingSave;
+
     /**
      * Documentation for the project.
      */
@@ -289,6 +386,11 @@ private:
      */
     QTimer * m_pAutoSaveTimer;
 
+    /**
+     * The job writing a snapshot of the model, 0 if none is running
+     */
+    XMISaveJob * m_pSaveJob;
+
     /**
      * Auxiliary to <docsettings> processing
      */
@@ -311,13 +413,20 @@ private:
      */
     bool m_bClosing;
 
+    int m_closeBlocked;  ///< number of running jobs using the document, see blockClose()
+
     StereotypesModel *m_stereotypesModel;
 
+    UMLFindIndex *m_findIndex;  ///< search index of the model, built on demand
+
 public slots:
     void slotRemoveUMLObject(UMLObject*o);
     void slotAutoSave();
     void slotDiagramPopupMenu(QWidget* umlview, const QPoint& point);
 
+private slots:
+    void slotBackgroundSaveFinished(bool success, const QString& errorMessage);
+
 signals:
     void sigDiagramCreated(Uml::ID::Type id);
     void sigDiagramRemoved(Uml::ID::Type id);
@@ -357,6 +466,22 @@ signals:
      */
     void sigCurrentViewChanged();
 
+    /**
+     * Progress of a save started by saveDocumentInBackground().
+     *
+     * @param written   Number of bytes written.
+     * @param total     Number of bytes to be written.
+     */
+    void sigBackgroundSaveProgress(qint64 written, qint64 total);
+
+    /**
+     * A save started by saveDocumentInBackground() has finished.
+     *
+     * @param success        True if the file has been written.
+     * @param errorMessage   The reason of the failure.
+     */
+    void sigBackgroundSaveFinished(bool success, const QString& errorMessage);
+
 };
 
 #endif // UMLDOC_H
@@ -88,6 +88,7 @@
 #include <QRegExp>
 #include <QPoint>
 #include <QRect>
+#include <QTimer>
 #include <QToolTip>
 
 DEBUG_REGISTER(UMLListView)
@@ -107,7 +108,8 @@ UMLListView::UMLListView(QWidget *parent)
     m_bStartedCopy(false),
     m_bCreatingChildObject(false),
     m_dragStartPosition(QPoint()),
-    m_dragCopyData(0)
+    m_dragCopyData(0),
+    m_sortingSuspended(false)
 {
     // setup list view
     setAcceptDrops(true);
@@ -940,6 +942,8 @@ void UMLListView::slotObjectCreated(UMLObject* object)
     if (parentItem == 0)
         return;
     UMLObject::ObjectType type = object->baseType();
+    if (m_doc->loading())
+        suspendSorting();
 
     connectNewObjectsSlots(object);
     const UMLListViewItem::ListViewType lvt = Model_Utils::convert_OT_LVT(object);
@@ -1255,11 +1259,7 @@ UMLListViewItem * UMLListView::findUMLObjectInFolder(UMLListViewItem* folder, UM
  */
 UMLListViewItem * UMLListView::findUMLObject(const UMLObject *p) const
 {
-    UMLListViewItem *item = m_rv;
-    UMLListViewItem *testItem = item->findUMLObject(p);
-    if (testItem)
-        return testItem;
-    return 0;
+    return UMLListViewItem::findIndexed(this, p);
 }
 
 /**
@@ -1273,7 +1273,7 @@ void UMLListView::changeIconOf(UMLObject *o, Icon_Utils::IconType to)
 }
 
 /**
- * Searches through the tree for the item which represents the diagram given.
+ * Finds the item which represents the diagram given.
  * @param v  the diagram to search for
  * @return the item which represents the diagram
  */
@@ -1283,72 +1283,36 @@ UMLListViewItem* UMLListView::findView(UMLView* v)
         uWarning() << "returning 0 - param is 0.";
         return 0;
     }
-    UMLListViewItem* item;
     Uml::DiagramType::Enum dType = v->umlScene()->type();
     UMLListViewItem::ListViewType type = Model_Utils::convert_DT_LVT(dType);
     Uml::ID::Type id = v->umlScene()->ID();
-    if (dType == Uml::DiagramType::UseCase) {
-        item = m_lv[Uml::ModelType::UseCase];
-    } else if (dType == Uml::DiagramType::Component) {
-        item = m_lv[Uml::ModelType::Component];
-    } else if (dType == Uml::DiagramType::Deployment) {
-        item = m_lv[Uml::ModelType::Deployment];
-    } else if (dType == Uml::DiagramType::EntityRelationship) {
-        item = m_lv[Uml::ModelType::EntityRelationship];
-    } else {
-        item = m_lv[Uml::ModelType::Logical];
-    }
-    for (int i=0; i < item->childCount(); i++) {
-        UMLListViewItem* foundItem = recursiveSearchForView(item->childItem(i), type, id);
-        if (foundItem) {
-            return foundItem;
-        }
+    UMLListViewItem* item = findItem(id);
+    if (item && item->type() == type) {
+        return item;
     }
     if (m_doc->loading()) {
-        DEBUG(DBG_SRC) << "could not find " << v->umlScene()->name() << " in " << *item;
+        DEBUG(DBG_SRC) << "could not find " << v->umlScene()->name();
     } else {
-        uWarning() << "could not find " << v->umlScene()->name() << " in " << *item;
+        uWarning() << "could not find " << v->umlScene()->name();
     }
     return 0;
 }
 
 /**
- * Searches the tree for a diagram (view).
- * Warning: these method may return in some cases the wrong diagram
- * Used by findView().
- */
-UMLListViewItem* UMLListView::recursiveSearchForView(UMLListViewItem* listViewItem,
-        UMLListViewItem::ListViewType type, Uml::ID::Type id)
-{
-    if (!listViewItem)
-        return 0;
-
-    if (Model_Utils::typeIsFolder(listViewItem->type())) {
-        for (int i=0; i < listViewItem->childCount(); i++) {
-            UMLListViewItem* child = listViewItem->childItem(i);
-            UMLListViewItem* resultListViewItem = recursiveSearchForView(child, type, id);
-            if (resultListViewItem)
-                return resultListViewItem;
-        }
-    } else {
-        if (listViewItem->type() == type && listViewItem->ID() == id)
-            return listViewItem;
-    }
-    return 0;
-}
-
-/**
- * Searches through the tree for the item with the given ID.
+ * Finds the item with the given ID by the index of all items.
  *
  * @param id   The ID to search for.
  * @return     The item with the given ID or 0 if not found.
  */
 UMLListViewItem* UMLListView::findItem(Uml::ID::Type id)
 {
-    UMLListViewItem *topLevel = m_rv;
-    UMLListViewItem *item = topLevel->findItem(id);
+    UMLListViewItem *item = UMLListViewItem::findIndexed(this, id);
     if (item)
         return item;
+    // the id of the object may have changed after its item was created
+    UMLObject *o = m_doc->findObjectById(id);
+    if (o)
+        return findUMLObject(o);
     return 0;
 }
 
@@ -1418,6 +1382,34 @@ void UMLListView::clean()
     //deleteChildrenOf(m_datatypeFolder);
 }
 
+/**
+ * Switches sorting off until control returns to the event loop.
+ * Used while a document is loaded or code is imported: with sorting
+ * enabled each new item is inserted at its sorted position and each
+ * change of its text schedules a new sort, instead the tree is sorted
+ * once after all items have been created.
+ */
+void UMLListView::suspendSorting()
+{
+    if (m_sortingSuspended || !isSortingEnabled())
+        return;
+    m_sortingSuspended = true;
+    setSortingEnabled(false);
+    QTimer::singleShot(0, this, SLOT(slotResumeSorting()));
+}
+
+/**
+ * Switches sorting on again after suspendSorting().
+ */
+void UMLListView::slotResumeSorting()
+{
+    if (!m_sortingSuspended)
+        return;
+    m_sortingSuspended = false;
+    setSortingEnabled(true);
+    sortByColumn(0, Qt::AscendingOrder);
+}
+
 /**
  * Set the current view to the given view.
  *
@@ -2310,6 +2302,7 @@ bool UMLListView::loadFromXMI(QDomElement & element)
     QDomNode node = element.firstChild();
     QDomElement domElement = node.toElement();
     m_doc->writeToStatusBar(i18n("Loading listview..."));
+    suspendSorting();
     while (!domElement.isNull()) {
         if (domElement.tagName() == QLatin1String("listitem")) {
             QString type = domElement.attribute(QLatin1String("type"), QLatin1String("-1"));
@@ -163,6 +163,7 @@ public slots:
 
     void slotCutSuccessful();
     void slotDeleteSelectedItems();
+    void slotResumeSorting();
 
 protected slots:
     void slotItemSelectionChanged();
@@ -170,10 +171,8 @@ protected slots:
     void slotCollapsed(QTreeWidgetItem* item);
 
 private:
-    UMLListViewItem* recursiveSearchForView(UMLListViewItem* folder,
-                                            UMLListViewItem::ListViewType type, Uml::ID::Type id);
-
     void setBackgroundColor(const QColor & color);
+    void suspendSorting();
 
     UMLListViewItem* m_rv;         ///< root view (home)
     UMLListViewItem* m_lv[Uml::ModelType::N_MODELTYPES];  ///< predefined list view roots
@@ -186,6 +185,7 @@ private:
     QPoint m_dragStartPosition;
     QMimeData* m_dragCopyData;
     QList<QTreeWidgetItem*> m_findItems;
+    bool m_sortingSuspended;  ///< sorting is switched off until the event loop is entered again
 };
 
 #endif
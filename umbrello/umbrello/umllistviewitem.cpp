@@ -45,6 +45,9 @@
 
 #define DBG_LVI QLatin1String("UMLListViewItem")
 
+UMLListViewItem::ObjectIndex UMLListViewItem::s_objectIndex;
+UMLListViewItem::IdIndex UMLListViewItem::s_idIndex;
+
 DEBUG_REGISTER(UMLListViewItem)
 
 /**
@@ -68,6 +71,7 @@ UMLListViewItem::UMLListViewItem(UMLListView * parent, const QString &name,
     if (o) {
         m_id = o->id();
     }
+    addToIndex();
     setIcon(Icon_Utils::it_Home);
     setText(name);
 }
@@ -121,6 +125,7 @@ UMLListViewItem::UMLListViewItem(UMLListViewItem * parent, const QString &name,
         updateObject();
         m_id = o->id();
     }
+    addToIndex();
     setText(name);
     if (!Model_Utils::typeIsRootView(t)) {
         setFlags(flags() | Qt::ItemIsEditable);
@@ -141,6 +146,7 @@ UMLListViewItem::UMLListViewItem(UMLListViewItem * parent, const QString &name,
     init();
     m_type = t;
     m_id = id;
+    addToIndex();
     switch (m_type) {
     case lvt_Collaboration_Diagram:
         setIcon(Icon_Utils::it_Diagram_Collaboration);
@@ -181,6 +187,7 @@ UMLListViewItem::UMLListViewItem(UMLListViewItem * parent, const QString &name,
  */
 UMLListViewItem::~UMLListViewItem()
 {
+    removeFromIndex();
 }
 
 /**
@@ -288,7 +295,9 @@ void UMLListViewItem::setID(Uml::ID::Type id)
                 << Uml::ID::toString(oid);
         }
     }
+    removeFromIndex();
     m_id = id;
+    addToIndex();
 }
 
 /**
@@ -298,7 +307,9 @@ void UMLListViewItem::setID(Uml::ID::Type id)
  */
 void UMLListViewItem::setUMLObject(UMLObject * obj)
 {
+    removeFromIndex();
     m_object = obj;
+    addToIndex();
 }
 
 /**
@@ -865,6 +876,82 @@ UMLListViewItem * UMLListViewItem::findItem(Uml::ID::Type id)
     return 0;
 }
 
+/**
+ * Find the item of the given tree which represents the given object
+ * by the index of all items.
+ *
+ * @param tree   The tree the item has to belong to.
+ * @param o      The object to search for.
+ * @return The item of the object or NULL if not found.
+ */
+UMLListViewItem* UMLListViewItem::findIndexed(const QTreeWidget *tree, const UMLObject *o)
+{
+    if (o == 0) {
+        return 0;
+    }
+    ObjectIndex::const_iterator it = s_objectIndex.constFind(o);
+    for (; it != s_objectIndex.constEnd() && it.key() == o; ++it) {
+        UMLListViewItem *item = it.value();
+        if (item->treeWidget() == tree && item->m_object == o) {
+            return item;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Find the item of the given tree with the given ID by the index of
+ * all items. Items representing an object are found by the ID they
+ * were created or loaded with; if the object has got a new ID since,
+ * the item has to be found by the object.
+ *
+ * @param tree   The tree the item has to belong to.
+ * @param id     The ID to search for.
+ * @return The item with the given ID or NULL if not found.
+ */
+UMLListViewItem* UMLListViewItem::findIndexed(const QTreeWidget *tree, Uml::ID::Type id)
+{
+    if (id == Uml::ID::None) {
+        return 0;
+    }
+    const QByteArray key = QByteArray::fromRawData(id.data(), int(id.size()));
+    IdIndex::const_iterator it = s_idIndex.constFind(key);
+    for (; it != s_idIndex.constEnd() && it.key() == key; ++it) {
+        UMLListViewItem *item = it.value();
+        if (item->treeWidget() == tree && item->ID() == id) {
+            return item;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Adds the item to the index under its current object and id.
+ */
+void UMLListViewItem::addToIndex()
+{
+    if (m_object) {
+        s_objectIndex.insert(m_object, this);
+    }
+    if (m_id != Uml::ID::None) {
+        s_idIndex.insert(QByteArray(m_id.data(), int(m_id.size())), this);
+    }
+}
+
+/**
+ * Removes the item from the index, must be called with the object and
+ * id it was added with.
+ */
+void UMLListViewItem::removeFromIndex()
+{
+    if (m_object) {
+        s_objectIndex.remove(m_object, this);
+    }
+    if (m_id != Uml::ID::None) {
+        s_idIndex.remove(QByteArray::fromRawData(m_id.data(), int(m_id.size())), this);
+    }
+}
+
 /**
  * Saves the listview item to a "listitem" tag.
  */
@@ -924,11 +1011,13 @@ bool UMLListViewItem::loadFromXMI(QDomElement& qElement)
         return false;
     }
 
+    removeFromIndex();
     m_id = Uml::ID::fromString(id);
     if (m_id != Uml::ID::None) {
         UMLListView* listView = static_cast<UMLListView*>(treeWidget());
         m_object = listView->document()->findObjectById(m_id);
     }
+    addToIndex();
     m_type = (ListViewType)(type.toInt());
     if (m_object)
         updateObject();
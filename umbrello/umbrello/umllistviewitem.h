@@ -15,7 +15,9 @@
 #include "icon_utils.h"
 
 #include <QDomDocument>
+#include <QByteArray>
 #include <QDomElement>
+#include <QHash>
 #include <QMap>
 #include <QTreeWidget>
 
@@ -144,6 +146,9 @@ public:
     UMLListViewItem* findChildObject(UMLClassifierListItem *cli);
     UMLListViewItem* findItem(Uml::ID::Type id);
 
+    static UMLListViewItem* findIndexed(const QTreeWidget *tree, const UMLObject *o);
+    static UMLListViewItem* findIndexed(const QTreeWidget *tree, Uml::ID::Type id);
+
     UMLListViewItem* childItem(int i);
 
     void saveToXMI(QDomDocument& qDoc, QDomElement& qElement);
@@ -160,6 +165,9 @@ protected:
 
     void cancelRenameWithMsg();
 
+    void addToIndex();
+    void removeFromIndex();
+
     /**
      * Auxiliary map of child UMLLisViewItems keyed by UMLClassifierListItem.
      * Used by findChildObject() for efficiency instead of looping using
@@ -174,6 +182,18 @@ protected:
     QString            m_label;
     ChildObjectMap     m_comap;
 
+    /**
+     * All existing items by the object they represent and by their own
+     * id, used by the find methods of UMLListView instead of walking the
+     * tree. The items are kept in the index when they are moved to
+     * another parent; a lookup only accepts items which are part of the
+     * given tree and still carry the searched id.
+     */
+    typedef QMultiHash<const UMLObject*, UMLListViewItem*> ObjectIndex;
+    typedef QMultiHash<QByteArray, UMLListViewItem*> IdIndex;
+    static ObjectIndex s_objectIndex;
+    static IdIndex     s_idIndex;
+
 };
 
 QDebug operator<<(QDebug dbg, const UMLListViewItem& item);
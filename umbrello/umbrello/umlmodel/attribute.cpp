@@ -116,7 +116,10 @@ void UMLAttribute::setInitialValue(const QString &iv)
 
 void UMLAttribute::setParmKind (Uml::ParameterDirection::Enum pk)
 {
-    m_ParmKind = pk;
+    if (m_ParmKind != pk) {
+        m_ParmKind = pk;
+        increaseGeneration();
+    }
 }
 
 Uml::ParameterDirection::Enum UMLAttribute::getParmKind() const
@@ -38,21 +38,141 @@
 #include <KMessageBox>
 
 // qt includes
+#include <QMultiHash>
+#include <QPair>
 #include <QPointer>
+#include <QVector>
 
 using namespace Uml;
 
 /**
  * @brief holds set of classifiers for recursive loop detection
+ *
+ * The set contains the classifiers on the path of the recursion.
  */
 class UMLClassifierSet: public QSet<UMLClassifier *> {
 public:
-    UMLClassifierSet() : level(0)
+    UMLClassifierSet() : level(0), loopFound(false)
     {
     }
     int level;
+    bool loopFound;  ///< results are not cached if set
+};
+
+/**
+ * @brief holds the lists derived from m_List of a classifier
+ *
+ * The own lists are valid as long as the generation of the classifier
+ * is the one they were built for, see UMLObject::generation(). The list
+ * of own and inherited operations records the generations of all
+ * classifiers it was built from.
+ */
+class UMLClassifierCache {
+public:
+    typedef QPair<QPointer<UMLClassifier>, uint> Dependency;
+
+    explicit UMLClassifierCache(uint generation)
+      : generation(generation),
+        hasAttributes(false),
+        hasOperations(false),
+        hasInheritedOps(false)
+    {
+    }
+
+    uint generation;
+    QHash<int, UMLClassifierListItemList> filtered;  ///< by object type
+    UMLAttributeList attributes;
+    bool hasAttributes;
+    UMLOperationList operations;
+    bool hasOperations;
+    UMLOperationList inheritedOps;                    ///< own and inherited operations
+    QVector<Dependency> dependencies;                 ///< of inheritedOps, including the classifier itself
+    bool hasInheritedOps;
 };
 
+/**
+ * Return the type of a classifier list item for comparing signatures.
+ * A return type "void" is the same as none.
+ */
+static UMLClassifier *signatureType(UMLClassifierListItem *item)
+{
+    UMLClassifier *type = item->getType();
+    if (type && type->name() == QLatin1String("void"))
+        return 0;
+    return type;
+}
+
+/**
+ * Return a hash of the name, the parameter names and types and the
+ * return type of an operation.
+ */
+static uint signatureHash(UMLOperation *op)
+{
+    uint h = qHash(op->name()) ^ qHash(signatureType(op));
+    foreach (UMLAttribute *param, op->getParmList()) {
+        h = h * 31 + qHash(param->name());
+        h = h * 31 + qHash(param->getType());
+    }
+    return h;
+}
+
+/**
+ * Return whether two operations have the same signature, i.e. the same
+ * text of UMLOperation::toString(Uml::SignatureType::SigNoVis), with
+ * types compared by identity.
+ * Unlike the rendered names, distinct types of the same name, e.g. from
+ * different packages, make different signatures, and a type rendered with
+ * and without its scope is the same type. Unresolved types are null and
+ * compare equal, as their rendered names were empty.
+ */
+static bool sameSignature(UMLOperation *a, UMLOperation *b)
+{
+    if (a->name() != b->name() || signatureType(a) != signatureType(b))
+        return false;
+    UMLAttributeList aParams = a->getParmList();
+    UMLAttributeList bParams = b->getParmList();
+    if (aParams.count() != bParams.count())
+        return false;
+    for (int i = 0; i < aParams.count(); ++i) {
+        UMLAttribute *ap = aParams.at(i);
+        UMLAttribute *bp = bParams.at(i);
+        if (ap->name() != bp->name() || ap->getType() != bp->getType() ||
+                ap->getParmKind() != bp->getParmKind() ||
+                ap->getInitialValue() != bp->getInitialValue())
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Add an operation to a set of signatures.
+ * @return false if the set already contains an operation with the same signature
+ */
+static bool insertSignature(QMultiHash<uint, UMLOperation*> &signatures, UMLOperation *op)
+{
+    const uint h = signatureHash(op);
+    QMultiHash<uint, UMLOperation*>::const_iterator it = signatures.constFind(h);
+    for (; it != signatures.constEnd() && it.key() == h; ++it) {
+        if (sameSignature(it.value(), op))
+            return false;
+    }
+    signatures.insert(h, op);
+    return true;
+}
+
+/**
+ * Return whether none of the classifiers a cached list was built from
+ * has been changed or deleted since.
+ */
+static bool isCurrent(const QVector<UMLClassifierCache::Dependency> &dependencies)
+{
+    foreach (const UMLClassifierCache::Dependency &d, dependencies) {
+        if (!d.first || d.first->generation() != d.second)
+            return false;
+    }
+    return true;
+}
+
 /**
  * Sets up a Classifier.
  *
@@ -65,6 +185,7 @@ UMLClassifier::UMLClassifier(const QString & name, Uml::ID::Type id)
     m_BaseType = UMLObject::ot_Class;  // default value
     m_pClassAssoc = NULL;
     m_isRef = false;
+    m_cache = 0;
 }
 
 /**
@@ -72,6 +193,7 @@ UMLClassifier::UMLClassifier(const QString & name, Uml::ID::Type id)
  */
 UMLClassifier::~UMLClassifier()
 {
+    delete m_cache;
 }
 
 /**
@@ -334,6 +456,7 @@ bool UMLClassifier::addOperation(UMLOperation* op, int position)
     else {
         m_List.append(op);
     }
+    indexSubordinate(op);
     emit operationAdded(op);
     UMLObject::emitModified();
     connect(op, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -379,6 +502,7 @@ int UMLClassifier::removeOperation(UMLOperation *op)
         uDebug() << "cannot find op " << op->name() << " in list";
         return -1;
     }
+    unindexSubordinate(op);
     // disconnection needed.
     // note that we don't delete the operation, just remove it from the Classifier
     disconnect(op, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -448,14 +572,17 @@ int UMLClassifier::attributes()
  */
 UMLAttributeList UMLClassifier::getAttributeList() const
 {
-    UMLAttributeList attributeList;
-    foreach (UMLObject* listItem, m_List) {
-        uIgnoreZeroPointer(listItem);
-        if (listItem->baseType() == UMLObject::ot_Attribute) {
-            attributeList.append(static_cast<UMLAttribute*>(listItem));
+    UMLClassifierCache *c = cache();
+    if (!c->hasAttributes) {
+        foreach (UMLObject* listItem, m_List) {
+            uIgnoreZeroPointer(listItem);
+            if (listItem->baseType() == UMLObject::ot_Attribute) {
+                c->attributes.append(static_cast<UMLAttribute*>(listItem));
+            }
         }
+        c->hasAttributes = true;
     }
-    return attributeList;
+    return c->attributes;
 }
 
 /**
@@ -669,6 +796,7 @@ void UMLClassifier::copyInto(UMLObject *lhs) const
     target->setBaseType(m_BaseType);
     // CHECK: association property m_pClassAssoc is not copied
     m_List.copyInto(&(target->m_List));
+    target->increaseGeneration();
 }
 
 /**
@@ -817,6 +945,7 @@ UMLAttribute* UMLClassifier::addAttribute(const QString &name, Uml::ID::Type id
     Uml::Visibility::Enum scope = Settings::optionState().classState.defaultAttributeScope;
     UMLAttribute *a = new UMLAttribute(this, name, id, scope);
     m_List.append(a);
+    indexSubordinate(a);
     emit attributeAdded(a);
     UMLObject::emitModified();
     connect(a, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -842,6 +971,7 @@ UMLAttribute* UMLClassifier::addAttribute(const QString &name, UMLObject *type,
         a->setType(type);
     }
     m_List.append(a);
+    indexSubordinate(a);
     emit attributeAdded(a);
     UMLObject::emitModified();
     connect(a, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -872,6 +1002,7 @@ bool UMLClassifier::addAttribute(UMLAttribute* att, IDChangeLog* log /* = 0 */,
         else {
             m_List.append(att);
         }
+        indexSubordinate(att);
         emit attributeAdded(att);
         UMLObject::emitModified();
         connect(att, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -896,6 +1027,7 @@ int UMLClassifier::removeAttribute(UMLAttribute* att)
         uDebug() << "cannot find att given in list";
         return -1;
     }
+    unindexSubordinate(att);
     emit attributeRemoved(att);
     UMLObject::emitModified();
     // If we are deleting the object, then we don't need to disconnect..this is done auto-magically
@@ -952,6 +1084,12 @@ int UMLClassifier::operations()
 
 /**
  * Return a list of operations for the Classifier.
+ * Inherited operations are only added if no operation of the list has the
+ * same signature.
+ *
+ * The lists are cached. The list including the inherited operations is
+ * rebuilt when this classifier or one of its ancestors has been changed,
+ * see UMLObject::generation().
  *
  * @param includeInherited   Includes operations from superclasses.
  * @param alreadyTraversed   internal used object to avoid recursive loops
@@ -959,53 +1097,77 @@ int UMLClassifier::operations()
  */
 UMLOperationList UMLClassifier::getOpList(bool includeInherited, UMLClassifierSet *alreadyTraversed)
 {
-    UMLOperationList ops;
-    foreach (UMLObject* li, m_List) {
-        uIgnoreZeroPointer(li);
-        if (li->baseType() == ot_Operation) {
-            ops.append(static_cast<UMLOperation*>(li));
+    UMLClassifierCache *c = cache();
+    if (!c->hasOperations) {
+        foreach (UMLObject* li, m_List) {
+            uIgnoreZeroPointer(li);
+            if (li->baseType() == ot_Operation) {
+                c->operations.append(static_cast<UMLOperation*>(li));
+            }
         }
+        c->hasOperations = true;
+    }
+    if (!includeInherited) {
+        return c->operations;
+    }
+    if (c->hasInheritedOps && isCurrent(c->dependencies)) {
+        return c->inheritedOps;
     }
-    if (includeInherited) {
-        if (!alreadyTraversed) {
-            alreadyTraversed = new UMLClassifierSet;
-        }
-        else
-            alreadyTraversed->level++;
 
-        if (!alreadyTraversed->contains(this))
-            *alreadyTraversed << this;
+    if (!alreadyTraversed) {
+        alreadyTraversed = new UMLClassifierSet;
+    }
+    else
+        alreadyTraversed->level++;
+    *alreadyTraversed << this;
 
-        // get a list of parents of this class
-        UMLClassifierList parents = findSuperClassConcepts();
-        foreach(UMLClassifier *c, parents) {
-            if (alreadyTraversed->contains(c)) {
-                uError() << "class " << c->name() << " is starting a dependency loop!";
-                continue;
-            }
-            // get operations for each parent by recursive call
-            UMLOperationList pops = c->getOpList(true, alreadyTraversed);
-            // add these operations to operation list, but only if unique.
-            foreach (UMLOperation *po, pops) {
-                QString po_as_string(po->toString(Uml::SignatureType::SigNoVis));
-                bool breakFlag = false;
-                foreach (UMLOperation* o,  ops) {
-                    if (o->toString(Uml::SignatureType::SigNoVis) == po_as_string) {
-                        breakFlag = true;
-                        break;
-                    }
+    UMLOperationList ops = c->operations;
+    QMultiHash<uint, UMLOperation*> signatures;
+    foreach (UMLOperation *o, ops) {
+        signatures.insert(signatureHash(o), o);
+    }
+    QVector<UMLClassifierCache::Dependency> dependencies;
+    dependencies << UMLClassifierCache::Dependency(this, generation());
+    QSet<UMLClassifier*> dependent;
+    dependent << this;
+
+    // get a list of parents of this class
+    UMLClassifierList parents = findSuperClassConcepts();
+    foreach(UMLClassifier *p, parents) {
+        if (alreadyTraversed->contains(p)) {
+            uError() << "class " << p->name() << " is starting a dependency loop!";
+            alreadyTraversed->loopFound = true;
+            continue;
+        }
+        // get operations for each parent by recursive call
+        UMLOperationList pops = p->getOpList(true, alreadyTraversed);
+        // add these operations to operation list, but only if unique.
+        foreach (UMLOperation *po, pops) {
+            if (insertSignature(signatures, po))
+                ops.append(po);
+        }
+        // remember the classifiers the parent's list was built from
+        if (p->m_cache->hasInheritedOps) {
+            foreach (const UMLClassifierCache::Dependency &d, p->m_cache->dependencies) {
+                if (!dependent.contains(d.first)) {
+                    dependent << d.first;
+                    dependencies << d;
                 }
-                if (breakFlag == false)
-                    ops.append(po);
             }
-            // remember this node
-            *alreadyTraversed << c;
-        }
-        if (alreadyTraversed->level-- == 0) {
-            delete alreadyTraversed;
-            alreadyTraversed = 0;
         }
     }
+
+    alreadyTraversed->remove(this);
+    const bool loopFound = alreadyTraversed->loopFound;
+    if (alreadyTraversed->level-- == 0) {
+        delete alreadyTraversed;
+        alreadyTraversed = 0;
+    }
+    if (!loopFound) {
+        c->inheritedOps = ops;
+        c->dependencies = dependencies;
+        c->hasInheritedOps = true;
+    }
     return ops;
 }
 
@@ -1018,6 +1180,11 @@ UMLOperationList UMLClassifier::getOpList(bool includeInherited, UMLClassifierSe
  */
 UMLClassifierListItemList UMLClassifier::getFilteredList(UMLObject::ObjectType ot) const
 {
+    UMLClassifierCache *c = cache();
+    QHash<int, UMLClassifierListItemList>::const_iterator it = c->filtered.constFind(ot);
+    if (it != c->filtered.constEnd()) {
+        return it.value();
+    }
     UMLClassifierListItemList resultList;
     foreach (UMLObject* o, m_List) {
         uIgnoreZeroPointer(o);
@@ -1029,9 +1196,32 @@ UMLClassifierListItemList UMLClassifier::getFilteredList(UMLObject::ObjectType o
             resultList.append(listItem);
         }
     }
+    c->filtered.insert(ot, resultList);
     return resultList;
 }
 
+/**
+ * Return the cached lists. The lists derived from m_List alone are
+ * dropped if this classifier has been changed since they were built.
+ */
+UMLClassifierCache *UMLClassifier::cache() const
+{
+    if (!m_cache) {
+        m_cache = new UMLClassifierCache(generation());
+    } else if (m_cache->generation != generation()) {
+        m_cache->generation = generation();
+        m_cache->filtered.clear();
+        m_cache->attributes.clear();
+        m_cache->hasAttributes = false;
+        m_cache->operations.clear();
+        m_cache->hasOperations = false;
+        m_cache->inheritedOps.clear();
+        m_cache->dependencies.clear();
+        m_cache->hasInheritedOps = false;
+    }
+    return m_cache;
+}
+
 /**
  * Adds an already created template.
  * The template object must not belong to any other concept.
@@ -1048,6 +1238,7 @@ UMLTemplate* UMLClassifier::addTemplate(const QString &name, Uml::ID::Type id)
     }
     templt = new UMLTemplate(this, name, id);
     m_List.append(templt);
+    indexSubordinate(templt);
     emit templateAdded(templt);
     UMLObject::emitModified();
     connect(templt, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -1068,6 +1259,7 @@ bool UMLClassifier::addTemplate(UMLTemplate* newTemplate, IDChangeLog* log /* =
     if (findChildObject(name) == NULL) {
         newTemplate->setParent(this);
         m_List.append(newTemplate);
+        indexSubordinate(newTemplate);
         emit templateAdded(newTemplate);
         UMLObject::emitModified();
         connect(newTemplate, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -1102,6 +1294,7 @@ bool UMLClassifier::addTemplate(UMLTemplate* templt, int position)
         else {
             m_List.append(templt);
         }
+        indexSubordinate(templt);
         emit templateAdded(templt);
         UMLObject::emitModified();
         connect(templt, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -1124,6 +1317,7 @@ int UMLClassifier::removeTemplate(UMLTemplate* umltemplate)
         uWarning() << "cannot find att given in list";
         return -1;
     }
+    unindexSubordinate(umltemplate);
     emit templateRemoved(umltemplate);
     UMLObject::emitModified();
     disconnect(umltemplate, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -1254,6 +1448,9 @@ int UMLClassifier::takeItem(UMLClassifierListItem *item)
             index = -1;
             break;
     }
+    if (index != -1) {
+        unindexSubordinate(item);
+    }
     return index;
 }
 
@@ -22,6 +22,7 @@
 class UMLAssociation;
 class IDChangeLog;
 class UMLClassifierSet;
+class UMLClassifierCache;
 
 /**
  * This class defines the non-graphical information required for a
@@ -180,6 +181,10 @@ private:
 
     bool m_isRef;
 
+    mutable UMLClassifierCache *m_cache;  ///< lists derived from m_List, see getOpList()
+
+    UMLClassifierCache *cache() const;
+
     /**
      * Utility method called by "get*ChildClassfierList()" methods. It basically
      * finds all the classifiers named in each association in the given association list
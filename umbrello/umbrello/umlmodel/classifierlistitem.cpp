@@ -141,6 +141,7 @@ void UMLClassifierListItem::setTypeName(const QString &type)
     if (type.isEmpty() || type == QLatin1String("void")) {
         m_pSecondary = NULL;
         m_SecondaryId.clear();
+        increaseGeneration();
         return;
     }
     UMLDoc *pDoc = UMLApp::app()->document();
@@ -306,6 +306,7 @@ UMLObject* UMLEntity::addEntityAttribute(const QString& name, Uml::ID::Type id)
 {
     UMLEntityAttribute* literal = new UMLEntityAttribute(this, name, id);
     m_List.append(literal);
+    indexSubordinate(literal);
     emit entityAttributeAdded(literal);
     UMLObject::emitModified();
     connect(literal, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -325,6 +326,7 @@ bool UMLEntity::addEntityAttribute(UMLEntityAttribute* att, IDChangeLog* log /*
     if (findChildObject(name) == NULL) {
         att->setParent(this);
         m_List.append(att);
+        indexSubordinate(att);
         emit entityAttributeAdded(att);
         UMLObject::emitModified();
         connect(att, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -356,6 +358,7 @@ bool UMLEntity::addEntityAttribute(UMLEntityAttribute* att, int position)
         } else {
             m_List.append(att);
         }
+        indexSubordinate(att);
         emit entityAttributeAdded(att);
         UMLObject::emitModified();
         connect(att, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -376,6 +379,7 @@ int UMLEntity::removeEntityAttribute(UMLClassifierListItem* att)
         uDebug() << "cannot find att given in list";
         return -1;
     }
+    unindexSubordinate(att);
     emit entityAttributeRemoved(att);
     UMLObject::emitModified();
     // If we are deleting the object, then we don't need to disconnect..this is done auto-magically
@@ -470,6 +474,7 @@ bool UMLEntity::load(QDomElement& element)
                 return false;
             }
             m_List.append(pEntityAttribute);
+            indexSubordinate(pEntityAttribute);
         } else if (UMLDoc::tagEq(tag, QLatin1String("UniqueConstraint"))) {
             UMLUniqueConstraint* pUniqueConstraint = new UMLUniqueConstraint(this);
             if (!pUniqueConstraint->loadFromXMI(tempElement)) {
@@ -580,6 +585,7 @@ bool UMLEntity::addConstraint(UMLEntityConstraint* constr)
     }
 
     m_List.append(constr);
+    indexSubordinate(constr);
 
     emit entityConstraintAdded(constr);
     UMLObject::emitModified();
@@ -607,6 +613,7 @@ bool UMLEntity::removeConstraint(UMLEntityConstraint* constr)
     }
 
     m_List.removeAll(constr);
+    unindexSubordinate(constr);
 
     emit entityConstraintRemoved(constr);
     UMLObject::emitModified();
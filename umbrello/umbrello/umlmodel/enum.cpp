@@ -138,6 +138,7 @@ UMLObject* UMLEnum::addEnumLiteral(const QString &name, Uml::ID::Type id, const
     }
     UMLEnumLiteral* literal = new UMLEnumLiteral(this, name, id, value);
     m_List.append(literal);
+    indexSubordinate(literal);
     UMLObject::emitModified();
     emit enumLiteralAdded(literal);
     connect(literal, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -157,6 +158,7 @@ bool UMLEnum::addEnumLiteral(UMLEnumLiteral* literal, IDChangeLog* Log /* = 0*/)
     if (findChildObject(name) == NULL) {
         literal->setParent(this);
         m_List.append(literal);
+        indexSubordinate(literal);
         UMLObject::emitModified();
         emit enumLiteralAdded(literal);
         connect(literal, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -188,6 +190,7 @@ bool UMLEnum::addEnumLiteral(UMLEnumLiteral* literal, int position)
         } else {
             m_List.append(literal);
         }
+        indexSubordinate(literal);
         UMLObject::emitModified();
         emit enumLiteralAdded(literal);
         connect(literal, SIGNAL(modified()), this, SIGNAL(modified()));
@@ -208,6 +211,7 @@ int UMLEnum::removeEnumLiteral(UMLEnumLiteral* literal)
         uDebug() << "cannot find att given in list";
         return -1;
     }
+    unindexSubordinate(literal);
     emit enumLiteralRemoved(literal);
     UMLObject::emitModified();
     // If we are deleting the object, then we don't need to disconnect..this is done auto-magically
@@ -269,6 +273,7 @@ bool UMLEnum::load(QDomElement& element)
                 return false;
             }
             m_List.append(pEnumLiteral);
+            indexSubordinate(pEnumLiteral);
         } else if (UMLDoc::tagEq(tag, QLatin1String("Enumeration.literal"))) {  // Embarcadero's Describe
             if (! load(tempElement))
                 return false;
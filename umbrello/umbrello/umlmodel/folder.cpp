@@ -12,21 +12,176 @@
 #include "folder.h"
 
 // app includes
+#include "classifierlistitem.h"
 #include "debug_utils.h"
 #include "model_utils.h"
 #include "object_factory.h"
 #include "optionstate.h"
 #include "uml.h"
 #include "umldoc.h"
+#include "umllistview.h"
 #include "umlscene.h"
 #include "umlview.h"
+#include "xmistreamwriter.h"
 
 // kde includes
 #include <KLocalizedString>
 #include <KMessageBox>
 
 // qt includes
+#include <QDomDocument>
 #include <QFile>
+#include <QTextStream>
+
+/**
+ * Return the <diagram> element of a deferred view as part of the given
+ * document.
+ */
+static QDomElement deferredElement(const QByteArray& xmi, QDomDocument& qDoc)
+{
+    QDomDocument doc;
+    doc.setContent(qUncompress(xmi));
+    return qDoc.importNode(doc.documentElement(), true).toElement();
+}
+
+/**
+ * Return the tag name of the element a folder is saved as:
+ * UML:Model for the predefined root folders, UML:Package else.
+ */
+static QString folderElementName(UMLFolder *folder)
+{
+    UMLDoc *umldoc = UMLApp::app()->document();
+    if (umldoc->rootFolderType(folder) != Uml::ModelType::N_MODELTYPES) {
+        return QLatin1String("UML:Model");
+    }
+    return QLatin1String("UML:Package");
+}
+
+/**
+ * Receives the contents of a folder from UMLFolder::writeContents().
+ * Elements are opened and closed with writeStartElement() and
+ * writeEndElement(), everything else is written as child of the
+ * innermost open element.
+ */
+class FolderContentsWriter
+{
+public:
+    explicit FolderContentsWriter(QDomDocument& qDoc) : m_qDoc(qDoc) {}
+    virtual ~FolderContentsWriter() {}
+
+    QDomDocument& document() { return m_qDoc; }
+
+    virtual void writeStartElement(QDomElement element) = 0;
+    virtual void writeEndElement() = 0;
+    virtual void writeElement(QDomElement element) = 0;
+    virtual void writeObject(UMLObject *obj) = 0;
+    virtual void writeDiagram(UMLView *view) = 0;
+
+protected:
+    QDomDocument& m_qDoc;
+};
+
+/**
+ * Appends the contents of a folder to an element of a QDomDocument.
+ */
+class FolderDomWriter : public FolderContentsWriter
+{
+public:
+    FolderDomWriter(QDomDocument& qDoc, QDomElement& qElement)
+      : FolderContentsWriter(qDoc)
+    {
+        m_elements.append(qElement);
+    }
+
+    void writeStartElement(QDomElement element)
+    {
+        m_elements.last().appendChild(element);
+        m_elements.append(element);
+    }
+
+    void writeEndElement()
+    {
+        m_elements.removeLast();
+    }
+
+    void writeElement(QDomElement element)
+    {
+        m_elements.last().appendChild(element);
+    }
+
+    void writeObject(UMLObject *obj)
+    {
+        obj->saveToXMI(m_qDoc, m_elements.last());
+    }
+
+    void writeDiagram(UMLView *view)
+    {
+        view->umlScene()->saveToXMI(m_qDoc, m_elements.last());
+    }
+
+private:
+    QList<QDomElement> m_elements;  ///< the open elements, innermost last
+};
+
+/**
+ * Writes the contents of a folder with an XMIStreamWriter, one object
+ * and one diagram at a time.
+ */
+class FolderStreamWriter : public FolderContentsWriter
+{
+public:
+    FolderStreamWriter(QDomDocument& qDoc, XMIStreamWriter& writer)
+      : FolderContentsWriter(qDoc),
+        m_writer(writer),
+        m_fragment(qDoc.createElement(QLatin1String("fragment")))
+    {
+    }
+
+    void writeStartElement(QDomElement element)
+    {
+        m_writer.writeStartElement(element);
+    }
+
+    void writeEndElement()
+    {
+        m_writer.writeEndElement();
+    }
+
+    void writeElement(QDomElement element)
+    {
+        m_writer.writeElement(element);
+    }
+
+    void writeObject(UMLObject *obj)
+    {
+        obj->streamToXMI(m_writer);
+    }
+
+    void writeDiagram(UMLView *view)
+    {
+        view->umlScene()->saveToXMI(m_qDoc, m_fragment);
+        m_writer.writeChildren(m_fragment);
+    }
+
+private:
+    XMIStreamWriter& m_writer;
+    QDomElement m_fragment;  ///< parent of the diagram being written
+};
+
+/**
+ * Add the ID read from an attribute of a deferred diagram to the IDs
+ * of the objects shown on it, unless it is empty or no ID.
+ */
+static void addDeferredObjectId(QList<Uml::ID::Type>& objectIds, const QString& attribute)
+{
+    if (attribute.isEmpty()) {
+        return;
+    }
+    const Uml::ID::Type id = Uml::ID::fromString(attribute);
+    if (id != Uml::ID::None) {
+        objectIds.append(id);
+    }
+}
 
 /**
  * Sets up a Folder.
@@ -93,12 +248,22 @@ void UMLFolder::addView(UMLView *view)
  */
 void UMLFolder::removeView(UMLView *view)
 {
-    m_diagrams.removeAll(view);
+    const int index = m_diagrams.indexOf(view);
+    if (index >= 0) {
+        const int position = viewPosition(index);
+        m_diagrams.removeAt(index);
+        for (int i = 0; i < m_deferredViews.count(); ++i) {
+            if (m_deferredViews[i].position > position) {
+                --m_deferredViews[i].position;
+            }
+        }
+    }
     delete view;
 }
 
 /**
  * Append the views in this folder to the given diagram list.
+ * Diagrams which have not been loaded yet are loaded first.
  * @param viewList       The UMLViewList to which to append the diagrams.
  * @param includeNested  Whether to include diagrams from nested folders
  *                       (default: true.)
@@ -114,11 +279,66 @@ void UMLFolder::appendViews(UMLViewList& viewList, bool includeNested)
             }
         }
     }
+    loadDeferredViews();
+    foreach (UMLView* v, m_diagrams) {
+        viewList.append(v);
+    }
+}
+
+/**
+ * Append the views in this folder which have already been loaded to the
+ * given diagram list.
+ * @param viewList       The UMLViewList to which to append the diagrams.
+ * @param includeNested  Whether to include diagrams from nested folders
+ *                       (default: true.)
+ */
+void UMLFolder::appendLoadedViews(UMLViewList& viewList, bool includeNested)
+{
+    if (includeNested) {
+        foreach (UMLObject* o, m_objects) {
+            uIgnoreZeroPointer(o);
+            if (o->baseType() == UMLObject::ot_Folder) {
+                UMLFolder *f = static_cast<UMLFolder*>(o);
+                f->appendLoadedViews(viewList);
+            }
+        }
+    }
     foreach (UMLView* v, m_diagrams) {
         viewList.append(v);
     }
 }
 
+/**
+ * Append the IDs and names of all views in this folder to the given list,
+ * in the order of appendViews(), without loading any diagram.
+ * @param names          The list to which to append the diagrams.
+ * @param includeNested  Whether to include diagrams from nested folders
+ *                       (default: true.)
+ */
+void UMLFolder::appendViewNames(QList<QPair<Uml::ID::Type, QString> >& names, bool includeNested)
+{
+    if (includeNested) {
+        foreach (UMLObject* o, m_objects) {
+            uIgnoreZeroPointer(o);
+            if (o->baseType() == UMLObject::ot_Folder) {
+                UMLFolder *f = static_cast<UMLFolder*>(o);
+                f->appendViewNames(names);
+            }
+        }
+    }
+    int next = 0;
+    for (int i = 0; i < m_diagrams.count(); ++i) {
+        for (; next < m_deferredViews.count() && m_deferredViews[next].position <= viewPosition(i); ++next) {
+            names.append(qMakePair(m_deferredViews[next].id, m_deferredViews[next].name));
+        }
+        UMLScene *scene = m_diagrams[i]->umlScene();
+        names.append(qMakePair(scene->ID(), scene->name()));
+    }
+    for (; next < m_deferredViews.count(); ++next) {
+        names.append(qMakePair(m_deferredViews[next].id, m_deferredViews[next].name));
+    }
+}
+
 /**
  * Acivate the views in this folder.
  * "Activation": Some widgets require adjustments after loading from file,
@@ -134,12 +354,22 @@ void UMLFolder::activateViews()
         }
     }
 
-    foreach (UMLView* v, m_diagrams) {
-        v->umlScene()->activateAfterLoad();
-    }
     // Make sure we have a treeview item for each diagram.
     // It may happen that we are missing them after switching off tabbed widgets.
     Settings::OptionState optionState = Settings::optionState();
+    if (!optionState.generalState.tabdiagrams) {
+        // deferred diagrams without item are loaded to create the item
+        UMLListView *tree = UMLApp::app()->listView();
+        for (int i = m_deferredViews.count() - 1; tree && i >= 0; --i) {
+            if (tree->findItem(m_deferredViews[i].id) == 0) {
+                loadDeferredView(i);
+            }
+        }
+    }
+
+    foreach (UMLView* v, m_diagrams) {
+        v->umlScene()->activateAfterLoad();
+    }
     if (optionState.generalState.tabdiagrams) {
         return;
     }
@@ -158,6 +388,11 @@ UMLView *UMLFolder::findView(Uml::ID::Type id)
             return v;
         }
     }
+    for (int i = 0; i < m_deferredViews.count(); ++i) {
+        if (m_deferredViews[i].id == id) {
+            return loadDeferredView(i);
+        }
+    }
 
     UMLView* v = 0;
     UMLPackageList packages;
@@ -189,6 +424,11 @@ UMLView *UMLFolder::findView(Uml::DiagramType::Enum type, const QString &name, b
             return v;
         }
     }
+    for (int i = 0; i < m_deferredViews.count(); ++i) {
+        if (m_deferredViews[i].type == type && m_deferredViews[i].name == name) {
+            return loadDeferredView(i);
+        }
+    }
 
     UMLView* v = 0;
     if (searchAllScopes) {
@@ -243,6 +483,159 @@ void UMLFolder::removeAllViews()
 
     qDeleteAll(m_diagrams);
     m_diagrams.clear();
+    m_deferredViews.clear();
+}
+
+/**
+ * Replace a loaded view by its XMI, which is loaded again when the view
+ * is needed. The view is deleted.
+ * @param view   The view to unload, it must not be the current view.
+ */
+void UMLFolder::unloadView(UMLView *view)
+{
+    const int index = m_diagrams.indexOf(view);
+    if (index < 0) {
+        uWarning() << "view" << view->umlScene()->name() << "is not in folder" << name();
+        return;
+    }
+    QDomDocument qDoc;
+    QDomElement diagrams = qDoc.createElement(QLatin1String("diagrams"));
+    view->umlScene()->saveToXMI(qDoc, diagrams);
+    const int position = viewPosition(index);
+    m_diagrams.removeAt(index);
+    if (!deferView(diagrams.firstChildElement())) {
+        m_diagrams.insert(index, view);
+        return;
+    }
+    // deferView() appends the view at the end
+    DeferredView deferred = m_deferredViews.takeLast();
+    deferred.position = position;
+    int i = 0;
+    while (i < m_deferredViews.count() && m_deferredViews[i].position < position) {
+        ++i;
+    }
+    m_deferredViews.insert(i, deferred);
+    delete view;
+}
+
+/**
+ * Return the number of diagrams which have not been loaded yet.
+ * @param includeNested  Whether to include diagrams from nested folders
+ *                       (default: true.)
+ */
+int UMLFolder::unloadedViewCount(bool includeNested) const
+{
+    int count = m_deferredViews.count();
+    if (includeNested) {
+        foreach (UMLObject* o, m_objects) {
+            uIgnoreZeroPointer(o);
+            if (o->baseType() == UMLObject::ot_Folder) {
+                count += static_cast<UMLFolder*>(o)->unloadedViewCount();
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Find a diagram which has not been loaded yet in this folder or its
+ * nested folders and return the IDs of the objects shown on it.
+ * @param id          ID of the diagram.
+ * @param objectIds   Receives the xmi.id attributes of its widgets.
+ * @return  True if the diagram was found.
+ */
+bool UMLFolder::deferredViewObjects(Uml::ID::Type id, QList<Uml::ID::Type>& objectIds) const
+{
+    foreach (const DeferredView& view, m_deferredViews) {
+        if (view.id == id) {
+            objectIds = view.objectIds;
+            return true;
+        }
+    }
+    foreach (UMLObject* o, m_objects) {
+        uIgnoreZeroPointer(o);
+        if (o->baseType() == UMLObject::ot_Folder &&
+                static_cast<UMLFolder*>(o)->deferredViewObjects(id, objectIds)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Update the diagrams of this folder and its nested folders which have
+ * not been loaded yet and show the given object, before the object is
+ * removed from the model. Deferred diagrams are saved as they were read
+ * and would otherwise keep referring to the removed object.
+ * Associations are removed from the XMI of the diagrams and messages
+ * keep the text of a removed operation as their custom operation.
+ * Diagrams with a widget of another object are loaded, the loaded
+ * views remove the widget and its associations like any other view.
+ * @param object   The object to be removed.
+ */
+void UMLFolder::removeFromDeferredViews(UMLObject *object)
+{
+    const Uml::ID::Type id = object->id();
+    for (int i = m_deferredViews.count() - 1; i >= 0; --i) {
+        if (!m_deferredViews[i].objectIds.contains(id)) {
+            continue;
+        }
+        if (object->baseType() == UMLObject::ot_Association ||
+                object->baseType() == UMLObject::ot_Operation) {
+            pruneDeferredView(i, object);
+        } else {
+            loadDeferredView(i);
+        }
+    }
+    foreach (UMLObject* o, m_objects) {
+        uIgnoreZeroPointer(o);
+        if (o->baseType() == UMLObject::ot_Folder) {
+            static_cast<UMLFolder*>(o)->removeFromDeferredViews(object);
+        }
+    }
+}
+
+/**
+ * Auxiliary to removeFromDeferredViews(): Remove the references to an
+ * association or operation from the XMI of a deferred diagram.
+ * @param index    The index of the diagram in m_deferredViews.
+ * @param object   The association or operation.
+ */
+void UMLFolder::pruneDeferredView(int index, UMLObject *object)
+{
+    DeferredView& deferred = m_deferredViews[index];
+    QDomDocument doc;
+    if (!doc.setContent(qUncompress(deferred.xmi))) {
+        uError() << "cannot parse diagram" << deferred.name;
+        return;
+    }
+    const QString id = Uml::ID::toString(object->id());
+    QDomElement diagram = doc.documentElement();
+    if (object->baseType() == UMLObject::ot_Association) {
+        QDomElement associations = diagram.firstChildElement(QLatin1String("associations"));
+        QDomElement assoc = associations.firstChildElement();
+        while (!assoc.isNull()) {
+            QDomElement next = assoc.nextSiblingElement();
+            if (assoc.attribute(QLatin1String("xmi.id")) == id) {
+                associations.removeChild(assoc);
+            }
+            assoc = next;
+        }
+    } else {
+        const QString text = static_cast<UMLClassifierListItem*>(object)->toString(Uml::SignatureType::SigNoVis);
+        QDomElement message = diagram.firstChildElement(QLatin1String("messages")).firstChildElement();
+        for (; !message.isNull(); message = message.nextSiblingElement()) {
+            if (message.attribute(QLatin1String("operation")) == id) {
+                message.setAttribute(QLatin1String("operation"), text);
+            }
+        }
+    }
+    QString text;
+    QTextStream stream(&text, QIODevice::WriteOnly);
+    diagram.save(stream, 0);
+    stream.flush();
+    deferred.xmi = qCompress(text.toUtf8());
+    deferred.objectIds.removeAll(object->id());
 }
 
 /**
@@ -268,31 +661,51 @@ QString UMLFolder::folderFile() const
  */
 void UMLFolder::saveContents(QDomDocument& qDoc, QDomElement& qElement)
 {
-    QDomElement ownedElement = qDoc.createElement(QLatin1String("UML:Namespace.ownedElement"));
+    FolderDomWriter out(qDoc, qElement);
+    writeContents(out);
+}
+
+/**
+ * Walk the contained objects and diagrams in the order they are saved
+ * and pass them to @p out. This is the traversal shared by
+ * saveContents() and streamToXMI(), which only differ in the writer.
+ */
+void UMLFolder::writeContents(FolderContentsWriter& out)
+{
+    QDomDocument& qDoc = out.document();
+    out.writeStartElement(qDoc.createElement(QLatin1String("UML:Namespace.ownedElement")));
     UMLObject *obj = 0;
     // Save contained objects if any.
     for (UMLObjectListIt oit(m_objects); oit.hasNext();) {
         obj = oit.next();
         uIgnoreZeroPointer(obj);
-        obj->saveToXMI (qDoc, ownedElement);
+        out.writeObject(obj);
     }
     // Save asscociations if any.
     for (UMLObjectListIt ait(m_List); ait.hasNext();) {
         obj = ait.next();
-        obj->saveToXMI (qDoc, ownedElement);
+        out.writeObject(obj);
     }
-    qElement.appendChild(ownedElement);
+    out.writeEndElement();
     // Save diagrams to `extension'.
-    if (m_diagrams.count()) {
-        QDomElement diagramsElement = qDoc.createElement(QLatin1String("diagrams"));
-
-        foreach (UMLView* pView, m_diagrams) {
-            pView->umlScene()->saveToXMI(qDoc, diagramsElement);
-        }
+    if (m_diagrams.count() || m_deferredViews.count()) {
         QDomElement extension = qDoc.createElement(QLatin1String("XMI.extension"));
         extension.setAttribute(QLatin1String("xmi.extender"), QLatin1String("umbrello"));
-        extension.appendChild(diagramsElement);
-        qElement.appendChild(extension);
+        out.writeStartElement(extension);
+        out.writeStartElement(qDoc.createElement(QLatin1String("diagrams")));
+        // diagrams which were not loaded are saved as they were read
+        int next = 0;
+        for (int i = 0; i < m_diagrams.count(); ++i) {
+            for (; next < m_deferredViews.count() && m_deferredViews[next].position <= viewPosition(i); ++next) {
+                out.writeElement(deferredElement(m_deferredViews[next].xmi, qDoc));
+            }
+            out.writeDiagram(m_diagrams[i]);
+        }
+        for (; next < m_deferredViews.count(); ++next) {
+            out.writeElement(deferredElement(m_deferredViews[next].xmi, qDoc));
+        }
+        out.writeEndElement();
+        out.writeEndElement();
     }
 }
 
@@ -304,13 +717,7 @@ void UMLFolder::saveContents(QDomDocument& qDoc, QDomElement& qElement)
  */
 void UMLFolder::save(QDomDocument& qDoc, QDomElement& qElement)
 {
-    UMLDoc *umldoc = UMLApp::app()->document();
-    QString elementName(QLatin1String("UML:Package"));
-    const Uml::ModelType::Enum mt = umldoc->rootFolderType(this);
-    if (mt != Uml::ModelType::N_MODELTYPES) {
-        elementName = QLatin1String("UML:Model");
-    }
-    QDomElement folderElement = UMLObject::save(elementName, qDoc);
+    QDomElement folderElement = UMLObject::save(folderElementName(this), qDoc);
     saveContents(qDoc, folderElement);
     qElement.appendChild(folderElement);
 }
@@ -373,14 +780,39 @@ void UMLFolder::saveToXMI(QDomDocument& qDoc, QDomElement& qElement)
     file.close();
 }
 
+/**
+ * Streaming counterpart of saveToXMI(): Writes the <UML:Model> or
+ * <UML:Package> element with the XMIStreamWriter, one contained object
+ * and one diagram at a time, so that the folder is never held as a
+ * whole in a QDomDocument. Folders saved to an external folder file
+ * are written by saveToXMI().
+ *
+ * @param writer   The writer of the XMI file.
+ */
+void UMLFolder::streamToXMI(XMIStreamWriter& writer)
+{
+    if (!m_folderFile.isEmpty()) {
+        UMLPackage::streamToXMI(writer);
+        return;
+    }
+    QDomDocument qDoc;
+    writer.writeStartElement(UMLObject::save(folderElementName(this), qDoc));
+    FolderStreamWriter out(qDoc, writer);
+    writeContents(out);
+    writer.writeEndElement();
+}
+
 /**
  * Auxiliary to load():
  * Load the diagrams from the "diagrams" in the <XMI.extension>
+ * While a document is loaded, the diagrams are only recorded by
+ * deferView() if the document loads them lazily.
  */
 bool UMLFolder::loadDiagramsFromXMI(QDomNode& diagrams)
 {
     const Settings::OptionState optionState = Settings::optionState();
     UMLDoc *umldoc = UMLApp::app()->document();
+    const bool lazy = umldoc->loading() && umldoc->lazyDiagramLoad();
     bool totalSuccess = true;
     for (QDomElement diagram = diagrams.toElement(); !diagram.isNull();
          diagrams = diagrams.nextSibling(), diagram = diagrams.toElement()) {
@@ -389,6 +821,9 @@ bool UMLFolder::loadDiagramsFromXMI(QDomNode& diagrams)
             uDebug() << "ignoring " << tag << " in <diagrams>";
             continue;
         }
+        if (lazy && deferView(diagram)) {
+            continue;
+        }
         UMLView * pView = new UMLView(this);
         pView->umlScene()->setOptionState(optionState);
         if (pView->umlScene()->loadFromXMI(diagram)) {
@@ -402,6 +837,120 @@ bool UMLFolder::loadDiagramsFromXMI(QDomNode& diagrams)
     return totalSuccess;
 }
 
+/**
+ * Record a diagram without creating its view. Its XMI is kept
+ * compressed and loaded by loadDeferredView() when the view is needed.
+ * @param diagram   The <diagram> element.
+ * @return  False if the diagram must be loaded at once because its
+ *          ID or type cannot be determined without loading it.
+ */
+bool UMLFolder::deferView(const QDomElement& diagram)
+{
+    DeferredView view;
+    view.id = Uml::ID::fromString(diagram.attribute(QLatin1String("xmi.id"), QLatin1String("-1")));
+    // type values of files before 1.5.5 are converted by UMLScene::loadFromXMI()
+    const int type = diagram.attribute(QLatin1String("type"), QLatin1String("0")).toInt();
+    if (view.id == Uml::ID::None || type <= Uml::DiagramType::Undefined || type >= Uml::DiagramType::N_DIAGRAMTYPES) {
+        return false;
+    }
+    view.type = Uml::DiagramType::fromInt(type);
+    view.name = diagram.attribute(QLatin1String("name"));
+    view.position = m_diagrams.count() + m_deferredViews.count();
+    QDomElement widget = diagram.firstChildElement(QLatin1String("widgets")).firstChildElement();
+    for (; !widget.isNull(); widget = widget.nextSiblingElement()) {
+        addDeferredObjectId(view.objectIds, widget.attribute(QLatin1String("xmi.id")));
+    }
+    QDomElement assoc = diagram.firstChildElement(QLatin1String("associations")).firstChildElement();
+    for (; !assoc.isNull(); assoc = assoc.nextSiblingElement()) {
+        addDeferredObjectId(view.objectIds, assoc.attribute(QLatin1String("xmi.id")));
+    }
+    QDomElement message = diagram.firstChildElement(QLatin1String("messages")).firstChildElement();
+    for (; !message.isNull(); message = message.nextSiblingElement()) {
+        const QString messageId = message.attribute(QLatin1String("xmi.id"));
+        addDeferredObjectId(view.objectIds, messageId);
+        // the operation is either an ID, mostly the one of the message,
+        // or the text of a custom operation
+        const QString operation = message.attribute(QLatin1String("operation"));
+        if (operation != messageId) {
+            addDeferredObjectId(view.objectIds, operation);
+        }
+    }
+    QString text;
+    QTextStream stream(&text, QIODevice::WriteOnly);
+    diagram.save(stream, 0);
+    stream.flush();
+    view.xmi = qCompress(text.toUtf8());
+    m_deferredViews.append(view);
+    return true;
+}
+
+/**
+ * Create the view of a deferred diagram, add it to the document and
+ * activate it.
+ * @param index   The index of the diagram in m_deferredViews.
+ * @return  The new view, or NULL if the diagram could not be loaded.
+ */
+UMLView* UMLFolder::loadDeferredView(int index)
+{
+    const DeferredView deferred = m_deferredViews.takeAt(index);
+    QDomDocument doc;
+    if (!doc.setContent(qUncompress(deferred.xmi))) {
+        uError() << "cannot parse diagram" << deferred.name;
+    } else {
+        UMLView *pView = new UMLView(this);
+        pView->umlScene()->setOptionState(Settings::optionState());
+        QDomElement diagram = doc.documentElement();
+        if (pView->umlScene()->loadFromXMI(diagram)) {
+            pView->hide();
+            UMLDoc *umldoc = UMLApp::app()->document();
+            const bool loading = umldoc->loading();
+            // prevent the document from showing the view and from
+            // becoming modified
+            umldoc->setLoading(true);
+            umldoc->addView(pView);
+            // addView() appends the view, move it to its place
+            m_diagrams.move(m_diagrams.count() - 1, deferred.position - index);
+            pView->umlScene()->activateAfterLoad();
+            pView->umlScene()->fileLoaded();
+            umldoc->setLoading(loading);
+            return pView;
+        }
+        uError() << "cannot load diagram" << deferred.name;
+        delete pView;
+    }
+    for (int i = index; i < m_deferredViews.count(); ++i) {
+        --m_deferredViews[i].position;
+    }
+    return 0;
+}
+
+/**
+ * Load all deferred diagrams of this folder.
+ */
+void UMLFolder::loadDeferredViews()
+{
+    while (!m_deferredViews.isEmpty()) {
+        loadDeferredView(0);
+    }
+}
+
+/**
+ * Return the position of a loaded view among all diagrams of this
+ * folder, loaded or deferred.
+ * @param diagramIndex   The index of the view in m_diagrams.
+ */
+int UMLFolder::viewPosition(int diagramIndex) const
+{
+    int position = diagramIndex;
+    foreach (const DeferredView& deferred, m_deferredViews) {
+        if (deferred.position > position) {
+            break;
+        }
+        ++position;
+    }
+    return position;
+}
+
 /**
  * Folders in the listview can be marked such that their contents
  * are saved to a separate file.
@@ -545,6 +1094,20 @@ bool UMLFolder::load(QDomElement& element)
     return totalSuccess;
 }
 
+/**
+ * Load the objects and diagrams given as children of the passed element
+ * into this folder. The attributes of the folder itself are not touched.
+ * Used by the XMIStreamLoader, which hands over the contents of a folder
+ * piece by piece.
+ *
+ * @param element   Element whose children are loaded.
+ * @return  True for success.
+ */
+bool UMLFolder::loadContentsFromXMI(QDomElement & element)
+{
+    return load(element);
+}
+
 /**
  * Overloading operator for debugging output.
  */
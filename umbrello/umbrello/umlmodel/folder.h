@@ -15,6 +15,12 @@
 #include "umlviewlist.h"
 #include "optionstate.h"
 
+#include <QByteArray>
+#include <QList>
+#include <QPair>
+
+class FolderContentsWriter;
+
 /**
  * This class manages the UMLObjects and UMLViews of a Folder.
  * This class inherits from UMLPackage which contains most
@@ -48,6 +54,8 @@ public:
     void removeView(UMLView *view);
 
     void appendViews(UMLViewList& viewList, bool includeNested = true);
+    void appendLoadedViews(UMLViewList& viewList, bool includeNested = true);
+    void appendViewNames(QList<QPair<Uml::ID::Type, QString> >& names, bool includeNested = true);
 
     void activateViews();
 
@@ -58,20 +66,35 @@ public:
 
     void removeAllViews();
 
+    void unloadView(UMLView *view);
+    int unloadedViewCount(bool includeNested = true) const;
+    bool deferredViewObjects(Uml::ID::Type id, QList<Uml::ID::Type>& objectIds) const;
+    void removeFromDeferredViews(UMLObject *object);
+
     void setFolderFile(const QString& fileName);
     QString folderFile() const;
 
     void saveToXMI(QDomDocument & qDoc, QDomElement & qElement);
+    void streamToXMI(XMIStreamWriter & writer);
+
+    bool loadContentsFromXMI(QDomElement & element);
 
     friend QDebug operator<<(QDebug out, const UMLFolder& item);
 
 protected:
     void saveContents(QDomDocument& qDoc, QDomElement& qElement);
+    void writeContents(FolderContentsWriter& out);
 
     void save(QDomDocument& qDoc, QDomElement& qElement);
 
     bool loadDiagramsFromXMI(QDomNode& diagrams);
 
+    bool deferView(const QDomElement& diagram);
+    UMLView* loadDeferredView(int index);
+    void pruneDeferredView(int index, UMLObject *object);
+    void loadDeferredViews();
+    int viewPosition(int diagramIndex) const;
+
     bool loadFolderFile(const QString& path);
 
     bool load(QDomElement & element);
@@ -87,6 +110,20 @@ private:
      */
     QString m_folderFile;
     UMLViewList m_diagrams;
+
+    /**
+     * A diagram read from XMI for which no UMLView has been created yet.
+     * It is kept as compressed XMI until it is needed.
+     */
+    struct DeferredView {
+        Uml::ID::Type id;
+        Uml::DiagramType::Enum type;
+        QString name;
+        int position;    ///< position among all diagrams of the folder
+        QByteArray xmi;  ///< the compressed <diagram> element
+        QList<Uml::ID::Type> objectIds;  ///< IDs of the widgets, associations and operations of messages
+    };
+    QList<DeferredView> m_deferredViews;  ///< sorted by position
 };
 
 #endif
@@ -114,6 +114,7 @@ void UMLOperation::moveParmLeft(UMLAttribute * a)
         return;
     m_List.removeAll(a);
     m_List.insert(idx-1, a);
+    increaseGeneration();
 }
 
 /**
@@ -139,6 +140,7 @@ void UMLOperation::moveParmRight(UMLAttribute * a)
         return;
     m_List.removeAll(a);
     m_List.insert(idx+1, a);
+    increaseGeneration();
 }
 
 /**
@@ -159,6 +161,7 @@ void UMLOperation::removeParm(UMLAttribute * a, bool emitModifiedSignal /* =true
     disconnect(a, SIGNAL(modified()), this, SIGNAL(modified()));
     if(!m_List.removeAll(a))
         uDebug() << "Error removing parm " << a->name();
+    increaseGeneration();
 
     if (emitModifiedSignal)
         emit modified();
@@ -188,6 +188,10 @@ bool UMLPackage::addObject(UMLObject *pObject)
       }
     }
     m_objects.append(pObject);
+    UMLDoc *umldoc = UMLApp::app()->document();
+    if (umldoc->isInObjectIndex(this)) {
+        umldoc->addToObjectIndex(pObject);
+    }
     return true;
 }
 
@@ -207,8 +211,10 @@ void UMLPackage::removeObject(UMLObject *pObject)
     if (m_objects.indexOf(pObject) == -1)
         uDebug() << name() << " removeObject: object with id="
                  << Uml::ID::toString(pObject->id()) << "not found.";
-    else
+    else {
         m_objects.removeAll(pObject);
+        UMLApp::app()->document()->removeFromObjectIndex(pObject);
+    }
 }
 
 /**
@@ -386,8 +392,10 @@ bool UMLPackage::resolveRef()
         uIgnoreZeroPointer(obj);
         if (! obj->resolveRef()) {
             UMLObject::ObjectType ot = obj->baseType();
-            if (ot != UMLObject::ot_Package && ot != UMLObject::ot_Folder)
+            if (ot != UMLObject::ot_Package && ot != UMLObject::ot_Folder) {
                 m_objects.removeAll(obj);
+                UMLApp::app()->document()->removeFromObjectIndex(obj);
+            }
             overallSuccess = false;
         }
     }
@@ -168,6 +168,7 @@ void UMLCanvasObject::removeAllChildObjects()
     if (!m_List.isEmpty()) {
         removeAllAssociationEnds();
         m_List.clear();
+        increaseGeneration();
     }
 }
 
@@ -276,6 +277,35 @@ UMLObject* UMLCanvasObject::findChildObjectById(Uml::ID::Type id, bool considerA
     return 0;
 }
 
+/**
+ * Registers a newly added subordinate (attribute, operation, template, ...)
+ * with the ID index of the document and increases the generation.
+ * Indexing is skipped while this object is not part of the model tree;
+ * the subordinates are then indexed together with this object.
+ *
+ * @param item   The subordinate that was added to m_List.
+ */
+void UMLCanvasObject::indexSubordinate(UMLObject *item)
+{
+    increaseGeneration();
+    UMLDoc *umldoc = UMLApp::app()->document();
+    if (umldoc->isInObjectIndex(this)) {
+        umldoc->addToObjectIndex(item);
+    }
+}
+
+/**
+ * Removes a subordinate which was taken out of m_List from the ID index
+ * of the document and increases the generation.
+ *
+ * @param item   The subordinate that was removed from m_List.
+ */
+void UMLCanvasObject::unindexSubordinate(UMLObject *item)
+{
+    increaseGeneration();
+    UMLApp::app()->document()->removeFromObjectIndex(item);
+}
+
 /**
  *  Overloaded '==' operator
  */
@@ -456,6 +486,7 @@ bool UMLCanvasObject::resolveRef()
         uIgnoreZeroPointer(obj);
         if (! obj->resolveRef()) {
             m_List.removeAll(obj);
+            unindexSubordinate(obj);
             overallSuccess = false;
         }
     }
@@ -87,6 +87,8 @@ public:
     // in the classes inheriting from UMLCanvasObject.
 
 protected:
+    void indexSubordinate(UMLObject *item);
+    void unindexSubordinate(UMLObject *item);
 
     /**
      * List of all the associations in this object.
@@ -12,12 +12,14 @@
 #include "umlobject.h"
 
 // app includes
+#include "association.h"
 #include "classpropertiesdialog.h"
 #include "debug_utils.h"
 #include "enumliteral.h"
 #include "uniqueid.h"
 #include "uml.h"
 #include "umldoc.h"
+#include "umlfindindex.h"
 #include "umllistview.h"
 #include "package.h"
 #include "folder.h"
@@ -27,6 +29,7 @@
 #include "import_utils.h"
 #include "docwindow.h"
 #include "cmds.h"
+#include "xmistreamwriter.h"
 
 // kde includes
 #include <KLocalizedString>
@@ -39,12 +42,15 @@ using namespace Uml;
 
 DEBUG_REGISTER_DISABLED(UMLObject)
 
+uint UMLObject::m_modificationCount = 0;
+
 /**
  * Creates a UMLObject.
  * @param other object to created from
  */
 UMLObject::UMLObject(const UMLObject &other)
-  : QObject(other.parent())
+  : QObject(other.parent()),
+    m_generation(0)
 {
     other.copyInto(this);
 }
@@ -99,6 +105,12 @@ UMLObject::UMLObject(UMLObject * parent)
  */
 UMLObject::~UMLObject()
 {
+    // the owner may have cached lists holding this object
+    if (Model_Utils::isClassifierListitem(m_BaseType)) {
+        UMLObject *owner = qobject_cast<UMLObject*>(parent());
+        if (owner)
+            owner->increaseGeneration();
+    }
     // unref stereotype
     setUMLStereotype(0);
     if (m_pSecondary && m_pSecondary->baseType() == ot_Stereotype) {
@@ -123,6 +135,7 @@ void UMLObject::init()
     m_bStatic = false;
     m_bCreationWasSignalled = false;
     m_pSecondary = 0;
+    m_generation = 0;
 }
 
 /**
@@ -171,7 +184,9 @@ bool UMLObject::acceptAssociationType(Uml::AssociationType::Enum type)
  */
 void UMLObject::setID(ID::Type NewID)
 {
+    ID::Type oldID = m_nId;
     m_nId = NewID;
+    UMLApp::app()->document()->changeObjectIndexID(this, oldID);
     emitModified();
 }
 
@@ -369,12 +384,22 @@ void UMLObject::setStatic(bool bStatic)
  * Forces the emission of the modified signal.  Useful when
  * updating several attributes at a time: you can block the
  * signals, update all atts, and then force the signal.
+ * Within a change batch of the document the signal is emitted
+ * once when the batch is committed, see UMLDoc::beginChangeBatch().
  */
 void UMLObject::emitModified()
 {
+    ++m_modificationCount;
+    increaseGeneration();
     UMLDoc *umldoc = UMLApp::app()->document();
-    if (!umldoc->loading() && !umldoc->closing())
-        emit modified();
+    umldoc->findIndex()->objectChanged(this);
+    if (umldoc->loading() || umldoc->closing())
+        return;
+    if (umldoc->isBatchingChanges()) {
+        umldoc->batchModified(this);
+        return;
+    }
+    emit modified();
 }
 
 /**
@@ -444,6 +469,7 @@ void UMLObject::setDoc(const QString &d)
 {
     m_Doc = d;
     //emit modified();  No, this is done centrally at DocWindow::updateDocumentation()
+    UMLApp::app()->document()->findIndex()->objectChanged(this);
 }
 
 /**
@@ -796,6 +822,22 @@ void UMLObject::saveToXMI(QDomDocument &qDoc, QDomElement &qElement)
     Q_UNUSED(qDoc); Q_UNUSED(qElement);
 }
 
+/**
+ * Save the object with the XMIStreamWriter used by UMLDoc::saveToXMI().
+ * The default implementation writes the element created by saveToXMI()
+ * and releases it again. Containers whose contents can be written one
+ * object at a time reimplement it.
+ *
+ * @param writer   The writer of the XMI file.
+ */
+void UMLObject::streamToXMI(XMIStreamWriter &writer)
+{
+    QDomDocument qDoc;
+    QDomElement parent = qDoc.createElement(QLatin1String("parent"));
+    saveToXMI(qDoc, parent);
+    writer.writeChildren(parent);
+}
+
 /**
  * Auxiliary to saveToXMI.
  * Create a QDomElement with the given tag, and save the XMI attributes
@@ -921,6 +963,7 @@ bool UMLObject::loadFromXMI(QDomElement & element)
     // message can say the name.
     m_name = element.attribute(QLatin1String("name"));
     QString id = Model_Utils::getXmiId(element);
+    const Uml::ID::Type oldID = m_nId;
     if (id.isEmpty() || id == QLatin1String("-1")) {
         // Before version 1.4, Umbrello did not save the xmi.id of UMLRole objects.
         // Some tools (such as Embarcadero's) do not have an xmi.id on all attributes.
@@ -941,6 +984,7 @@ bool UMLObject::loadFromXMI(QDomElement & element)
         }
         m_nId = nId;
     }
+    umldoc->changeObjectIndexID(this, oldID);
 
     if (element.hasAttribute(QLatin1String("documentation")))  // for bkwd compat.
         m_Doc = element.attribute(QLatin1String("documentation"));
@@ -1147,6 +1191,52 @@ QString UMLObject::toI18nString(ObjectType t)
     return name;
 }
 
+/**
+ * Return how often emitModified() has been called for any UMLObject.
+ * Texts derived from the model may be cached together with this count;
+ * they are up to date as long as the count has not changed.
+ */
+uint UMLObject::modificationCount()
+{
+    return m_modificationCount;
+}
+
+/**
+ * Return the generation of this object. It is increased by every change
+ * of the object, by the changes of its attributes, operations and other
+ * subordinates and, for a classifier, by the changes of its association
+ * ends. Data derived from the object may be cached together with the
+ * generation, see UMLClassifier::getOpList().
+ */
+uint UMLObject::generation() const
+{
+    return m_generation;
+}
+
+/**
+ * Increase the generation of this object and of the objects whose
+ * generation depends on it: the owner of a subordinate or of a role,
+ * and the objects at the ends of an association.
+ */
+void UMLObject::increaseGeneration()
+{
+    ++m_generation;
+    if (Model_Utils::isClassifierListitem(m_BaseType) || m_BaseType == ot_Role) {
+        // parameter -> operation -> classifier, role -> association
+        UMLObject *owner = qobject_cast<UMLObject*>(parent());
+        if (owner)
+            owner->increaseGeneration();
+    } else if (m_BaseType == ot_Association) {
+        UMLAssociation *assoc = static_cast<UMLAssociation*>(this);
+        UMLObject *objA = assoc->getObject(Uml::RoleType::A);
+        UMLObject *objB = assoc->getObject(Uml::RoleType::B);
+        if (objA)
+            objA->increaseGeneration();
+        if (objB && objB != objA)
+            objB->increaseGeneration();
+    }
+}
+
 /**
  * Print UML Object to debug output stream, so it can be used like
  *   uDebug() << "This object shouldn't be here: " << illegalObject;
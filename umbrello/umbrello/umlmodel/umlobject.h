@@ -22,6 +22,7 @@
 #include <QString>
 
 class UMLStereotype;
+class XMIStreamWriter;
 
 /**
  * This class is the non-graphical version of @ref UMLWidget.  These are
@@ -80,6 +81,10 @@ public:
     static QString toString(ObjectType ot);
     static QString toI18nString(ObjectType t);
 
+    static uint modificationCount();
+
+    uint generation() const;
+
     explicit UMLObject(const UMLObject& other);
     explicit UMLObject(UMLObject* parent, const QString& name, Uml::ID::Type id = Uml::ID::None);
     explicit UMLObject(UMLObject* parent);
@@ -137,6 +142,7 @@ public:
     virtual bool resolveRef();
 
     virtual void saveToXMI(QDomDocument & qDoc, QDomElement & qElement);
+    virtual void streamToXMI(XMIStreamWriter & writer);
     virtual bool loadFromXMI(QDomElement & element);
 
     bool loadStereotype(QDomElement & element);
@@ -167,6 +173,8 @@ protected:
 
     void maybeSignalObjectCreated();
 
+    void increaseGeneration();
+
     virtual bool load(QDomElement& element);
 
     Uml::ID::Type          m_nId;          ///< object's id
@@ -193,6 +201,23 @@ protected:
                                            ///< fully qualified target name of a reference.
                                            ///< In case the quidu is not found, the human readable name is
                                            ///< used which we store in m_SecondaryFallback.
+
+    /**
+     * There are two change counters. m_generation belongs to one object and
+     * is only increased by changes of the object, its subordinates and its
+     * association ends. A cache built from a known set of objects, like the
+     * inherited operations of a classifier, stays valid while other parts
+     * of the model are edited.
+     *
+     * m_modificationCount is global and increased by every emitModified().
+     * It is used by caches whose texts depend on objects they cannot list,
+     * e.g. the member texts of a ClassifierWidget show the names of
+     * parameter and return types, and renaming a type does not change the
+     * generation of the classifiers using it.
+     */
+    uint                   m_generation;   ///< increased by every change, see generation()
+
+    static uint m_modificationCount;       ///< number of calls to emitModified(), see modificationCount()
 };
 
 #endif
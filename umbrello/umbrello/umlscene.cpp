@@ -87,8 +87,10 @@
 #include <QPainter>
 #include <QPixmap>
 #include <QPrinter>
+#include <QSet>
 #include <QString>
 #include <QStringList>
+#include <QStyleOptionGraphicsItem>
 
 #if QT_VERSION >= 0x050000
 #include <QInputDialog>
@@ -97,8 +99,15 @@
 // system includes
 #include <cmath>  // for ceil
 
+/**
+ * Distance around a point within which the hit tests of the widgets
+ * may report a hit, e.g. the tolerance MessageWidget::onWidget() uses.
+ */
+static const qreal HitTolerance = 5.0;
+
 // static members
 const qreal UMLScene::defaultCanvasSize = 5000;
+const qreal UMLScene::defaultLowDetailThreshold = 0.4;
 bool UMLScene::m_showDocumentationIndicator = false;
 
 using namespace Uml;
@@ -141,7 +150,8 @@ UMLScene::UMLScene(UMLFolder *parentFolder, UMLView *view)
     m_pIDChangesLog(0),
     m_isActivated(false),
     m_bPopupShowing(false),
-    m_autoIncrementSequence(false)
+    m_autoIncrementSequence(false),
+    m_lowDetailThreshold(defaultLowDetailThreshold)
 {
     //m_AssociationList.setAutoDelete(true);
     //m_WidgetList.setAutoDelete(true);
@@ -944,18 +954,81 @@ UMLWidget* UMLScene::getFirstMultiSelectedWidget() const
     return selectedWidgets().first();
 }
 
+/**
+ * Collect the widgets and associations whose bounding rectangles
+ * intersect the given rectangle. The candidates are taken from the item
+ * index which QGraphicsScene keeps up to date while items are moved or
+ * resized, so that not every widget of the diagram has to be tested.
+ * Items which are parts of other widgets, e.g. the labels of an
+ * association, stand for their top level owner. Only the widgets,
+ * messages and associations of the lists of the scene are returned.
+ *
+ * @param rect           The rectangle in scene coordinates.
+ * @param widgets        Receives the widgets including the messages.
+ * @param associations   Receives the associations if not NULL.
+ */
+void UMLScene::widgetsInRect(const QRectF &rect, QList<UMLWidget*> *widgets,
+                             QList<AssociationWidget*> *associations) const
+{
+    QList<QGraphicsItem*> owners;
+    QSet<QGraphicsItem*> visited;
+    foreach(QGraphicsItem *item, items(rect, Qt::IntersectsItemBoundingRect)) {
+        QGraphicsItem *owner = item->topLevelItem();
+        if (!visited.contains(owner)) {
+            visited.insert(owner);
+            owners.append(owner);
+        }
+    }
+    // A few candidates are looked up in the lists, for many of them
+    // the lookup in a set of the list entries is cheaper.
+    QSet<const WidgetBase*> members;
+    const bool useSet = owners.count() > 8;
+    if (useSet) {
+        foreach(UMLWidget *w, m_WidgetList)
+            members.insert(w);
+        foreach(MessageWidget *w, m_MessageList)
+            members.insert(w);
+        foreach(AssociationWidget *a, m_AssociationList)
+            members.insert(a);
+    }
+    foreach(QGraphicsItem *owner, owners) {
+        WidgetBase *wb = dynamic_cast<WidgetBase*>(owner);
+        if (wb == NULL)
+            continue;
+        if (wb->baseType() == WidgetBase::wt_Association) {
+            AssociationWidget *a = static_cast<AssociationWidget*>(wb);
+            if (associations && (useSet ? members.contains(a) : m_AssociationList.contains(a)))
+                associations->append(a);
+        } else if (wb->baseType() == WidgetBase::wt_Message) {
+            MessageWidget *m = static_cast<MessageWidget*>(wb);
+            if (useSet ? members.contains(m) : m_MessageList.contains(m))
+                widgets->append(m);
+        } else {
+            UMLWidget *w = dynamic_cast<UMLWidget*>(wb);
+            if (w && (useSet ? members.contains(w) : m_WidgetList.contains(w)))
+                widgets->append(w);
+        }
+    }
+}
+
 /**
  * Tests the given point against all widgets and returns the
  * widget for which the point is within its bounding rectangle.
  * In case of multiple matches, returns the smallest widget.
  * Returns NULL if the point is not inside any widget.
- * TODO: What about using QGraphicsScene::items(...)?
  */
 UMLWidget* UMLScene::widgetAt(const QPointF& p)
 {
+    QList<UMLWidget*> widgets;
+    QList<AssociationWidget*> associations;
+    widgetsInRect(QRectF(p.x() - HitTolerance, p.y() - HitTolerance,
+                         2 * HitTolerance, 2 * HitTolerance), &widgets, &associations);
+
     qreal relativeSize = 99990.0;  // start with an arbitrary large number
     UMLWidget  *retWid = 0;
-    foreach (UMLWidget* wid, m_WidgetList) {
+    foreach (UMLWidget* wid, widgets) {
+        if (wid->baseType() == WidgetBase::wt_Message)
+            continue;
         UMLWidget* w = wid->onWidget(p);
         if (w == NULL)
             continue;
@@ -965,7 +1038,7 @@ UMLWidget* UMLScene::widgetAt(const QPointF& p)
             retWid = w;
         }
     }
-    foreach (AssociationWidget* assoc, m_AssociationList) {
+    foreach (AssociationWidget* assoc, associations) {
         UMLWidget* w = assoc->onWidget(p);
         if (w) {
             const qreal s = (w->width() + w->height()) / 2.0;
@@ -986,7 +1059,11 @@ UMLWidget* UMLScene::widgetAt(const QPointF& p)
  */
 AssociationWidget* UMLScene::associationAt(const QPointF& p)
 {
-    foreach (AssociationWidget* association, associationList()) {
+    QList<UMLWidget*> widgets;
+    QList<AssociationWidget*> associations;
+    widgetsInRect(QRectF(p.x() - HitTolerance, p.y() - HitTolerance,
+                         2 * HitTolerance, 2 * HitTolerance), &widgets, &associations);
+    foreach (AssociationWidget* association, associations) {
         if (association->onAssociation(p)) {
             return association;
         }
@@ -995,13 +1072,19 @@ AssociationWidget* UMLScene::associationAt(const QPointF& p)
 }
 
 /**
- * Tests the given point against all associations and returns the
- * association widget for which the point is on the line.
- * Returns NULL if the point is not inside any association.
+ * Tests the given point against all messages and returns the
+ * message widget for which the point is on the message.
+ * Returns NULL if the point is not on any message.
  */
 MessageWidget* UMLScene::messageAt(const QPointF& p)
 {
-    foreach(MessageWidget *message, messageList()) {
+    QList<UMLWidget*> widgets;
+    widgetsInRect(QRectF(p.x() - HitTolerance, p.y() - HitTolerance,
+                         2 * HitTolerance, 2 * HitTolerance), &widgets);
+    foreach(UMLWidget *widget, widgets) {
+        if (widget->baseType() != WidgetBase::wt_Message)
+            continue;
+        MessageWidget *message = static_cast<MessageWidget*>(widget);
         if (message->onWidget(p)) {
             return message;
         }
@@ -1035,20 +1118,7 @@ void UMLScene::checkMessages(ObjectWidget * w)
  */
 UMLWidget* UMLScene::widgetOnDiagram(Uml::ID::Type id)
 {
-    foreach(UMLWidget *obj, m_WidgetList) {
-        UMLWidget* w = obj->widgetWithID(id);
-        if (w)
-            return w;
-    }
-
-    foreach(UMLWidget *obj, m_MessageList) {
-        // CHECK: Should MessageWidget reimplement widgetWithID() ?
-        //       If yes then we should use obj->widgetWithID(id) here too.
-        if (id == obj->id())
-            return obj;
-    }
-
-    return 0;
+    return findWidget(id, false);
 }
 
 /**
@@ -1060,22 +1130,56 @@ UMLWidget* UMLScene::widgetOnDiagram(Uml::ID::Type id)
  */
 UMLWidget * UMLScene::findWidget(Uml::ID::Type id)
 {
-    foreach(UMLWidget* obj, m_WidgetList) {
-        UMLWidget* w = obj->widgetWithID(id);
-        if (w) {
+    return findWidget(id, true);
+}
+
+/**
+ * Finds a widget with the given ID in our UMLWidget and MessageWidget
+ * lists. Widgets found are remembered by their ID, a remembered widget
+ * is returned again as long as it still has the ID and belongs to this
+ * scene, only then the lists are searched.
+ *
+ * @param id                    The ID of the widget to find.
+ * @param matchMessageLocalID   Whether the local ID of a message matches.
+ *
+ * @return Returns the widget found, returns 0 if no widget found.
+ */
+UMLWidget * UMLScene::findWidget(Uml::ID::Type id, bool matchMessageLocalID)
+{
+    UMLWidget *w = m_widgetsByID.value(id);
+    if (w && w->scene() == this) {
+        if (w->baseType() == WidgetBase::wt_Message) {
+            if (w->id() == id || (matchMessageLocalID && w->localID() == id))
+                return w;
+        } else if (w->widgetWithID(id) == w) {
             return w;
         }
     }
 
-    foreach(UMLWidget* obj, m_MessageList) {
-        // CHECK: Should MessageWidget reimplement widgetWithID() ?
-        //       If yes then we should use obj->widgetWithID(id) here too.
-        if (obj->localID() == id ||
-            obj->id() == id)
-            return obj;
+    w = 0;
+    foreach(UMLWidget* obj, m_WidgetList) {
+        w = obj->widgetWithID(id);
+        if (w)
+            break;
     }
 
-    return 0;
+    if (w == 0) {
+        foreach(UMLWidget* obj, m_MessageList) {
+            // CHECK: Should MessageWidget reimplement widgetWithID() ?
+            //       If yes then we should use obj->widgetWithID(id) here too.
+            if ((matchMessageLocalID && obj->localID() == id) ||
+                obj->id() == id) {
+                w = obj;
+                break;
+            }
+        }
+    }
+
+    if (w)
+        m_widgetsByID.insert(id, w);
+    else
+        m_widgetsByID.remove(id);
+    return w;
 }
 
 /**
@@ -1207,6 +1311,47 @@ const QColor& UMLScene::backgroundColor() const
     return backgroundBrush().color();
 }
 
+/**
+ * Returns the scale below which the diagram is drawn with less detail.
+ */
+qreal UMLScene::lowDetailThreshold() const
+{
+    return m_lowDetailThreshold;
+}
+
+/**
+ * Set the scale below which the diagram is drawn with less detail:
+ * widgets with expensive contents are drawn as plain boxes, associations
+ * as thin lines, and association symbols and floating texts are not drawn.
+ * A threshold of 0 disables the simplified drawing.
+ */
+void UMLScene::setLowDetailThreshold(qreal threshold)
+{
+    if (m_lowDetailThreshold != threshold) {
+        m_lowDetailThreshold = threshold;
+        update();
+    }
+}
+
+/**
+ * Return true if items drawn with the given painter are to be drawn with
+ * less detail, because the painter paints a view of this scene and scales
+ * the diagram below the threshold set with setLowDetailThreshold().
+ * Exports and prints render the scene without a widget and are never
+ * affected, whatever their scale.
+ *
+ * @param painter   The painter passed to QGraphicsItem::paint().
+ * @param widget    The widget passed to QGraphicsItem::paint(), the
+ *                  viewport of a view or null.
+ */
+bool UMLScene::isLowDetail(const QPainter *painter, const QWidget *widget) const
+{
+    if (m_lowDetailThreshold <= 0 || !painter || !widget) {
+        return false;
+    }
+    return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) < m_lowDetailThreshold;
+}
+
 /**
  * Returns whether to use the fill/background color
  */
@@ -1561,16 +1706,14 @@ void UMLScene::selectWidgets(qreal px, qreal py, qreal qx, qreal qy)
         rect.setBottom(py);
     }
 
-    // Select UMLWidgets that fall within the selection rectangle
-    foreach(UMLWidget* temp, m_WidgetList) {
+    // Select UMLWidgets and messages that fall within the selection rectangle,
+    // selectWidget() checks the geometry which may be rounded to full pixels
+    QList<UMLWidget*> widgets;
+    widgetsInRect(rect.adjusted(-1, -1, 1, 1), &widgets);
+    foreach(UMLWidget* temp, widgets) {
         selectWidget(temp, &rect);
     }
 
-    // Select messages that fall within the selection rectangle
-    foreach(MessageWidget* temp, m_MessageList) {
-        selectWidget(dynamic_cast<UMLWidget*>(temp), &rect);
-    }
-
     // Select associations of selected widgets
     selectAssociations(true);
 
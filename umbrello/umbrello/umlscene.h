@@ -29,9 +29,11 @@
 #include <QGraphicsItem>
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsPolygonItem>
+#include <QHash>
 #include <QKeyEvent>
 #include <QMouseEvent>
 #include <QPixmap>
+#include <QPointer>
 
 // forward declarations
 class ClassOptionsPage;
@@ -117,6 +119,10 @@ public:
 
     const QColor& backgroundColor() const;
 
+    qreal lowDetailThreshold() const;
+    void setLowDetailThreshold(qreal threshold);
+    bool isLowDetail(const QPainter *painter, const QWidget *widget) const;
+
     bool snapToGrid() const;
     void setSnapToGrid(bool bSnap);
 
@@ -363,6 +369,7 @@ protected:
 private:
     UMLScenePrivate *m_d;
     static const qreal defaultCanvasSize;  ///< The default size of a diagram in pixels.
+    static const qreal defaultLowDetailThreshold;  ///< The default of m_lowDetailThreshold.
     static bool m_showDocumentationIndicator; ///< Status of documentation indicator
 
     UMLView *m_view;   ///< The view to which this scene is related.
@@ -378,6 +385,12 @@ private:
     UMLViewImageExporter* m_pImageExporter;  ///< Used to export the view.
     LayoutGrid*  m_layoutGrid;      ///< layout grid in the background
     bool m_autoIncrementSequence; ///< state of auto increment sequence
+    qreal m_lowDetailThreshold;     ///< scale below which widgets are drawn simplified
+    QHash<Uml::ID::Type, QPointer<UMLWidget> > m_widgetsByID;  ///< widgets found by findWidget() and widgetOnDiagram()
+
+    UMLWidget* findWidget(Uml::ID::Type id, bool matchMessageLocalID);
+    void widgetsInRect(const QRectF &rect, QList<UMLWidget*> *widgets,
+                       QList<AssociationWidget*> *associations = 0) const;
 
     void createAutoAttributeAssociation(UMLClassifier *type,
                                         UMLAttribute *attr,
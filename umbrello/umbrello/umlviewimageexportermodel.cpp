@@ -12,13 +12,19 @@
 #include "umlviewimageexportermodel.h"
 
 // application specific includes
+#include "associationwidget.h"
+#include "classifier.h"
+#include "classifierlistitem.h"
 #include "debug_utils.h"
 #include "dotgenerator.h"
 #include "model_utils.h"
+#include "pngstreamwriter.h"
 #include "uml.h"
 #include "umldoc.h"
+#include "umlobject.h"
 #include "umlscene.h"
 #include "umlview.h"
+#include "umlwidget.h"
 
 // kde include files
 #if QT_VERSION >= 0x050000
@@ -35,19 +41,29 @@
 
 // include files for Qt
 #include <QApplication>
+#include <QCryptographicHash>
 #include <QDesktopWidget>
 #include <QDir>
+#include <QDomDocument>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QImage>
 #include <QImageWriter>
+#include <QMap>
 #include <QPainter>
 #include <QPicture>
 #include <QPrinter>
 #include <QRect>
 #include <QRegExp>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QSet>
 #include <QSvgGenerator>
 #if QT_VERSION >= 0x050000
 #include <QTemporaryFile>
 #endif
+#include <QThreadPool>
+#include <QVector>
 
 // system includes
 #include <cmath>
@@ -173,12 +189,25 @@ QString UMLViewImageExporterModel::mimeTypeToImageType(const QString& mimeType)
     return QString();
 }
 
+/**
+ * Default width and height of the tiles of a tiled export.
+ */
+static const int DefaultTileSize = 512;
+
+/**
+ * PNG images with more pixels are rendered in tiles by default, smaller
+ * ones in a single image.
+ */
+static const qint64 DefaultMaxImagePixels = 4096 * 4096;
+
 /**
  * Constructor for UMLViewImageExporterModel.
  * @param resolution resolution of export in DPI (default 0.0 means export type related default)
  */
 UMLViewImageExporterModel::UMLViewImageExporterModel(float resolution)
-  : m_resolution(resolution)
+  : m_resolution(resolution),
+    m_tileSize(DefaultTileSize),
+    m_maxImagePixels(DefaultMaxImagePixels)
 {
 }
 
@@ -189,6 +218,165 @@ UMLViewImageExporterModel::~UMLViewImageExporterModel()
 {
 }
 
+/**
+ * Sets the width and height of the tiles PNG images larger than
+ * setMaxImagePixels() are rendered in.
+ * @param tileSize the size of the tiles in pixels
+ */
+void UMLViewImageExporterModel::setTileSize(int tileSize)
+{
+    m_tileSize = tileSize;
+}
+
+/**
+ * Sets the number of pixels above which PNG images are rendered in tiles
+ * and written while they are rendered, instead of rendering them into a
+ * single image first.
+ * @param pixels the maximum number of pixels of an image rendered at once
+ */
+void UMLViewImageExporterModel::setMaxImagePixels(qint64 pixels)
+{
+    m_maxImagePixels = pixels;
+}
+
+/**
+ * Maximum number of pixels of the tiles rendered at once by a tiled export.
+ */
+static const qint64 MaxBandPixels = 16 * 1024 * 1024;
+
+/**
+ * Render a tile of a diagram recorded in a QPicture in a worker thread.
+ */
+class TileRenderTask : public QRunnable
+{
+public:
+    TileRenderTask(const QByteArray &picture, const QRect &tile, QImage *image)
+      : m_picture(picture),
+        m_tile(tile),
+        m_image(image)
+    {
+    }
+
+    void run()
+    {
+        // QPicture::play() moves the read position of the shared
+        // picture data, therefore each task plays its own copy
+        QPicture picture;
+        picture.setData(m_picture.constData(), m_picture.size());
+        *m_image = QImage(m_tile.size(), QImage::Format_ARGB32_Premultiplied);
+        QPainter painter(m_image);
+        painter.fillRect(m_image->rect(), Qt::white);
+        painter.translate(-m_tile.topLeft());
+        painter.drawPicture(0, 0, picture);
+    }
+
+private:
+    QByteArray m_picture;
+    QRect m_tile;
+    QImage *m_image;
+};
+
+/**
+ * Name of the file in the export directory which records the content
+ * hash of each diagram exported to the directory.
+ */
+static const char ExportHashFileName[] = ".umbrello-export";
+
+/**
+ * Encode a rendered diagram and write it to its file in a worker thread.
+ * The semaphore is released when the image has been written, it limits
+ * the number of rendered images waiting to be saved.
+ */
+class ImageSaveTask : public QRunnable
+{
+public:
+    ImageSaveTask(const QImage &image, const QString &fileName, const QByteArray &format,
+                  bool *success, qint64 *elapsed, QSemaphore *pending)
+      : m_image(image),
+        m_fileName(fileName),
+        m_format(format),
+        m_success(success),
+        m_elapsed(elapsed),
+        m_pending(pending)
+    {
+    }
+
+    void run()
+    {
+        QElapsedTimer timer;
+        timer.start();
+        *m_success = m_image.save(m_fileName, m_format.constData());
+        m_image = QImage();
+        *m_elapsed = timer.elapsed();
+        m_pending->release();
+    }
+
+private:
+    QImage m_image;
+    QString m_fileName;
+    QByteArray m_format;
+    bool *m_success;
+    qint64 *m_elapsed;
+    QSemaphore *m_pending;
+};
+
+/**
+ * Add an element and its children to a hash. The attributes are added
+ * sorted by name, because QDom does not keep them in a stable order.
+ */
+static void addToHash(QCryptographicHash &hash, const QDomElement &element)
+{
+    hash.addData(element.tagName().toUtf8());
+    QDomNamedNodeMap attributes = element.attributes();
+    QMap<QString, QString> sorted;
+    for (int i = 0; i < attributes.count(); ++i) {
+        QDomAttr attribute = attributes.item(i).toAttr();
+        sorted.insert(attribute.name(), attribute.value());
+    }
+    for (QMap<QString, QString>::ConstIterator it = sorted.constBegin(); it != sorted.constEnd(); ++it) {
+        hash.addData(it.key().toUtf8());
+        hash.addData("=", 1);
+        hash.addData(it.value().toUtf8());
+    }
+    for (QDomNode node = element.firstChild(); !node.isNull(); node = node.nextSibling()) {
+        if (node.isElement()) {
+            addToHash(hash, node.toElement());
+        } else if (node.isText()) {
+            hash.addData(node.nodeValue().toUtf8());
+        }
+    }
+    hash.addData("/", 1);
+}
+
+/**
+ * Add a text to a hash, terminated so that adjacent texts cannot be
+ * mistaken for each other.
+ */
+static void addToHash(QCryptographicHash &hash, const QString &text)
+{
+    hash.addData(text.toUtf8());
+    hash.addData("", 1);
+}
+
+/**
+ * Add the texts a model object is shown with to a hash. The XMI of the
+ * object refers to the types of its attributes and operations and to the
+ * stereotypes by ID only, so renaming them would not change the hash
+ * otherwise, even if they are not shown in the diagram themselves.
+ */
+static void addShownTextsToHash(QCryptographicHash &hash, UMLObject *o)
+{
+    addToHash(hash, o->fullyQualifiedName());
+    addToHash(hash, o->stereotype(true));
+    UMLClassifier *c = dynamic_cast<UMLClassifier*>(o);
+    if (!c)
+        return;
+    foreach (UMLClassifierListItem *item, c->getFilteredList(UMLObject::ot_UMLObject)) {
+        addToHash(hash, item->toString(Uml::SignatureType::ShowSig));
+        addToHash(hash, item->stereotype(true));
+    }
+}
+
 /**
  * Exports views in the document to the directory specified in the url
  * using the 'imageType' for the images.
@@ -204,31 +392,150 @@ UMLViewImageExporterModel::~UMLViewImageExporterModel()
  * existing file with the same path as one to be created overwrites it without asking.
  * The url used can be local or remote, using supported KIO slaves.
  *
+ * Views exported to a local directory as pixmaps are rendered one after
+ * another, while the images are encoded and written by a thread pool.
+ * With 'skipUnchanged' the content hash of each exported view is recorded
+ * in the target directory, and views whose hash has not changed since the
+ * last export are not exported again.
+ *
  * @param imageType The type of the images the views will be exported to.
  * @param directory The url of the directory where the images will be saved.
  * @param useFolders If the tree structure of the views in the document must be created
  *                   in the target directory.
+ * @param skipUnchanged If views not changed since the last export to a local
+ *                      directory are skipped.
  * @return A QStringList with all the error messages that occurred during export.
  *         If the list is empty, all the views were exported successfully.
  */
-QStringList UMLViewImageExporterModel::exportViews(const UMLViewList &views, const QString &imageType, const QUrl &directory, bool useFolders) const
+QStringList UMLViewImageExporterModel::exportViews(const UMLViewList &views, const QString &imageType, const QUrl &directory, bool useFolders, bool skipUnchanged) const
 {
-    // contains all the error messages returned by exportView calls
-    QStringList errors;
+#if QT_VERSION >= 0x050000
+    const QString localDirectory = directory.path();
+#else
+    const KUrl directoryUrl(directory);
+    const QString localDirectory = directoryUrl.isLocalFile() ? directoryUrl.toLocalFile() : QString();
+#endif
+    const bool local = !localDirectory.isEmpty();
+    const bool parallel = local && isPixmapType(imageType);
+    skipUnchanged = skipUnchanged && local;
+
+    // content hashes of the views exported before, by file name
+    QMap<QString, QByteArray> hashes;
+    const QString hashFileName = QDir(localDirectory).absoluteFilePath(QLatin1String(ExportHashFileName));
+    if (skipUnchanged) {
+        QFile file(hashFileName);
+        if (file.open(QIODevice::ReadOnly)) {
+            while (!file.atEnd()) {
+                const QList<QByteArray> fields = file.readLine().trimmed().split('\t');
+                if (fields.count() == 2) {
+                    hashes[QString::fromUtf8(fields[1])] = fields[0];
+                }
+            }
+        }
+    }
+
+    struct ExportedView {
+        QString name;
+        QString fileName;
+        QByteArray hash;
+        QString error;
+        bool success;
+        qint64 renderTime;
+        qint64 saveTime;
+    };
+    // the save tasks refer to the entries, the vector is never resized
+    QVector<ExportedView> exported(views.count());
+    int count = 0;
+
+    QThreadPool pool;
+    QSemaphore pending(2 * qMax(1, pool.maxThreadCount()));
 
     foreach (UMLView *view, views) {
+        UMLScene *scene = view->umlScene();
+        const QString fileName = getDiagramFileName(scene, imageType, useFolders);
 #if QT_VERSION >= 0x050000
-        QUrl url = QUrl::fromLocalFile(directory.path() + QLatin1Char('/') +
-                 getDiagramFileName(view->umlScene(), imageType, useFolders));
+        QUrl url = QUrl::fromLocalFile(directory.path() + QLatin1Char('/') + fileName);
 #else
         KUrl url = directory;
-        url.addPath(getDiagramFileName(view->umlScene(), imageType, useFolders));
+        url.addPath(fileName);
 #endif
 
-        QString returnString = exportView(view->umlScene(), imageType, url);
-        if (!returnString.isNull()) {
+        QByteArray hash;
+        if (skipUnchanged) {
+            hash = contentHash(scene, imageType);
+            if (hashes.value(fileName) == hash && QFile::exists(url.toLocalFile())) {
+                uDebug() << scene->name() << ": unchanged";
+                continue;
+            }
+        }
+
+        ExportedView &entry = exported[count++];
+        entry.name = scene->name();
+        entry.fileName = fileName;
+        entry.hash = hash;
+        entry.success = false;
+        entry.renderTime = 0;
+        entry.saveTime = 0;
+
+        QElapsedTimer timer;
+        timer.start();
+        if (!parallel || isTiled(scene, imageType)) {
+            entry.error = exportView(scene, imageType, url);
+            entry.success = entry.error.isNull();
+            entry.renderTime = timer.elapsed();
+            continue;
+        }
+
+        if (!prepareDirectory(url)) {
+#if QT_VERSION >= 0x050000
+            entry.error = i18n("Cannot create directory: %1", url.path());
+#else
+            entry.error = i18n("Cannot create directory: %1", url.directory());
+#endif
+            continue;
+        }
+        if (scene->diagramRect().isEmpty()) {
+            entry.error = i18n("Cannot save an empty diagram");
+            continue;
+        }
+
+        // remove 'blue squares' from exported picture.
+        scene->clearSelected();
+        pending.acquire();
+        QImage image = renderImage(scene);
+        entry.renderTime = timer.elapsed();
+        pool.start(new ImageSaveTask(image, url.toLocalFile(), imageType.toUpper().toLatin1(),
+                                     &entry.success, &entry.saveTime, &pending));
+    }
+    pool.waitForDone();
+
+    // contains all the error messages returned by exportView calls
+    QStringList errors;
+    for (int i = 0; i < count; ++i) {
+        ExportedView &entry = exported[i];
+        if (parallel && !entry.success && entry.error.isNull()) {
+            entry.error = i18n("A problem occurred while saving diagram in %1", entry.fileName);
+        }
+        if (!entry.error.isNull()) {
             // [PORT]
-            errors.append(view->umlScene()->name() + QLatin1String(": ") + returnString);
+            errors.append(entry.name + QLatin1String(": ") + entry.error);
+            hashes.remove(entry.fileName);
+            continue;
+        }
+        uDebug() << entry.name << ": rendered in" << entry.renderTime << "ms, saved in" << entry.saveTime << "ms";
+        if (skipUnchanged) {
+            hashes[entry.fileName] = entry.hash;
+        }
+    }
+
+    if (skipUnchanged) {
+        QFile file(hashFileName);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            for (QMap<QString, QByteArray>::ConstIterator it = hashes.constBegin(); it != hashes.constEnd(); ++it) {
+                file.write(it.value() + '\t' + it.key().toUtf8() + '\n');
+            }
+        } else {
+            uWarning() << "cannot write" << hashFileName;
         }
     }
 
@@ -556,7 +863,7 @@ bool UMLViewImageExporterModel::exportViewToSvg(UMLScene* scene, const QString &
 
 /**
  * Exports the view to the file 'fileName' as a pixmap of the specified type.
- * The valid types are those supported by QPixmap save method.
+ * The valid types are those supported by QImage save method.
  *
  * @param scene     The scene to export.
  * @param imageType The type of the image the view will be exported to.
@@ -571,12 +878,12 @@ bool UMLViewImageExporterModel::exportViewToPixmap(UMLScene* scene, const QStrin
         return false;
     }
 
+    if (isTiled(scene, imageType)) {
+        return exportViewToTiledPng(scene, fileName);
+    }
+
     QRectF rect = scene->diagramRect();
-    float scale = m_resolution != 0.0 ? m_resolution / qApp->desktop()->logicalDpiX() : 72.0f / qApp->desktop()->logicalDpiX();
-    QSizeF size = rect.size() * scale;
-    QPixmap diagram(size.toSize());
-    scene->getDiagram(diagram, rect);
-    bool exportSuccessful = diagram.save(fileName, qPrintable(imageType.toUpper()));
+    bool exportSuccessful = renderImage(scene).save(fileName, qPrintable(imageType.toUpper()));
     DEBUG(DBG_IEM) << "saving to file " << fileName
                    << ", imageType=" << imageType
                    << ", width=" << rect.width()
@@ -584,3 +891,171 @@ bool UMLViewImageExporterModel::exportViewToPixmap(UMLScene* scene, const QStrin
                    << ", successful=" << exportSuccessful;
     return exportSuccessful;
 }
+
+/**
+ * Returns whether the image type is exported with renderImage().
+ *
+ * @param imageType The type of the image.
+ * @return True if the type is neither dot, eps nor svg.
+ */
+bool UMLViewImageExporterModel::isPixmapType(const QString &imageType) const
+{
+    QString imageMimeType = UMLViewImageExporterModel::imageTypeToMimeType(imageType);
+    return imageMimeType != QLatin1String("image/x-dot") &&
+           imageMimeType != QLatin1String("image/x-eps") &&
+           imageMimeType != QLatin1String("image/svg+xml");
+}
+
+/**
+ * Renders the scene into an image at the resolution of the exporter.
+ * Unlike a QPixmap the image does not depend on the windowing system,
+ * it can be encoded and written in another thread.
+ *
+ * @param scene The scene to render.
+ * @return The rendered diagram.
+ */
+QImage UMLViewImageExporterModel::renderImage(UMLScene* scene) const
+{
+    QImage diagram(imageSize(scene), QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&diagram);
+    painter.fillRect(diagram.rect(), Qt::white);
+    scene->getDiagram(painter, scene->diagramRect(), diagram.rect());
+    return diagram;
+}
+
+/**
+ * Exports the view to the file 'fileName' as PNG without rendering it
+ * into a single image. The diagram is recorded into a QPicture, which
+ * is played into tiles of m_tileSize pixels by a thread pool. The tiles
+ * are rendered in bands of rows and passed to a PngStreamWriter, so that
+ * the memory needed does not depend on the height of the image.
+ *
+ * @param scene    The scene to export.
+ * @param fileName The name of the file where the image will be saved.
+ * @return True if the operation was successful,
+ *         false if a problem occurred while exporting.
+ */
+bool UMLViewImageExporterModel::exportViewToTiledPng(UMLScene* scene, const QString &fileName) const
+{
+    const QSize size = imageSize(scene);
+    if (size.isEmpty()) {
+        return false;
+    }
+
+    QPicture picture;
+    QPainter recorder(&picture);
+    scene->getDiagram(recorder, scene->diagramRect(), QRectF(QPointF(0, 0), size));
+    recorder.end();
+    const QByteArray data(picture.data(), picture.size());
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    PngStreamWriter writer(file);
+    if (!writer.writeHeader(size.width(), size.height())) {
+        return false;
+    }
+
+    const int tileSize = qMax(1, m_tileSize);
+    const int columns = (size.width() + tileSize - 1) / tileSize;
+    // a band is a row of tiles, it is lower if the image is very wide
+    const int bandHeight = int(qBound(qint64(1), MaxBandPixels / size.width(), qint64(tileSize)));
+    QThreadPool pool;
+    for (int y = 0; y < size.height(); y += bandHeight) {
+        const int height = qMin(bandHeight, size.height() - y);
+        QVector<QImage> tiles(columns);
+        for (int column = 0; column < columns; ++column) {
+            const int x = column * tileSize;
+            const QRect tile(x, y, qMin(tileSize, size.width() - x), height);
+            pool.start(new TileRenderTask(data, tile, &tiles[column]));
+        }
+        pool.waitForDone();
+        if (!writer.writeRows(tiles)) {
+            return false;
+        }
+    }
+    bool exportSuccessful = writer.finish();
+    DEBUG(DBG_IEM) << "saving to file " << fileName
+                   << ", width=" << size.width()
+                   << ", height=" << size.height()
+                   << ", tiles=" << columns << "x" << (size.height() + bandHeight - 1) / bandHeight
+                   << ", successful=" << exportSuccessful;
+    return exportSuccessful;
+}
+
+/**
+ * Returns the size in pixels of the image the scene is exported to.
+ *
+ * @param scene The scene to export.
+ */
+QSize UMLViewImageExporterModel::imageSize(UMLScene* scene) const
+{
+    QRectF rect = scene->diagramRect();
+    float scale = m_resolution != 0.0 ? m_resolution / qApp->desktop()->logicalDpiX() : 72.0f / qApp->desktop()->logicalDpiX();
+    QSizeF size = rect.size() * scale;
+    return size.toSize();
+}
+
+/**
+ * Returns whether the scene is exported with exportViewToTiledPng().
+ *
+ * @param scene     The scene to export.
+ * @param imageType The type of the image the scene will be exported to.
+ * @return True if the image is a PNG image larger than m_maxImagePixels.
+ */
+bool UMLViewImageExporterModel::isTiled(UMLScene* scene, const QString &imageType) const
+{
+    if (imageType.toLower() != QLatin1String("png")) {
+        return false;
+    }
+    const QSize size = imageSize(scene);
+    return qint64(size.width()) * size.height() > m_maxImagePixels;
+}
+
+/**
+ * Returns a hash of everything shown by the scene: the diagram itself,
+ * the model objects of its widgets and associations together with the
+ * names of the types and stereotypes they refer to, the image type and
+ * the resolution.
+ *
+ * @param scene     The scene to hash.
+ * @param imageType The type of the image the scene is exported to.
+ * @return The hash as hexadecimal string.
+ */
+QByteArray UMLViewImageExporterModel::contentHash(UMLScene* scene, const QString &imageType) const
+{
+    QDomDocument doc;
+    QDomElement root = doc.createElement(QLatin1String("export"));
+    root.setAttribute(QLatin1String("type"), imageType.toLower());
+    root.setAttribute(QLatin1String("resolution"), m_resolution);
+    doc.appendChild(root);
+    scene->saveToXMI(doc, root);
+
+    // in the order of the diagram, which is stable between runs
+    QList<UMLObject*> objects;
+    QSet<UMLObject*> seen;
+    foreach (UMLWidget *widget, scene->widgetList()) {
+        UMLObject *o = widget->umlObject();
+        if (o && !seen.contains(o)) {
+            seen.insert(o);
+            objects.append(o);
+            o->saveToXMI(doc, root);
+        }
+    }
+    foreach (AssociationWidget *assoc, scene->associationList()) {
+        UMLObject *o = assoc->umlObject();
+        if (o && !seen.contains(o)) {
+            seen.insert(o);
+            objects.append(o);
+            o->saveToXMI(doc, root);
+        }
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    addToHash(hash, root);
+    foreach (UMLObject *o, objects) {
+        addShownTextsToHash(hash, o);
+    }
+    return hash.result().toHex();
+}
@@ -14,6 +14,8 @@
 #include "umlscene.h"
 #include "umlviewlist.h"
 
+#include <QByteArray>
+#include <QImage>
 #include <QStringList>
 #include <QRect>
 
@@ -48,9 +50,18 @@ public:
     QString exportView(UMLScene* scene, const QString &imageType, const KUrl &url) const;
 #endif
 
-    QStringList exportViews(const UMLViewList &views, const QString &imageType, const QUrl &directory, bool useFolders) const;
+    QStringList exportViews(const UMLViewList &views, const QString &imageType, const QUrl &directory, bool useFolders, bool skipUnchanged = false) const;
+
+    void setTileSize(int tileSize);
+    void setMaxImagePixels(qint64 pixels);
 private:
 
+    bool isPixmapType(const QString &imageType) const;
+    QSize imageSize(UMLScene* scene) const;
+    bool isTiled(UMLScene* scene, const QString &imageType) const;
+    QImage renderImage(UMLScene* scene) const;
+    QByteArray contentHash(UMLScene* scene, const QString &imageType) const;
+
     QString getDiagramFileName(UMLScene* scene, const QString &imageType, bool useFolders = false) const;
 
 #if QT_VERSION >= 0x050000
@@ -64,10 +75,13 @@ private:
     bool exportViewToEps(UMLScene* scene, const QString &fileName) const;
     bool exportViewToSvg(UMLScene* scene, const QString &fileName) const;
     bool exportViewToPixmap(UMLScene* scene, const QString &imageType, const QString &fileName) const;
+    bool exportViewToTiledPng(UMLScene* scene, const QString &fileName) const;
 
     static QStringList s_supportedImageTypesList;
     static QStringList s_supportedMimeTypesList;
     float m_resolution;
+    int m_tileSize;           ///< width and height of the tiles of tiled exports
+    qint64 m_maxImagePixels;  ///< larger png images are rendered in tiles
 };
 
 #endif
@@ -44,6 +44,8 @@ void ArtifactWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     UMLWidget::setPenFromSettings(painter);
     if (UMLWidget::useFillColor()) {
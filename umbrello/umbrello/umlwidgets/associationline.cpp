@@ -14,6 +14,7 @@
 // application includes
 #include "associationwidget.h"
 #include "debug_utils.h"
+#include "umlscene.h"
 #include "umlwidget.h"
 
 // qt includes
@@ -45,7 +46,11 @@ AssociationLine::AssociationLine(AssociationWidget *association)
     m_subsetSymbol(0),
     m_collaborationLineItem(0),
     m_collaborationLineHead(0),
-    m_layout(Polyline)
+    m_layout(Polyline),
+    m_pathCached(false),
+    m_paintPathCached(false),
+    m_shapeCached(false),
+    m_boundingRectCached(false)
 {
     Q_ASSERT(association);
     setFlag(QGraphicsLineItem::ItemIsSelectable);
@@ -304,6 +309,7 @@ bool AssociationLine::loadFromXMI(QDomElement &qElement)
     QDomNode node = qElement.firstChild();
 
     m_points.clear();
+    invalidateGeometry();
 
     QDomElement startElement = node.toElement();
     if(startElement.isNull() || startElement.tagName() != QLatin1String("startpoint")) {
@@ -412,6 +418,7 @@ void AssociationLine::setPen(const QPen &pen)
         m_endSymbol->setPen(pen);
 
     m_pen = pen;
+    m_shapeCached = false;
     m_pen.setCapStyle(Qt::RoundCap);
     m_pen.setJoinStyle(Qt::RoundJoin);
     Uml::AssociationType::Enum type = m_associationWidget->associationType();
@@ -644,6 +651,9 @@ void AssociationLine::removeCollaborationLine()
  */
 void AssociationLine::alignSymbols()
 {
+    // all changes of the points and the layout end here
+    invalidateGeometry();
+
     const int sz = m_points.size();
     if (sz < 2) {
         // cannot align if there is no line (one line = 2 points)
@@ -706,33 +716,78 @@ void AssociationLine::alignSymbols()
  */
 QPainterPath AssociationLine::path() const
 {
-    if (m_points.count() > 0) {
-        QPainterPath path;
+    if (!m_pathCached) {
+        m_path = createPath(m_points);
+        m_pathCached = true;
+    }
+    return m_path;
+}
+
+/**
+ * Create the path through the given points according to the layout.
+ */
+QPainterPath AssociationLine::createPath(const QVector<QPointF> &points) const
+{
+    QPainterPath path;
+    if (points.count() > 0) {
         switch (m_layout) {
         case Direct:
-            path.moveTo(m_points.first());
-            path.lineTo(m_points.last());
+            path.moveTo(points.first());
+            path.lineTo(points.last());
             break;
 
         case Spline:
-            path = createBezierCurve(m_points);
+            path = createBezierCurve(points);
             break;
 
         case Orthogonal:
-            path = createOrthogonalPath(m_points);
+            path = createOrthogonalPath(points);
             break;
 
         case Polyline:
         default:
-            QPolygonF polygon(m_points);
+            QPolygonF polygon(points);
             path.addPolygon(polygon);
             break;
         }
-        return path;
     }
-    else {
-        return QPainterPath();
+    return path;
+}
+
+/**
+ * Return the path drawn by paint(), which does not include the parts
+ * covered by the start and end symbols, and its outline for the selected
+ * state.
+ */
+const QPainterPath &AssociationLine::paintPath() const
+{
+    if (!m_paintPathCached) {
+        QVector<QPointF> points = m_points;
+        if (m_startSymbol) {
+            points[0] = m_startSymbol->mapToParent(m_startSymbol->symbolEndPoints().first);
+        }
+        if (m_endSymbol) {
+            points[points.size() - 1] = m_endSymbol->mapToParent(m_endSymbol->symbolEndPoints().first);
+        }
+        m_paintPath = createPath(points);
+        QPainterPathStroker stroker;
+        stroker.setWidth(3.0);
+        m_selectionOutline = stroker.createStroke(m_paintPath);
+        m_paintPathCached = true;
     }
+    return m_paintPath;
+}
+
+/**
+ * Drop the cached geometry after the points, the layout or the symbols
+ * have changed.
+ */
+void AssociationLine::invalidateGeometry()
+{
+    m_pathCached = false;
+    m_paintPathCached = false;
+    m_shapeCached = false;
+    m_boundingRectCached = false;
 }
 
 /**
@@ -742,11 +797,14 @@ QPainterPath AssociationLine::path() const
  */
 QRectF AssociationLine::boundingRect() const
 {
-    QPolygonF polygon(m_points);
-    QRectF rect = polygon.boundingRect();
-    const qreal margin(5.0);
-    rect.adjust(-margin, -margin, margin, margin);
-    return rect;
+    if (!m_boundingRectCached) {
+        QPolygonF polygon(m_points);
+        m_boundingRect = polygon.boundingRect();
+        const qreal margin(5.0);
+        m_boundingRect.adjust(-margin, -margin, margin, margin);
+        m_boundingRectCached = true;
+    }
+    return m_boundingRect;
 }
 
 /**
@@ -754,10 +812,14 @@ QRectF AssociationLine::boundingRect() const
  */
 QPainterPath AssociationLine::shape() const
 {
-    QPainterPathStroker stroker;
-    stroker.setWidth(qMax<qreal>(2*SelectedPointDiameter, pen().widthF()) + 2.0);  // allow delta region
-    stroker.setCapStyle(Qt::FlatCap);
-    return stroker.createStroke(path());
+    if (!m_shapeCached) {
+        QPainterPathStroker stroker;
+        stroker.setWidth(qMax<qreal>(2*SelectedPointDiameter, pen().widthF()) + 2.0);  // allow delta region
+        stroker.setCapStyle(Qt::FlatCap);
+        m_shape = stroker.createStroke(path());
+        m_shapeCached = true;
+    }
+    return m_shape;
 }
 
 /**
@@ -918,7 +980,6 @@ QPainterPath AssociationLine::createOrthogonalPath(QVector<QPointF> points)
  */
 void AssociationLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(widget)
     QPen _pen = pen();
     const QColor orig = _pen.color().lighter();
     QColor invertedColor(orig.green(), orig.blue(), orig.red());
@@ -934,35 +995,27 @@ void AssociationLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
         return;
     }
 
-    QPointF savedStart = m_points.first();
-    QPointF savedEnd = m_points.last();
-
-    // modify the m_points array not to include the Symbol, the value depends on Symbol
-    if (m_startSymbol) {
-        QPointF newStart = m_startSymbol->mapToParent(m_startSymbol->symbolEndPoints().first);
-        m_points[0] = newStart;
-    }
-
-    if (m_endSymbol) {
-        QPointF newEnd = m_endSymbol->mapToParent(m_endSymbol->symbolEndPoints().first);
-        m_points[sz - 1] = newEnd;
+    UMLScene *scene = m_associationWidget->umlScene();
+    if (scene && scene->isLowDetail(painter, widget)) {
+        // a thin line is enough when zoomed out far, symbols and labels are not drawn
+        painter->setPen(QPen(_pen.color(), 0));
+        painter->setBrush(Qt::NoBrush);
+        painter->drawPath(path());
+        return;
     }
 
     painter->setPen(_pen);
     painter->setBrush(Qt::NoBrush);
-    painter->drawPath(path());
+    painter->drawPath(paintPath());
 
     if (option->state & QStyle::State_Selected) {
         // make the association broader in the selected state
-        QPainterPathStroker stroker;
-        stroker.setWidth(3.0);
-        QPainterPath outline = stroker.createStroke(path());
         QColor shadowColor(Qt::lightGray);
         shadowColor.setAlpha(80);
         QBrush shadowBrush(shadowColor);
         painter->setBrush(shadowBrush);
         painter->setPen(Qt::NoPen);
-        painter->drawPath(outline);
+        painter->drawPath(m_selectionOutline);
 
         // set color for selected painting
         _pen.setColor(Qt::blue);
@@ -971,7 +1024,7 @@ void AssociationLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
         painter->setPen(Qt::NoPen);
 
         // draw points
-        circle.moveCenter(savedStart);
+        circle.moveCenter(m_points.first());
         painter->drawRect(circle);
         for (int i = 1; i < sz-1; ++i) {
             if (i != m_activePointIndex) {
@@ -979,7 +1032,7 @@ void AssociationLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
                 painter->drawRect(circle);
             }
         }
-        circle.moveCenter(savedEnd);
+        circle.moveCenter(m_points.last());
         painter->drawRect(circle);
 
         if (m_activePointIndex != -1) {
@@ -1012,10 +1065,6 @@ void AssociationLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
         }
 
     }
-
-    // now restore the points array
-    m_points[0] = savedStart;
-    m_points[sz - 1] = savedEnd;
 }
 
 /**
@@ -1320,7 +1369,11 @@ void Symbol::setSymbolType(SymbolType symbolType)
  */
 void Symbol::paint(QPainter *painter, const QStyleOptionGraphicsItem * option, QWidget * widget)
 {
-    Q_UNUSED(option) Q_UNUSED(widget)
+    Q_UNUSED(option)
+    UMLScene *umlScene = qobject_cast<UMLScene*>(scene());
+    if (umlScene && umlScene->isLowDetail(painter, widget)) {
+        return;
+    }
     painter->setPen(m_pen);
     switch (m_symbolType) {
     case ClosedArrow:
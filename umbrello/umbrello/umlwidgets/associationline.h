@@ -15,6 +15,7 @@
 
 #include <QGraphicsObject>
 #include <QList>
+#include <QPainterPath>
 #include <QPen>
 #include <QPoint>
 
@@ -186,6 +187,10 @@ private:
 
     void createSplinePoints();
 
+    void invalidateGeometry();
+    QPainterPath createPath(const QVector<QPointF> &points) const;
+    const QPainterPath &paintPath() const;
+
     AssociationWidget *m_associationWidget;      ///< association widget for which this line represents
     QVector<QPointF>   m_points;                 ///< points representing the association line
     int                m_activePointIndex;       ///< index of active point which can be dragged to modify association line
@@ -198,6 +203,17 @@ private:
     LayoutType         m_layout;
     QPen               m_pen;                    ///< pen used to draw an association line
 
+    // geometry cached until the points, the layout, the symbols or the pen change
+    mutable QPainterPath m_path;                 ///< path()
+    mutable QPainterPath m_paintPath;            ///< path() between the start and the end symbol
+    mutable QPainterPath m_selectionOutline;     ///< stroke of m_paintPath drawn in the selected state
+    mutable QPainterPath m_shape;                ///< shape()
+    mutable QRectF       m_boundingRect;         ///< boundingRect()
+    mutable bool         m_pathCached;
+    mutable bool         m_paintPathCached;
+    mutable bool         m_shapeCached;
+    mutable bool         m_boundingRectCached;
+
     static QPainterPath createBezierCurve(QVector<QPointF> points);
     static QPainterPath createOrthogonalPath(QVector<QPointF> points);
 
@@ -51,10 +51,13 @@
 #endif
 #include <QPainterPath>
 #include <QPointer>
+#include <QPair>
 #include <QRegExpValidator>
+#include <QVector>
 #include <QApplication>
 
 // system includes
+#include <algorithm>
 #include <cmath>
 
 #define DBG_AW() DEBUG(QLatin1String("AssociationWidget"))
@@ -70,7 +73,6 @@ using namespace Uml;
   */
 AssociationWidget::AssociationWidget(UMLScene *scene)
   : WidgetBase(scene, WidgetBase::wt_Association),
-    m_positions_len(0),
     m_activated(false),
     m_unNameLineSegment(-1),
     m_nLinePathSegmentIndex(-1),
@@ -3369,14 +3371,15 @@ void AssociationWidget::mouseMoveEvent(QGraphicsSceneMouseEvent* me)
 /**
  * Returns the number of lines there are on the given region for
  * either widget A or B of the association.
+ * Only the associations attached to the widget are looked at.
  */
 int AssociationWidget::getRegionCount(Uml::Region::Enum region, Uml::RoleType::Enum role)
 {
-    if ((region == Uml::Region::Error) | (umlScene() == NULL)) {
+    if ((region == Uml::Region::Error) | (umlScene() == NULL) | (m_role[role].umlWidget == NULL)) {
         return 0;
     }
     int widgetCount = 0;
-    AssociationWidgetList list = m_scene->associationList();
+    const AssociationWidgetList& list = m_role[role].umlWidget->associationWidgetList();
     foreach (AssociationWidget* assocwidget, list) {
         //don't count this association
         if (assocwidget == this)
@@ -3501,48 +3504,33 @@ qreal AssociationWidget::findInterceptOnEdge(const QRectF &rect,
 }
 
 /**
- * Auxiliary method for updateAssociations():
- * Put position into m_positions and assoc into m_ordered at the
- * correct index.
- * m_positions and m_ordered move in parallel and are sorted by
- * ascending position.
+ * Auxiliary for updateAssociations(): compares the intercept positions
+ * of two associations on the edge of a widget.
  */
-void AssociationWidget::insertIntoLists(qreal position, const AssociationWidget* assoc)
+static bool lessPosition(const QPair<qreal, AssociationWidget*> &a,
+                         const QPair<qreal, AssociationWidget*> &b)
 {
-    bool did_insertion = false;
-    for (int index = 0; index < m_positions_len; ++index) {
-        if (position < m_positions[index]) {
-            for (int moveback = m_positions_len; moveback > index; moveback--)
-                m_positions[moveback] = m_positions[moveback - 1];
-            m_positions[index] = position;
-            m_ordered.insert(index, const_cast<AssociationWidget*>(assoc));
-            did_insertion = true;
-            break;
-        }
-    }
-    if (! did_insertion) {
-        m_positions[m_positions_len] = position;
-        m_ordered.append(const_cast<AssociationWidget*>(assoc));
-    }
-    m_positions_len++;
+    return a.first < b.first;
 }
 
 /**
  * Tells all the other view associations the new count for the
  * given widget on a certain region. And also what index they should be.
+ * Only the associations attached to the widget are looked at.
  */
 void AssociationWidget::updateAssociations(int totalCount,
                                            Uml::Region::Enum region,
                                            Uml::RoleType::Enum role)
 {
-    if ((region == Uml::Region::Error) | (umlScene() == NULL)) {
+    if ((region == Uml::Region::Error) | (umlScene() == NULL) | (m_role[role].umlWidget == NULL)) {
         return;
     }
-    AssociationWidgetList list = m_scene->associationList();
-
     UMLWidget *ownWidget = m_role[role].umlWidget;
-    m_positions_len = 0;
-    m_ordered.clear();
+    const AssociationWidgetList list = ownWidget->associationWidgetList();
+
+    // intercept positions on the edge with their associations
+    QVector<QPair<qreal, AssociationWidget*> > ordered;
+    ordered.reserve(list.count());
     // we order the AssociationWidget list by region and x/y value
     foreach (AssociationWidget* assocwidget, list) {
         WidgetRole *roleA = &assocwidget->m_role[RoleType::A];
@@ -3585,12 +3573,14 @@ void AssociationWidget::updateAssociations(int totalCount,
                            << " otherWidget=" << otherWidget->name();
             continue;
         }
-        insertIntoLists(intercept, assocwidget);
+        ordered.append(qMakePair(intercept, assocwidget));
     } // while ((assocwidget = assoc_it.current()))
+    std::stable_sort(ordered.begin(), ordered.end(), lessPosition);
 
     // we now have an ordered list and we only have to call updateRegionLineCount
     int index = 1;
-    foreach (AssociationWidget* assocwidget, m_ordered ) {
+    for (int i = 0; i < ordered.count(); ++i) {
+        AssociationWidget* assocwidget = ordered.at(i).second;
         if (ownWidget == assocwidget->widgetForRole(RoleType::A)) {
             assocwidget->updateRegionLineCount(index++, totalCount, region, RoleType::A);
         } else if (ownWidget == assocwidget->widgetForRole(RoleType::B)) {
@@ -288,12 +288,6 @@ private:
 
     bool linePathStartsAt(const UMLWidget* widget);
 
-    void insertIntoLists(qreal position, const AssociationWidget* assoc);
-
-    qreal m_positions[100];           ///< auxiliary variable for updateAssociations()
-    int m_positions_len;              ///< auxiliary variable for updateAssociations()
-    AssociationWidgetList m_ordered;  ///< auxiliary variable for updateAssociations()
-
     bool m_activated;   ///< flag which is true if the activate method has been called for this class instance
 
     /**
@@ -45,7 +45,8 @@ const int ClassifierWidget::SOCKET_INCREMENT = 10;
  */
 ClassifierWidget::ClassifierWidget(UMLScene * scene, UMLClassifier *c)
   : UMLWidget(scene, WidgetBase::wt_Class, c),
-    m_pAssocWidget(0), m_pInterfaceName(0)
+    m_pAssocWidget(0), m_pInterfaceName(0),
+    m_memberTextsValid(false)
 {
     const Settings::OptionState& ops = m_scene->optionState();
     setVisualPropertyCmd(ShowVisibility, ops.classState.showVisibility);
@@ -91,7 +92,8 @@ ClassifierWidget::ClassifierWidget(UMLScene * scene, UMLClassifier *c)
 ClassifierWidget::ClassifierWidget(UMLScene * scene, UMLPackage *o)
   : UMLWidget(scene, WidgetBase::wt_Package, o),
     m_pAssocWidget(0),
-    m_pInterfaceName(0)
+    m_pInterfaceName(0),
+    m_memberTextsValid(false)
 {
     const Settings::OptionState& ops = m_scene->optionState();
     setVisualPropertyCmd(ShowVisibility, ops.classState.showVisibility);
@@ -435,22 +437,77 @@ void ClassifierWidget::toggleShowAttSigs()
     update();
 }
 
+/**
+ * Return the texts of the displayed members of the given ObjectType.
+ * Takes into consideration m_showPublicOnly but not other settings.
+ *
+ * Formatting and measuring the members is expensive, therefore the
+ * texts are kept until the classifier is modified, which is signalled
+ * by updateWidget(), or until another model object is modified, which
+ * may change the name of a type. A change of the font, the signature
+ * types or the active language rebuilds the texts too.
+ *
+ * @param ot   Object type, either ot_Attribute or ot_Operation.
+ */
+const ClassifierWidget::MemberTextList &ClassifierWidget::memberTexts(UMLObject::ObjectType ot) const
+{
+    const bool publicOnly = visualProperty(ShowPublicOnly);
+    const Uml::ProgrammingLanguage::Enum language = UMLApp::app()->activeLanguage();
+    if (m_memberTextsValid &&
+            m_memberTextsModification == UMLObject::modificationCount() &&
+            m_memberTextsAttributeSignature == m_attributeSignature &&
+            m_memberTextsOperationSignature == m_operationSignature &&
+            m_memberTextsPublicOnly == publicOnly &&
+            m_memberTextsLanguage == language &&
+            m_memberTextsFont == UMLWidget::font()) {
+        return ot == UMLObject::ot_Attribute ? m_attributeTexts : m_operationTexts;
+    }
+
+    m_attributeTexts.clear();
+    m_operationTexts.clear();
+    UMLClassifier *umlc = classifier();
+    if (umlc) {
+        QFont f = UMLWidget::font();
+        f.setBold(false);
+        for (int i = 0; i < 2; ++i) {
+            const UMLObject::ObjectType type = (i == 0 ? UMLObject::ot_Attribute : UMLObject::ot_Operation);
+            const Uml::SignatureType::Enum sigType = (i == 0 ? m_attributeSignature : m_operationSignature);
+            MemberTextList &texts = (i == 0 ? m_attributeTexts : m_operationTexts);
+            UMLClassifierListItemList list = umlc->getFilteredList(type);
+            texts.reserve(list.count());
+            foreach (UMLClassifierListItem *obj, list) {
+                if (publicOnly && obj->visibility() != Uml::Visibility::Public)
+                    continue;
+                MemberText member;
+                member.text = obj->toString(sigType);
+                member.isAbstract = obj->isAbstract();
+                member.isStatic = obj->isStatic();
+                f.setItalic(member.isAbstract);
+                f.setUnderline(member.isStatic);
+                member.width = QFontMetrics(f).size(0, member.text).width();
+                texts.append(member);
+            }
+        }
+    }
+
+    // texts built while loading may refer to unresolved types
+    m_memberTextsValid = !m_doc->loading();
+    m_memberTextsModification = UMLObject::modificationCount();
+    m_memberTextsAttributeSignature = m_attributeSignature;
+    m_memberTextsOperationSignature = m_operationSignature;
+    m_memberTextsPublicOnly = publicOnly;
+    m_memberTextsLanguage = language;
+    m_memberTextsFont = UMLWidget::font();
+    return ot == UMLObject::ot_Attribute ? m_attributeTexts : m_operationTexts;
+}
+
 /**
  * Return the number of displayed members of the given ObjectType.
  * Takes into consideration m_showPublicOnly but not other settings.
  */
 int ClassifierWidget::displayedMembers(UMLObject::ObjectType ot) const
 {
-    int count = 0;
-    UMLClassifier *umlc = this->classifier();
-    if (!umlc)
-        return count;
-    UMLClassifierListItemList list = umlc->getFilteredList(ot);
-    foreach (UMLClassifierListItem *m, list) {
-      if (!(visualProperty(ShowPublicOnly) && m->visibility() != Uml::Visibility::Public))
-            count++;
-    }
-    return count;
+    return memberTexts(ot).count();
 }
 
 /**
@@ -537,11 +594,8 @@ QSizeF ClassifierWidget::calculateSize(bool withExtensions /* = true */) const
         if (numAtts > 0) {
             height += fontHeight * numAtts;
             // calculate width of the attributes
-            UMLClassifierListItemList list = umlc->getFilteredList(UMLObject::ot_Attribute);
-            foreach (UMLClassifierListItem *a, list) {
-                if (visualProperty(ShowPublicOnly) && a->visibility() != Uml::Visibility::Public)
-                    continue;
-                const int attWidth = fm.size(0, a->toString(m_attributeSignature)).width();
+            foreach (const MemberText &a, memberTexts(UMLObject::ot_Attribute)) {
+                const int attWidth = fm.size(0, a.text).width();
                 if (attWidth > width)
                     width = attWidth;
             }
@@ -556,14 +610,10 @@ QSizeF ClassifierWidget::calculateSize(bool withExtensions /* = true */) const
         if (numOps > 0) {
             height += numOps * fontHeight;
             // ... width
-            UMLOperationList list(umlc->getOpList());
-            foreach (UMLOperation* op,  list) {
-                      if (visualProperty(ShowPublicOnly) && op->visibility() != Uml::Visibility::Public)
-                    continue;
-                const QString displayedOp = op->toString(m_operationSignature);
+            foreach (const MemberText &op, memberTexts(UMLObject::ot_Operation)) {
                 UMLWidget::FontType oft;
-                oft = (op->isAbstract() ? UMLWidget::FT_ITALIC : UMLWidget::FT_NORMAL);
-                const int w = UMLWidget::getFontMetrics(oft).size(0, displayedOp).width();
+                oft = (op.isAbstract ? UMLWidget::FT_ITALIC : UMLWidget::FT_NORMAL);
+                const int w = UMLWidget::getFontMetrics(oft).size(0, op.text).width();
                 if (w > width)
                     width = w;
             }
@@ -650,6 +700,17 @@ int ClassifierWidget::displayedOperations() const
     return displayedMembers(UMLObject::ot_Operation);
 }
 
+/**
+ * Overrides method from UMLWidget.
+ * The classifier has been modified, the texts of its members are
+ * built again when they are needed.
+ */
+void ClassifierWidget::updateWidget()
+{
+    m_memberTextsValid = false;
+    UMLWidget::updateWidget();
+}
+
 /**
  * Set the AssociationWidget when this ClassWidget acts as
  * an association class.
@@ -684,6 +745,8 @@ void ClassifierWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
     setPenFromSettings(painter);
     if (UMLWidget::useFillColor())
         painter->setBrush(UMLWidget::fillColor());
@@ -809,8 +872,7 @@ void ClassifierWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 
         const int numAtts = displayedAttributes();
         if (numAtts > 0) {
-            drawMembers(painter, UMLObject::ot_Attribute, m_attributeSignature, textX,
-                        bodyOffsetY, fontHeight);
+            drawMembers(painter, UMLObject::ot_Attribute, textX, bodyOffsetY, fontHeight);
             bodyOffsetY += fontHeight * numAtts;
         }
         else
@@ -826,8 +888,7 @@ void ClassifierWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 
         const int numOps = displayedOperations();
         if (numOps >= 0) {
-            drawMembers(painter, UMLObject::ot_Operation, m_operationSignature, textX,
-                        bodyOffsetY, fontHeight);
+            drawMembers(painter, UMLObject::ot_Operation, textX, bodyOffsetY, fontHeight);
         }
     }
 
@@ -1014,37 +1075,27 @@ QSize ClassifierWidget::calculateAsPackageSize() const
  *
  * @param p          QPainter to paint to.
  * @param ot         Object type to draw, either ot_Attribute or ot_Operation.
- * @param sigType    Governs details of the member display.
  * @param x          X coordinate at which to draw the texts.
  * @param y          Y coordinate at which text drawing commences.
  * @param fontHeight The font height.
  */
-void ClassifierWidget::drawMembers(QPainter * painter, UMLObject::ObjectType ot, Uml::SignatureType::Enum sigType,
+void ClassifierWidget::drawMembers(QPainter * painter, UMLObject::ObjectType ot,
                                    int x, int y, int fontHeight)
 {
-    UMLClassifier *umlc = classifier();
-    if (!umlc) {
-        return;
-    }
     QFont f = UMLWidget::font();
     f.setBold(false);
-    UMLClassifierListItemList list = umlc->getFilteredList(ot);
     painter->setClipping(true);
     painter->setClipRect(rect());
-    foreach (UMLClassifierListItem *obj, list) {
-          if (visualProperty(ShowPublicOnly) && obj->visibility() != Uml::Visibility::Public)
-            continue;
-        QString text = obj->toString(sigType);
-        f.setItalic(obj->isAbstract());
-        f.setUnderline(obj->isStatic());
-        painter->setFont(f);
-        QFontMetrics fontMetrics(f);
-        painter->drawText(x, y, fontMetrics.size(0, text).width(), fontHeight, Qt::AlignVCenter, text);
-        f.setItalic(false);
-        f.setUnderline(false);
+    foreach (const MemberText &member, memberTexts(ot)) {
+        f.setItalic(member.isAbstract);
+        f.setUnderline(member.isStatic);
         painter->setFont(f);
+        painter->drawText(x, y, member.width, fontHeight, Qt::AlignVCenter, member.text);
         y += fontHeight;
     }
+    f.setItalic(false);
+    f.setUnderline(false);
+    painter->setFont(f);
     painter->setClipping(false);
 }
 
@@ -15,6 +15,8 @@
 #include "umlobject.h"
 #include "umlwidget.h"
 
+#include <QVector>
+
 class AssociationWidget;
 class FloatingTextWidget;
 class QPainter;
@@ -108,6 +110,7 @@ public:
 
 public Q_SLOTS:
     virtual void slotMenuSelection(QAction* action);
+    virtual void updateWidget();
 
 private Q_SLOTS:
     void slotShowAttributes(bool state);
@@ -125,9 +128,23 @@ private:
     void drawAsPackage(QPainter *painter, const QStyleOptionGraphicsItem *option);
     QSize calculateAsPackageSize() const;
 
+    /**
+     * Text of a displayed attribute or operation.
+     */
+    class MemberText
+    {
+    public:
+        QString text;
+        bool isAbstract;
+        bool isStatic;
+        int width;   ///< width of the text in the font it is painted with
+    };
+    typedef QVector<MemberText> MemberTextList;
+
+    const MemberTextList &memberTexts(UMLObject::ObjectType ot) const;
+
     int displayedMembers(UMLObject::ObjectType ot) const;
-    void drawMembers(QPainter *painter, UMLObject::ObjectType ot, Uml::SignatureType::Enum sigType,
-                     int x, int y, int fontHeight);
+    void drawMembers(QPainter *painter, UMLObject::ObjectType ot, int x, int y, int fontHeight);
 
     static const int MARGIN;           ///< text width margin
     static const int CIRCLE_SIZE;      ///< size of circle when interface is rendered as such
@@ -139,6 +156,17 @@ private:
     AssociationWidget *m_pAssocWidget; ///< related AssociationWidget in case this classifier acts as an association class
     FloatingTextWidget *m_pInterfaceName;  ///< Separate widget for name in case of interface drawn as circle
 
+    // texts of the displayed members, built on demand by memberTexts()
+    mutable MemberTextList m_attributeTexts;
+    mutable MemberTextList m_operationTexts;
+    mutable bool m_memberTextsValid;            ///< false after updateWidget()
+    mutable uint m_memberTextsModification;     ///< UMLObject::modificationCount() the texts were built at
+    mutable QFont m_memberTextsFont;            ///< font the texts were measured with
+    mutable Uml::SignatureType::Enum m_memberTextsAttributeSignature;
+    mutable Uml::SignatureType::Enum m_memberTextsOperationSignature;
+    mutable bool m_memberTextsPublicOnly;
+    mutable Uml::ProgrammingLanguage::Enum m_memberTextsLanguage;
+
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(ClassifierWidget::VisualProperties)
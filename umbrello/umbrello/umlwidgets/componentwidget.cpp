@@ -54,6 +54,8 @@ void ComponentWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     UMLComponent *umlcomp = static_cast<UMLComponent*>(m_umlObject);
     if (umlcomp == NULL)
@@ -47,6 +47,8 @@ DatatypeWidget::~DatatypeWidget()
  */
 void DatatypeWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+    if (paintLowDetail(painter, option, widget))
+        return;
     setPenFromSettings(painter);
     if (UMLWidget::useFillColor())  {
         painter->setBrush(UMLWidget::fillColor());
@@ -53,6 +53,8 @@ void EntityWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *opti
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     setPenFromSettings(painter);
     if(UMLWidget::useFillColor())
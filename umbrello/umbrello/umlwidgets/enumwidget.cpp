@@ -94,6 +94,8 @@ void EnumWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *option
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     setPenFromSettings(painter);
     if(UMLWidget::useFillColor())
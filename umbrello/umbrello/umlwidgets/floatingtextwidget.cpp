@@ -685,7 +685,9 @@ UMLWidget* FloatingTextWidget::onWidget(const QPointF &p)
 void FloatingTextWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
     Q_UNUSED(option);
-    Q_UNUSED(widget);
+    // labels are not readable when zoomed out far
+    if (m_scene && m_scene->isLowDetail(painter, widget))
+        return;
 
     int w = width();
     int h = height();
@@ -50,6 +50,8 @@ void NodeWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *option
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     setPenFromSettings(painter);
     if (UMLWidget::useFillColor()) {
@@ -67,6 +67,8 @@ void NoteWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *option
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     const int margin = 10;
     int w = width();
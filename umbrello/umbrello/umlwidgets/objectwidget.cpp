@@ -147,6 +147,8 @@ void ObjectWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *opti
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     if (m_drawAsActor)
         paintActor(painter);
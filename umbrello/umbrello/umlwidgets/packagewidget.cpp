@@ -57,6 +57,8 @@ void PackageWidget::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
 {
     Q_UNUSED(option);
     Q_UNUSED(widget);
+    if (paintLowDetail(painter, option, widget))
+        return;
 
     setPenFromSettings(painter);
     if (UMLWidget::useFillColor())
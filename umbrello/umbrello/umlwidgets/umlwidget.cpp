@@ -1176,6 +1176,30 @@ void UMLWidget::setPenFromSettings(QPainter *p)
     p->setPen(QPen(m_lineColor, m_lineWidth));
 }
 
+/**
+ * Draw the widget as a plain box when the scene is painted below its
+ * level of detail threshold, see UMLScene::isLowDetail(). Widgets with
+ * expensive contents call this first in paint() and return if it did
+ * the drawing.
+ *
+ * @return True if the widget has been drawn.
+ */
+bool UMLWidget::paintLowDetail(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    if (!m_scene || !m_scene->isLowDetail(painter, widget)) {
+        return false;
+    }
+    painter->setPen(QPen(m_lineColor, 0));
+    if (m_useFillColor) {
+        painter->setBrush(m_fillColor);
+    } else {
+        painter->setBrush(m_scene->backgroundColor());
+    }
+    painter->drawRect(0, 0, width(), height());
+    UMLWidget::paint(painter, option, widget);
+    return true;
+}
+
 /**
  * Returns the cursor to be shown when resizing the widget.
  * Default cursor is KCursor::sizeFDiagCursor().
@@ -273,6 +273,8 @@ protected:
 
     void setSelectionBounds();
 
+    bool paintLowDetail(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
+
     void resize(QGraphicsSceneMouseEvent *me);
 
     bool wasSizeChanged();
@@ -0,0 +1,237 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "xmisavejob.h"
+
+// app includes
+#include "debug_utils.h"
+
+// kde includes
+#include <KLocalizedString>
+#if QT_VERSION < 0x050000
+#include <ksavefile.h>
+#endif
+#include <ktar.h>
+#if QT_VERSION < 0x050000
+#include <ktemporaryfile.h>
+#endif
+
+// qt includes
+#include <QFile>
+#include <QFileInfo>
+#include <QRegExp>
+#if QT_VERSION >= 0x050000
+#include <QSaveFile>
+#include <QTemporaryFile>
+#endif
+
+/**
+ * Size of the blocks written at once, progress() is emitted after each.
+ */
+static const qint64 BlockSize = 1024 * 1024;
+
+/**
+ * Constructor.
+ *
+ * @param xmi        The XMI data to be written.
+ * @param fileName   The local file to write to.
+ * @param parent     Parent object for QThread constructor.
+ */
+XMISaveJob::XMISaveJob(const QByteArray& xmi, const QString& fileName, QObject* parent)
+  : QThread(parent),
+    m_xmi(xmi),
+    m_fileName(fileName),
+    m_success(false),
+    m_cancelled(0)
+{
+}
+
+/**
+ * Return the file written by the job.
+ */
+QString XMISaveJob::fileName() const
+{
+    return m_fileName;
+}
+
+/**
+ * Return whether the file has been written successfully.
+ * Valid after the job has finished.
+ */
+bool XMISaveJob::success() const
+{
+    return m_success;
+}
+
+/**
+ * Return the message describing why the file could not be written.
+ */
+QString XMISaveJob::errorMessage() const
+{
+    return m_errorMessage;
+}
+
+/**
+ * Stop writing the file as soon as possible, may be called from any
+ * thread. The destination keeps its previous contents and saved()
+ * reports a failure. Wait for the job to finish before writing the
+ * destination from elsewhere.
+ */
+void XMISaveJob::cancel()
+{
+#if QT_VERSION >= 0x050000
+    m_cancelled.store(1);
+#else
+    m_cancelled = 1;
+#endif
+}
+
+/**
+ * Return whether cancel() has been called.
+ */
+bool XMISaveJob::isCancelled() const
+{
+#if QT_VERSION >= 0x050000
+    return m_cancelled.load() != 0;
+#else
+    return int(m_cancelled) != 0;
+#endif
+}
+
+/**
+ * Return the format a model file is saved in, derived from its name.
+ *
+ * @param fileName   The name of the file.
+ * @return  "tgz", "bz2" or "xmi"
+ */
+QString XMISaveJob::fileFormat(const QString& fileName)
+{
+    QString fileExt = QFileInfo(fileName).completeSuffix();
+    if (fileExt == QLatin1String("xmi.tgz") || fileExt == QLatin1String("bak.xmi.tgz")) {
+        return QLatin1String("tgz");
+    } else if (fileExt == QLatin1String("xmi.tar.bz2") || fileExt == QLatin1String("bak.xmi.tar.bz2")) {
+        return QLatin1String("bz2");
+    }
+    return QLatin1String("xmi");
+}
+
+/**
+ * Compress the snapshot if needed and write it to the destination file.
+ */
+void XMISaveJob::run()
+{
+    QString format = fileFormat(m_fileName);
+    if (format == QLatin1String("xmi")) {
+        m_success = writeFile(m_xmi);
+    } else {
+        m_success = writeArchive(format);
+    }
+    // the snapshot is not needed anymore
+    m_xmi.clear();
+    if (!m_success) {
+        uError() << m_errorMessage;
+    }
+    emit saved(m_success, m_errorMessage);
+}
+
+/**
+ * Pack the snapshot into a compressed tar archive and write the
+ * archive to the destination file. The name of the XMI file in the
+ * archive is the name of the destination without the archive extension.
+ *
+ * @param format   "tgz" or "bz2"
+ */
+bool XMISaveJob::writeArchive(const QString& format)
+{
+#if QT_VERSION >= 0x050000
+    QTemporaryFile tmp_xmi_file;
+    QTemporaryFile tmp_tgz_file;
+#else
+    KTemporaryFile tmp_xmi_file;
+    KTemporaryFile tmp_tgz_file;
+#endif
+    if (!tmp_xmi_file.open() || !tmp_tgz_file.open() ||
+            tmp_xmi_file.write(m_xmi) != m_xmi.size() || !tmp_xmi_file.flush()) {
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+    tmp_tgz_file.close();
+
+    KTar archive(tmp_tgz_file.fileName(),
+                 format == QLatin1String("tgz") ? QLatin1String("application/x-gzip")
+                                                : QLatin1String("application/x-bzip"));
+    if (!archive.open(QIODevice::WriteOnly)) {
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+    QString entryName = QFileInfo(m_fileName).fileName();
+    if (format == QLatin1String("tgz")) {
+        entryName.remove(QRegExp(QLatin1String("\\.tgz$")));
+    } else {
+        entryName.remove(QRegExp(QLatin1String("\\.tar\\.bz2$")));
+    }
+    archive.addLocalFile(tmp_xmi_file.fileName(), entryName);
+    if (!archive.close()) {
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+
+    QFile compressed(tmp_tgz_file.fileName());
+    if (!compressed.open(QIODevice::ReadOnly)) {
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+    return writeFile(compressed.readAll());
+}
+
+/**
+ * Write the given data to a temporary file next to the destination and
+ * rename it to the destination when done, so that the destination is
+ * never left partially written.
+ *
+ * @param data   The contents of the file.
+ */
+bool XMISaveJob::writeFile(const QByteArray& data)
+{
+#if QT_VERSION >= 0x050000
+    QSaveFile file(m_fileName);
+#else
+    KSaveFile file(m_fileName);
+#endif
+    if (!file.open(QIODevice::WriteOnly)) {
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+    const qint64 total = data.size();
+    for (qint64 written = 0; written < total;) {
+        const qint64 size = qMin(BlockSize, total - written);
+        if (isCancelled() || file.write(data.constData() + written, size) != size) {
+            m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+#if QT_VERSION >= 0x050000
+            file.cancelWriting();
+#else
+            file.abort();
+#endif
+            return false;
+        }
+        written += size;
+        emit progress(written, total);
+    }
+#if QT_VERSION >= 0x050000
+    if (!file.commit()) {
+#else
+    if (!file.finalize()) {
+#endif
+        m_errorMessage = i18n("There was a problem saving: %1", m_fileName);
+        return false;
+    }
+    return true;
+}
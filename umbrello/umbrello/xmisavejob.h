@@ -0,0 +1,70 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef XMISAVEJOB_H
+#define XMISAVEJOB_H
+
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QString>
+#include <QThread>
+
+/**
+ * This class writes a snapshot of the model to a local file in a
+ * separate thread.
+ *
+ * The snapshot is the XMI data created by UMLDoc::saveToXMI() in the
+ * GUI thread. The job compresses it if the file name asks for a
+ * .xmi.tgz or .xmi.tar.bz2 archive, and writes the result to a
+ * temporary file next to the destination, which replaces the
+ * destination only after it has been written completely.
+ *
+ * Progress and the result are reported with the signals progress()
+ * and saved(). A job stopped with cancel() leaves the destination
+ * untouched.
+ *
+ * @short Writes XMI data to disk in a separate thread
+ * Bugs and comments to umbrello-devel@kde.org or http://bugs.kde.org
+ */
+class XMISaveJob : public QThread
+{
+    Q_OBJECT
+
+public:
+    XMISaveJob(const QByteArray& xmi, const QString& fileName, QObject* parent = 0);
+
+    QString fileName() const;
+    bool success() const;
+    QString errorMessage() const;
+
+    void cancel();
+    bool isCancelled() const;
+
+    static QString fileFormat(const QString& fileName);
+
+signals:
+    void progress(qint64 written, qint64 total);
+    void saved(bool success, const QString& errorMessage);
+
+protected:
+    void run();
+
+private:
+    bool writeArchive(const QString& format);
+    bool writeFile(const QByteArray& data);
+
+    QByteArray m_xmi;        ///< the snapshot of the model
+    QString m_fileName;      ///< the local destination file
+    bool m_success;
+    QString m_errorMessage;
+    QAtomicInt m_cancelled;  ///< set by cancel(), read by the job thread
+};
+
+#endif
@@ -0,0 +1,338 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "xmistreamloader.h"
+
+// app includes
+#include "debug_utils.h"
+#include "folder.h"
+#include "umldoc.h"
+
+// kde includes
+#include <KLocalizedString>
+
+// qt includes
+#include <QApplication>
+#include <QIODevice>
+
+/**
+ * Constructor.
+ *
+ * @param doc   The document to load the model into.
+ */
+XMIStreamLoader::XMIStreamLoader(UMLDoc *doc)
+  : m_doc(doc),
+    m_count(0)
+{
+}
+
+/**
+ * Load the model from the given XMI file.
+ * Only the parsing is done here, the post processing (type resolution,
+ * activation of the views) is left to UMLDoc::loadFromXMI().
+ *
+ * @param file   The file to load, encoded in UTF-8.
+ * @return  True on success.
+ */
+bool XMIStreamLoader::load(QIODevice &file)
+{
+    m_reader.setDevice(&file);
+    // same as QDomDocument::setContent(data, false): tag names keep their prefix
+    m_reader.setNamespaceProcessing(false);
+
+    if (!m_reader.readNextStartElement()) {
+        uWarning() << "Cannot read content:" << m_reader.errorString()
+                   << " Line:" << m_reader.lineNumber();
+        return false;
+    }
+    //  make sure it is an XMI file
+    QString tag = m_reader.qualifiedName().toString();
+    if (tag != QLatin1String("XMI") && tag != QLatin1String("xmi:XMI")) {
+        return false;
+    }
+
+    while (m_reader.readNextStartElement()) {
+        tag = m_reader.qualifiedName().toString();
+        if (tag == QLatin1String("XMI.header")) {
+            QDomDocument domDoc;
+            QDomElement header = readElement(m_reader, domDoc);
+            QDomNode headerNode = header.firstChild();
+            if (!m_doc->validateXMIHeader(headerNode)) {
+                return false;
+            }
+        } else if (tag == QLatin1String("XMI.extensions")) {
+            while (m_reader.readNextStartElement()) {
+                QDomDocument domDoc;
+                QDomElement extension = readElement(m_reader, domDoc);
+                m_doc->loadExtensionsFromXMI(extension);
+            }
+        } else if (UMLDoc::tagEq(tag, QLatin1String("Model")) ||
+                   UMLDoc::tagEq(tag, QLatin1String("Package"))) {
+            QXmlStreamAttributes attributes = m_reader.attributes();
+            if (!loadModel()) {
+                uWarning() << "failed load on objects";
+                return false;
+            }
+            setModelName(attributes.value(QLatin1String("name")).toString());
+        } else if (tag == QLatin1String("XMI.content")) {
+            if (!loadContent()) {
+                return false;
+            }
+        } else {
+            uDebug() << "skipping <" << tag << ">";
+            m_reader.skipCurrentElement();
+        }
+    }
+
+    if (m_reader.hasError()) {
+        uWarning() << "Cannot read content:" << m_reader.errorString()
+                   << " Line:" << m_reader.lineNumber();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Load the children of the <XMI.content> element.
+ */
+bool XMIStreamLoader::loadContent()
+{
+    bool seenUMLObjects = false;
+    while (m_reader.readNextStartElement()) {
+        const QString tag = m_reader.qualifiedName().toString();
+        if (tag == QLatin1String("umlobjects")  // for bkwd compat.
+                || UMLDoc::tagEq(tag, QLatin1String("Subsystem"))
+                || UMLDoc::tagEq(tag, QLatin1String("Project"))  // Embarcadero's Describe
+                || UMLDoc::tagEq(tag, QLatin1String("Model"))) {
+            QXmlStreamAttributes attributes = m_reader.attributes();
+            if (!loadModel()) {
+                uWarning() << "failed load on objects";
+                return false;
+            }
+            setModelName(attributes.value(QLatin1String("name")).toString());
+            seenUMLObjects = true;
+        } else {
+            QDomDocument domDoc;
+            QDomElement element = readElement(m_reader, domDoc);
+            if (!m_doc->loadContentElementFromXMI(element, seenUMLObjects)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Load the children of a <UML:Model> element.
+ * This is the streaming counterpart of UMLDoc::loadUMLObjectsFromXMI():
+ * envelopes are descended into, the predefined root folders are loaded
+ * by loadFolder() and all other elements are passed as fragments to
+ * UMLDoc::loadUMLObjectsFromXMI().
+ */
+bool XMIStreamLoader::loadModel()
+{
+    while (m_reader.readNextStartElement()) {
+        const QString tag = m_reader.qualifiedName().toString();
+        if (UMLDoc::tagEq(tag, QLatin1String("Model"))) {
+            const QString name = m_reader.attributes().value(QLatin1String("name")).toString();
+            UMLFolder *rootFolder = 0;
+            for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+                Uml::ModelType::Enum mt = Uml::ModelType::fromInt(i);
+                if (name == m_doc->rootFolder(mt)->name()) {
+                    m_doc->setCurrentRoot(mt);
+                    rootFolder = m_doc->rootFolder(mt);
+                    break;
+                }
+            }
+            if (rootFolder) {
+                loadFolder(rootFolder);
+                continue;
+            }
+        }
+        if (UMLDoc::tagEq(tag, QLatin1String("Namespace.ownedElement")) ||
+                UMLDoc::tagEq(tag, QLatin1String("Namespace.contents")) ||
+                UMLDoc::tagEq(tag, QLatin1String("Element.ownedElement")) ||  // Embarcadero's Describe
+                UMLDoc::tagEq(tag, QLatin1String("Model"))) {
+            if (!loadModel()) {
+                uWarning() << "failed load on " << tag;
+                return false;
+            }
+            continue;
+        }
+        QDomDocument domDoc;
+        QDomElement wrapper = domDoc.createElement(QLatin1String("UML:Namespace.ownedElement"));
+        domDoc.appendChild(wrapper);
+        wrapper.appendChild(readElement(m_reader, domDoc));
+        if (!m_doc->loadUMLObjectsFromXMI(wrapper)) {
+            return false;
+        }
+        processEvents();
+    }
+    return true;
+}
+
+/**
+ * Load one of the predefined root folders.
+ * The attributes of the folder are loaded first, then the contained
+ * objects and diagrams are loaded one by one.
+ *
+ * @param folder   The root folder, the reader is positioned on its element.
+ */
+bool XMIStreamLoader::loadFolder(UMLFolder *folder)
+{
+    QDomDocument domDoc;
+    QDomElement element = createElement(m_reader, domDoc);
+    bool totalSuccess = folder->loadFromXMI(element);
+    if (!loadFolderContents(folder)) {
+        totalSuccess = false;
+    }
+    return totalSuccess;
+}
+
+/**
+ * Load the children of a folder element.
+ * Each child is wrapped into an element of its own which is passed to
+ * UMLFolder::loadContentsFromXMI(). For <XMI.extension> the wrapper
+ * contains the enclosing <diagrams> element and a single <diagram>.
+ *
+ * @param folder   The folder to load the contents into.
+ */
+bool XMIStreamLoader::loadFolderContents(UMLFolder *folder)
+{
+    bool totalSuccess = true;
+    while (m_reader.readNextStartElement()) {
+        const QString tag = m_reader.qualifiedName().toString();
+        if (UMLDoc::tagEq(tag, QLatin1String("Namespace.ownedElement")) ||
+                UMLDoc::tagEq(tag, QLatin1String("Namespace.contents"))) {
+            if (!loadFolderContents(folder)) {
+                totalSuccess = false;
+            }
+            continue;
+        }
+        QDomDocument domDoc;
+        QDomElement wrapper = domDoc.createElement(QLatin1String("UML:Namespace.ownedElement"));
+        domDoc.appendChild(wrapper);
+        if (tag != QLatin1String("XMI.extension")) {
+            wrapper.appendChild(readElement(m_reader, domDoc));
+            if (!folder->loadContentsFromXMI(wrapper)) {
+                totalSuccess = false;
+            }
+            processEvents();
+            continue;
+        }
+        QDomElement extension = createElement(m_reader, domDoc);
+        wrapper.appendChild(extension);
+        while (m_reader.readNextStartElement()) {
+            if (m_reader.qualifiedName().toString() != QLatin1String("diagrams")) {
+                QDomElement child = readElement(m_reader, domDoc);
+                extension.appendChild(child);
+                if (!folder->loadContentsFromXMI(wrapper)) {
+                    totalSuccess = false;
+                }
+                extension.removeChild(child);
+                continue;
+            }
+            QDomElement diagrams = createElement(m_reader, domDoc);
+            extension.appendChild(diagrams);
+            while (m_reader.readNextStartElement()) {
+                QDomElement diagram = readElement(m_reader, domDoc);
+                diagrams.appendChild(diagram);
+                if (!folder->loadContentsFromXMI(wrapper)) {
+                    totalSuccess = false;
+                }
+                diagrams.removeChild(diagram);
+                processEvents();
+            }
+            extension.removeChild(diagrams);
+        }
+    }
+    return totalSuccess;
+}
+
+/**
+ * Set the name of the model read from the <UML:Model> tag.
+ */
+void XMIStreamLoader::setModelName(const QString &name)
+{
+    m_doc->setModelName(name.isEmpty() ? i18n("UML Model") : name);
+}
+
+/**
+ * Give UI events a chance from time to time.
+ */
+void XMIStreamLoader::processEvents()
+{
+    if (++m_count % 100 == 0) {
+        qApp->processEvents();
+    }
+}
+
+/**
+ * Create an element with the name and the attributes of the current
+ * start element of the reader. The children are not read.
+ *
+ * @param reader   The reader positioned on a start element.
+ * @param domDoc   The document owning the new element.
+ */
+QDomElement XMIStreamLoader::createElement(QXmlStreamReader &reader, QDomDocument &domDoc)
+{
+    QDomElement element = domDoc.createElement(reader.qualifiedName().toString());
+    foreach (const QXmlStreamAttribute &attribute, reader.attributes()) {
+        element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+    return element;
+}
+
+/**
+ * Read the current element of the reader including all its children
+ * into a QDomElement. This is the adapter between the stream reader and
+ * the loadFromXMI(QDomElement&) methods of the model and diagram classes.
+ * Whitespace-only text is dropped like QDomDocument::setContent() does.
+ * On return the reader is positioned on the end element.
+ *
+ * @param reader   The reader positioned on a start element.
+ * @param domDoc   The document owning the new element.
+ */
+QDomElement XMIStreamLoader::readElement(QXmlStreamReader &reader, QDomDocument &domDoc)
+{
+    QDomElement root = createElement(reader, domDoc);
+    QDomElement current = root;
+    int depth = 1;
+    while (depth > 0 && !reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QXmlStreamReader::StartElement: {
+            QDomElement element = createElement(reader, domDoc);
+            current.appendChild(element);
+            current = element;
+            ++depth;
+            break;
+        }
+        case QXmlStreamReader::EndElement:
+            if (--depth > 0) {
+                current = current.parentNode().toElement();
+            }
+            break;
+        case QXmlStreamReader::Characters:
+            if (reader.isCDATA()) {
+                current.appendChild(domDoc.createCDATASection(reader.text().toString()));
+            } else if (!reader.isWhitespace()) {
+                current.appendChild(domDoc.createTextNode(reader.text().toString()));
+            }
+            break;
+        case QXmlStreamReader::Comment:
+            current.appendChild(domDoc.createComment(reader.text().toString()));
+            break;
+        default:
+            break;
+        }
+    }
+    return root;
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef XMISTREAMLOADER_H
+#define XMISTREAMLOADER_H
+
+// qt includes
+#include <QDomDocument>
+#include <QDomElement>
+#include <QXmlStreamReader>
+
+class QIODevice;
+class UMLDoc;
+class UMLFolder;
+
+/**
+ * The XMIStreamLoader loads an XMI file into the UMLDoc without reading
+ * the whole file into memory and without building a QDomDocument of it.
+ *
+ * The file is walked with a QXmlStreamReader through the structure of the
+ * model: the <UML:Model> element, the predefined root folders, their
+ * <UML:Namespace.ownedElement> envelopes and their lists of diagrams.
+ * Each model object or diagram found there is read into a small
+ * QDomElement fragment, which is passed to the existing
+ * loadFromXMI(QDomElement&) implementations and released before the next
+ * one is read. Elements the loader does not know about, e.g. extensions
+ * of foreign tools, are handed to the DOM based code of UMLDoc the same
+ * way, so that the result is identical to the one of the DOM based loader.
+ *
+ * Only Unicode files are loaded this way, see UMLDoc::loadFromXMI().
+ */
+class XMIStreamLoader
+{
+public:
+    explicit XMIStreamLoader(UMLDoc *doc);
+
+    bool load(QIODevice &file);
+
+    static QDomElement readElement(QXmlStreamReader &reader, QDomDocument &domDoc);
+
+private:
+    bool loadContent();
+    bool loadModel();
+    bool loadFolder(UMLFolder *folder);
+    bool loadFolderContents(UMLFolder *folder);
+    void setModelName(const QString &name);
+    void processEvents();
+
+    static QDomElement createElement(QXmlStreamReader &reader, QDomDocument &domDoc);
+
+    UMLDoc *m_doc;
+    QXmlStreamReader m_reader;
+    int m_count;  ///< number of fragments loaded, used to give UI events a chance
+};
+
+#endif
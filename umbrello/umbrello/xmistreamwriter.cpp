@@ -0,0 +1,204 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+// own header
+#include "xmistreamwriter.h"
+
+// qt includes
+#include <QDomDocument>
+#include <QIODevice>
+
+/**
+ * QDomNode::save() writes the node it is called for at this depth.
+ */
+static const int SaveDepth = 1;
+
+/**
+ * Constructor.
+ *
+ * @param device   The device the XMI file is written to.
+ */
+XMIStreamWriter::XMIStreamWriter(QIODevice &device)
+  : m_stream(&device)
+{
+    m_stream.setCodec("UTF-8");
+}
+
+/**
+ * Destructor, flushes the written data to the device.
+ */
+XMIStreamWriter::~XMIStreamWriter()
+{
+    m_stream.flush();
+}
+
+/**
+ * Write the XML declaration, as created by the processing instruction
+ * UMLDoc adds to its QDomDocument.
+ */
+void XMIStreamWriter::writeStartDocument()
+{
+    m_stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+}
+
+/**
+ * Close all open elements and flush the written data to the device.
+ */
+void XMIStreamWriter::writeEndDocument()
+{
+    while (!m_openElements.isEmpty()) {
+        writeEndElement();
+    }
+    m_stream.flush();
+}
+
+/**
+ * Open an envelope element. The children the element already has are
+ * written at once; further children are added with writeElement(),
+ * writeChildren(), writeStartElement() or the streamToXMI() methods of
+ * the model objects until the element is closed by writeEndElement().
+ *
+ * @param element   The element with its attributes, the element must
+ *                  not be used after this call.
+ */
+void XMIStreamWriter::writeStartElement(QDomElement element)
+{
+    writePendingStartTag();
+    // move the children out of the way so that QDom serializes the
+    // element on a single line, as an empty element
+    QDomElement children = element.ownerDocument().createElement(QLatin1String("children"));
+    while (element.hasChildNodes()) {
+        children.appendChild(element.firstChild());
+    }
+    if (!element.parentNode().isNull()) {
+        element.parentNode().removeChild(element);
+    }
+    QString tag = toString(element, SaveDepth).trimmed();
+    const QString indent = indentation(m_openElements.count());
+    m_pendingEmptyTag = indent + tag + QLatin1Char('\n');
+    tag.chop(2);  // "/>"
+    m_pendingStartTag = indent + tag + QLatin1String(">\n");
+    m_openElements.append(element.tagName());
+    writeChildren(children);
+}
+
+/**
+ * Close the innermost element opened with writeStartElement().
+ * An element without children is written as empty element.
+ */
+void XMIStreamWriter::writeEndElement()
+{
+    if (m_openElements.isEmpty()) {
+        return;
+    }
+    const QString name = m_openElements.takeLast();
+    if (!m_pendingEmptyTag.isEmpty()) {
+        m_stream << m_pendingEmptyTag;
+        m_pendingEmptyTag.clear();
+        m_pendingStartTag.clear();
+        return;
+    }
+    m_stream << indentation(m_openElements.count()) << "</" << name << ">\n";
+}
+
+/**
+ * Write a complete element as child of the innermost open element.
+ *
+ * @param element   The element to be written. It is removed from its
+ *                  parent and must not be used after this call.
+ */
+void XMIStreamWriter::writeElement(QDomElement element)
+{
+    writePendingStartTag();
+    if (!element.parentNode().isNull()) {
+        element.parentNode().removeChild(element);
+    }
+    m_stream << toString(element, m_openElements.count());
+}
+
+/**
+ * Write all children of the given element as children of the innermost
+ * open element and remove them from @p parent. This is how the output of
+ * the saveToXMI(QDomDocument&, QDomElement&) methods is written: they
+ * append their element to a parent element, which is emptied again after
+ * each call.
+ *
+ * @param parent   The element whose children are written.
+ */
+void XMIStreamWriter::writeChildren(QDomElement parent)
+{
+    const int depth = m_openElements.count();
+    while (parent.hasChildNodes()) {
+        QDomNode node = parent.firstChild();
+        parent.removeChild(node);
+        writePendingStartTag();
+        m_stream << toString(node, depth);
+    }
+}
+
+/**
+ * Write the start tag of the innermost open element, if it is still
+ * pending, because the element gets a child.
+ */
+void XMIStreamWriter::writePendingStartTag()
+{
+    if (m_pendingStartTag.isEmpty()) {
+        return;
+    }
+    m_stream << m_pendingStartTag;
+    m_pendingStartTag.clear();
+    m_pendingEmptyTag.clear();
+}
+
+/**
+ * Return the indentation QDomDocument::toString() uses for the given depth.
+ */
+QString XMIStreamWriter::indentation(int depth) const
+{
+    return QString(depth, QLatin1Char(' '));
+}
+
+/**
+ * Serialize a node the way QDomDocument::toString() does when the node
+ * is found at the given depth of the document. QDom indents each line by
+ * the depth of the node, therefore the node is nested into wrapper
+ * elements up to the requested depth, and the lines of the wrappers are
+ * stripped from the result.
+ *
+ * @param node    A node without parent.
+ * @param depth   The depth of the node in the complete document.
+ * @return        The serialized node.
+ */
+QString XMIStreamWriter::toString(QDomNode node, int depth)
+{
+    QDomDocument doc = node.ownerDocument();
+    QDomNode outer = node;
+    for (int i = SaveDepth; i < depth; ++i) {
+        QDomElement wrapper = doc.createElement(QLatin1String("wrapper"));
+        wrapper.appendChild(outer);
+        outer = wrapper;
+    }
+
+    QString text;
+    QTextStream stream(&text, QIODevice::WriteOnly);
+    // QDomDocument::toString() uses the encoding of the XML declaration,
+    // with it no characters are written as character references
+    stream.setCodec("UTF-8");
+    outer.save(stream, 1);
+    stream.flush();
+
+    int begin = 0;
+    int end = text.length();
+    for (int i = SaveDepth; i < depth; ++i) {
+        begin = text.indexOf(QLatin1Char('\n'), begin) + 1;
+        end = text.lastIndexOf(QLatin1Char('\n'), end - 2) + 1;
+    }
+    return text.mid(begin, end - begin);
+}
@@ -0,0 +1,68 @@
+/***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   copyright (C) 2016                                                    *
+ *   Umbrello UML Modeller Authors <umbrello-devel@kde.org>                *
+ ***************************************************************************/
+
+#ifndef XMISTREAMWRITER_H
+#define XMISTREAMWRITER_H
+
+// qt includes
+#include <QDomElement>
+#include <QStringList>
+#include <QTextStream>
+
+class QIODevice;
+
+/**
+ * The XMIStreamWriter saves an XMI file without building a QDomDocument
+ * of the whole model.
+ *
+ * The envelopes of the file, i.e. the <XMI> element, the <UML:Model>
+ * element, the folders and their <UML:Namespace.ownedElement> and
+ * <diagrams> elements, are opened with writeStartElement() and closed
+ * with writeEndElement(). Their start tags are written to the device as
+ * soon as the first child is known. The model objects and diagrams
+ * inside the envelopes are still created by the existing
+ * saveToXMI(QDomDocument&, QDomElement&) implementations, but only one
+ * of them at a time: each fragment is passed to writeElement() or
+ * writeChildren(), written out and released before the next one is
+ * created.
+ *
+ * All elements are serialized by QDom itself at the depth they have in
+ * the complete document, so that the written file is byte identical to
+ * the one created by QDomDocument::toString(), including the order of
+ * the attributes.
+ */
+class XMIStreamWriter
+{
+public:
+    explicit XMIStreamWriter(QIODevice &device);
+    ~XMIStreamWriter();
+
+    void writeStartDocument();
+    void writeEndDocument();
+
+    void writeStartElement(QDomElement element);
+    void writeEndElement();
+
+    void writeElement(QDomElement element);
+    void writeChildren(QDomElement parent);
+
+private:
+    void writePendingStartTag();
+    QString indentation(int depth) const;
+
+    static QString toString(QDomNode node, int depth);
+
+    QTextStream m_stream;
+    QStringList m_openElements;  ///< tag names of the open envelopes
+    QString m_pendingStartTag;   ///< start tag of the innermost envelope if it has no children yet
+    QString m_pendingEmptyTag;   ///< the same element written as empty element
+};
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_associationwidget.h"
+
+// app includes
+#include "associationline.h"
+#include "associationwidget.h"
+#include "boxwidget.h"
+#include "folder.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "uniqueid.h"
+
+// qt includes
+#include <QSet>
+
+// number of associations of the benchmark diagram
+const int ASSOCIATIONS = 500;
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Create a class diagram with a hub widget connected to @p count widgets
+ * which are stacked on its right side.
+ * @return the hub widget
+ */
+UMLWidget *TEST_AssociationWidget::createStar(int count)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("star"));
+    UMLScene *scene = view->umlScene();
+    BoxWidget *hub = new BoxWidget(scene, UniqueID::gen());
+    hub->setSize(100, count * 50);
+    scene->widgetList().append(hub);
+    for (int i = 0; i < count; ++i) {
+        BoxWidget *leaf = new BoxWidget(scene, UniqueID::gen());
+        leaf->setSize(40, 40);
+        leaf->setX(1000);
+        leaf->setY(i * 50);
+        scene->widgetList().append(leaf);
+        AssociationWidget *a = AssociationWidget::create(scene, hub, Uml::AssociationType::Dependency, leaf);
+        scene->associationList().append(a);
+    }
+    return hub;
+}
+
+void TEST_AssociationWidget::test_regionOrder()
+{
+    const int count = 150;
+    UMLWidget *hub = createStar(count);
+    hub->adjustAssocs(0, 0);
+    QCOMPARE(hub->associationWidgetList().count(), count);
+
+    // each association ends at its own point of the hub
+    QSet<QPair<qreal, qreal> > ends;
+    foreach(AssociationWidget *a, hub->associationWidgetList()) {
+        const QPointF p = a->associationLine()->point(0);
+        ends.insert(qMakePair(p.x(), p.y()));
+    }
+    QCOMPARE(ends.count(), count);
+}
+
+void TEST_AssociationWidget::benchmark_moveHub()
+{
+    UMLWidget *hub = createStar(ASSOCIATIONS);
+    QBENCHMARK {
+        hub->setX(hub->x() + 1);
+        hub->adjustAssocs(1, 0);
+    }
+}
+
+QTEST_MAIN(TEST_AssociationWidget)
@@ -21,10 +21,29 @@
 #include "TEST_classifier.h"
 
 // app include
+#include "association.h"
+#include "attribute.h"
 #include "uml.h"
 #include "classifier.h"
+#include "operation.h"
+#include "uniqueid.h"
 
 const bool IS_NOT_IMPL = false;
+
+// depth of the class hierarchy and operations per class of the benchmark
+const int DEPTH = 20;
+const int OPERATIONS = 200;
+
+/**
+ * Make a generalization from child to parent.
+ */
+static UMLAssociation *generalize(UMLClassifier *child, UMLClassifier *parent)
+{
+    UMLAssociation *a = new UMLAssociation(Uml::AssociationType::Generalization, child, parent);
+    child->addAssociationEnd(a);
+    parent->addAssociationEnd(a);
+    return a;
+}
 //-----------------------------------------------------------------------------
 
 void TEST_classifier::test_equal()
@@ -99,7 +118,19 @@ void TEST_classifier::test_removeAndCountAttribute()
 
 void TEST_classifier::test_getAttributeList()
 {
-    QCOMPARE(IS_NOT_IMPL, true);
+    UMLClassifier* a = new UMLClassifier("Test A", Uml::ID::None);
+    UMLAttribute* attrA = a->addAttribute("attributeA_", Uml::ID::None);
+    a->createOperation("operationA_");
+    QCOMPARE(a->getAttributeList().count(), 1);
+    UMLAttribute* attrB = a->addAttribute("attributeB_", Uml::ID::None);
+    UMLAttributeList list = a->getAttributeList();
+    QCOMPARE(list.count(), 2);
+    QCOMPARE(list.at(0), attrA);
+    QCOMPARE(list.at(1), attrB);
+    a->removeAttribute(attrA);
+    list = a->getAttributeList();
+    QCOMPARE(list.count(), 1);
+    QCOMPARE(list.at(0), attrB);
 }
 
 void TEST_classifier::test_addOperationWithPosition()
@@ -124,7 +155,20 @@ void TEST_classifier::test_removeAndCountOperation()
 
 void TEST_classifier::test_getOperationList()
 {
-    QCOMPARE(IS_NOT_IMPL, true);
+    UMLClassifier* a = new UMLClassifier("Test A", Uml::ID::None);
+    QCOMPARE(a->getOpList().count(), 0);
+    UMLOperation* opA = a->createOperation("operationA_");
+    a->addAttribute("attributeA_", Uml::ID::None);
+    QCOMPARE(a->getOpList().count(), 1);
+    UMLOperation* opB = a->createOperation("operationB_");
+    UMLOperationList list = a->getOpList();
+    QCOMPARE(list.count(), 2);
+    QCOMPARE(list.at(0), opA);
+    QCOMPARE(list.at(1), opB);
+    a->removeOperation(opA);
+    list = a->getOpList();
+    QCOMPARE(list.count(), 1);
+    QCOMPARE(list.at(0), opB);
 }
 
 void TEST_classifier::test_addTemplateWithType()
@@ -164,7 +208,16 @@ void TEST_classifier::test_takeItem()
 
 void TEST_classifier::test_getFilteredList()
 {
-    QCOMPARE(IS_NOT_IMPL, true);
+    UMLClassifier* a = new UMLClassifier("Test A", Uml::ID::None);
+    a->addAttribute("attributeA_", Uml::ID::None);
+    a->createOperation("operationA_");
+    QCOMPARE(a->getFilteredList(UMLObject::ot_Attribute).count(), 1);
+    QCOMPARE(a->getFilteredList(UMLObject::ot_Operation).count(), 1);
+    QCOMPARE(a->getFilteredList(UMLObject::ot_Template).count(), 0);
+    QCOMPARE(a->getFilteredList(UMLObject::ot_UMLObject).count(), 2);
+    a->addTemplate("T", Uml::ID::None);
+    QCOMPARE(a->getFilteredList(UMLObject::ot_Template).count(), 1);
+    QCOMPARE(a->getFilteredList(UMLObject::ot_UMLObject).count(), 3);
 }
 
 void TEST_classifier::test_resolveRef()
@@ -242,4 +295,120 @@ void TEST_classifier::test_getUniAssociationToBeImplemented()
     QCOMPARE(IS_NOT_IMPL, true);
 }
 
+void TEST_classifier::test_getInheritedOperationList()
+{
+    UMLClassifier* base = new UMLClassifier("Base", UniqueID::gen());
+    UMLClassifier* middle = new UMLClassifier("Middle", UniqueID::gen());
+    UMLClassifier* derived = new UMLClassifier("Derived", UniqueID::gen());
+    UMLAssociation* middleToBase = generalize(middle, base);
+    generalize(derived, middle);
+
+    UMLOperation* baseOp = base->createOperation("print");
+    base->createOperation("clear");
+    UMLOperation* middleOp = middle->createOperation("print");
+    QCOMPARE(derived->getOpList(true).count(), 2);
+    // overridden operations are listed once, the one nearest to the class wins
+    QCOMPARE(derived->getOpList(true).contains(middleOp), true);
+    QCOMPARE(derived->getOpList(true).contains(baseOp), false);
+    QCOMPARE(derived->getOpList(false).count(), 0);
+
+    // adding an operation to an ancestor
+    base->createOperation("reset");
+    QCOMPARE(derived->getOpList(true).count(), 3);
+
+    // changing the signature of an operation of an ancestor
+    middleOp->setNameCmd("display");
+    QCOMPARE(derived->getOpList(true).count(), 4);
+    QCOMPARE(derived->getOpList(true).contains(baseOp), true);
+
+    // removing an operation of an ancestor
+    middle->removeOperation(middleOp);
+    QCOMPARE(derived->getOpList(true).count(), 3);
+
+    // removing a generalization
+    middle->removeAssociationEnd(middleToBase);
+    base->removeAssociationEnd(middleToBase);
+    QCOMPARE(derived->getOpList(true).count(), 0);
+    QCOMPARE(base->getOpList(true).count(), 3);
+}
+
+/**
+ * Add a parameter to an operation.
+ */
+static void addParameter(UMLOperation *op, const QString &name, UMLObject *type)
+{
+    op->addParm(new UMLAttribute(op, name, UniqueID::gen(), Uml::Visibility::Private, type));
+}
+
+void TEST_classifier::test_getInheritedOverloads()
+{
+    UMLClassifier* base = new UMLClassifier("Base", UniqueID::gen());
+    UMLClassifier* derived = new UMLClassifier("Derived", UniqueID::gen());
+    generalize(derived, base);
+    UMLClassifier* type1 = new UMLClassifier("Type", UniqueID::gen());
+    UMLClassifier* type2 = new UMLClassifier("Type", UniqueID::gen());
+
+    // parameter types are compared by identity, not by name
+    UMLOperation* baseOp = base->createOperation("put");
+    addParameter(baseOp, "value", type1);
+    UMLOperation* derivedOp = derived->createOperation("put");
+    addParameter(derivedOp, "value", type2);
+    QCOMPARE(derived->getOpList(true).count(), 2);
+    derivedOp->getParmList().first()->setType(type1);
+    QCOMPARE(derived->getOpList(true).count(), 1);
+    QCOMPARE(derived->getOpList(true).contains(derivedOp), true);
+
+    // unresolved types are the same type
+    UMLOperation* baseGet = base->createOperation("get");
+    addParameter(baseGet, "key", 0);
+    baseGet->getParmList().first()->setSecondaryId("Key");
+    UMLOperation* derivedGet = derived->createOperation("get");
+    addParameter(derivedGet, "key", 0);
+    derivedGet->getParmList().first()->setSecondaryId("OtherKey");
+    QCOMPARE(derived->getOpList(true).count(), 2);
+    QCOMPARE(derived->getOpList(true).contains(baseGet), false);
+}
+
+void TEST_classifier::benchmark_getInheritedOperationList_data()
+{
+    QTest::addColumn<bool>("modified");
+
+    QTest::newRow("unchanged") << false;
+    QTest::newRow("base modified") << true;
+}
+
+/**
+ * Query the operations of the most derived class of a class hierarchy.
+ * If the base class is modified before every query the list is rebuilt.
+ */
+void TEST_classifier::benchmark_getInheritedOperationList()
+{
+    QFETCH(bool, modified);
+
+    QList<UMLClassifier*> classes;
+    for (int i = 0; i < DEPTH; ++i) {
+        UMLClassifier* c = new UMLClassifier(QString(QLatin1String("Class%1")).arg(i), UniqueID::gen());
+        for (int j = 0; j < OPERATIONS; ++j) {
+            // every tenth operation overrides the one of the base class
+            int n = j % 10 == 0 ? j : i * OPERATIONS + j;
+            c->createOperation(QString(QLatin1String("operation%1")).arg(n));
+        }
+        if (i > 0)
+            generalize(c, classes.last());
+        classes.append(c);
+    }
+    UMLClassifier* base = classes.first();
+    UMLClassifier* derived = classes.last();
+    const int expected = DEPTH * OPERATIONS - (DEPTH - 1) * OPERATIONS / 10;
+    QCOMPARE(derived->getOpList(true).count(), expected);
+
+    int count = 0;
+    QBENCHMARK {
+        if (modified)
+            base->emitModified();
+        count = derived->getOpList(true).count();
+    }
+    QCOMPARE(count, expected);
+}
+
 QTEST_MAIN(TEST_classifier)
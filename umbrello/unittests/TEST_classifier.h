@@ -66,6 +66,10 @@ private slots:
     void test_hasAbstractOps();
     void test_makeChildObject();
     void test_getUniAssociationToBeImplemented();
+    void test_getInheritedOperationList();
+    void test_getInheritedOverloads();
+    void benchmark_getInheritedOperationList_data();
+    void benchmark_getInheritedOperationList();
 };
 
 #endif // TEST_CLASSIFIER_H
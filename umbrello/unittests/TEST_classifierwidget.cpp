@@ -0,0 +1,101 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_classifierwidget.h"
+
+// app includes
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "folder.h"
+#include "object_factory.h"
+#include "operation.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QImage>
+#include <QPainter>
+
+// number of attributes and operations of the benchmark class
+const int MEMBERS = 200;
+
+//-----------------------------------------------------------------------------
+
+static UMLScene *createScene()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("classes"));
+    return view->umlScene();
+}
+
+void TEST_ClassifierWidget::test_memberTexts()
+{
+    UMLScene *scene = createScene();
+    UMLClassifier *c = static_cast<UMLClassifier*>(
+        Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("A"), 0, false));
+    UMLClassifier *type = static_cast<UMLClassifier*>(
+        Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("B"), 0, false));
+    ClassifierWidget *w = new ClassifierWidget(scene, c);
+    w->setVisualProperty(ClassifierWidget::ShowAttributes, true);
+    const QSizeF empty = w->calculateSize();
+
+    // adding a member is noticed
+    c->addAttribute(QLatin1String("a"), type, Uml::Visibility::Public);
+    QCOMPARE(w->displayedAttributes(), 1);
+    const QSizeF withAttribute = w->calculateSize();
+    QVERIFY(withAttribute.height() > empty.height());
+
+    // renaming the type of the member is noticed
+    type->setName(QLatin1String("AVeryLongNameOfTheTypeOfTheAttribute"));
+    QVERIFY(w->calculateSize().width() > withAttribute.width());
+
+    // hiding non public members is noticed
+    c->addAttribute(QLatin1String("b"), type, Uml::Visibility::Private);
+    QCOMPARE(w->displayedAttributes(), 2);
+    w->setVisualProperty(ClassifierWidget::ShowPublicOnly, true);
+    QCOMPARE(w->displayedAttributes(), 1);
+}
+
+void TEST_ClassifierWidget::benchmark_paint()
+{
+    UMLScene *scene = createScene();
+    UMLClassifier *c = static_cast<UMLClassifier*>(
+        Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("Large"), 0, false));
+    for (int i = 0; i < MEMBERS; ++i) {
+        c->addAttribute(QString(QLatin1String("attribute%1")).arg(i), c, Uml::Visibility::Public);
+        c->addOperation(Object_Factory::createOperation(c, QString(QLatin1String("operation%1")).arg(i)));
+    }
+    ClassifierWidget *w = new ClassifierWidget(scene, c);
+    w->setVisualProperty(ClassifierWidget::ShowAttributes, true);
+    w->setVisualProperty(ClassifierWidget::ShowOperations, true);
+    w->setSize(w->calculateSize());
+
+    QImage image(w->width() + 1, w->height() + 1, QImage::Format_ARGB32);
+    QPainter painter(&image);
+    QBENCHMARK {
+        w->paint(&painter, 0);
+    }
+}
+
+QTEST_MAIN(TEST_ClassifierWidget)
@@ -0,0 +1,241 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_codeemitter.h"
+
+// app includes
+#include "classifier.h"
+#include "codedocument.h"
+#include "codeemitter.h"
+#include "codegenerationpolicy.h"
+#include "codegenerator.h"
+#include "object_factory.h"
+#include "optionstate.h"
+#include "textblock.h"
+#include "uml.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QTextCodec>
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Create a model of classes with documentation, attributes and operations.
+ */
+void TEST_codeemitter::createModel(int count)
+{
+    UMLApp::app()->document()->newDocument();
+    for (int i = 0; i < count; ++i) {
+        UMLClassifier *c = static_cast<UMLClassifier*>(
+            Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                            QString(QLatin1String("Class%1")).arg(i), 0, false));
+        c->setDoc(QLatin1String("The class documentation,\nwhich has\nthree lines."));
+        for (int j = 0; j < 5; ++j) {
+            c->addAttribute(QString(QLatin1String("attribute%1")).arg(j))
+                ->setDoc(QLatin1String("An attribute."));
+            c->createOperation(QString(QLatin1String("operation%1")).arg(j))
+                ->setDoc(QLatin1String("An operation\nwith two lines of documentation."));
+        }
+    }
+}
+
+void TEST_codeemitter::test_writeLines_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<QString>("prefix");
+    QTest::addColumn<bool>("addBreak");
+    QTest::addColumn<bool>("lastLineHasBreak");
+    QTest::addColumn<QString>("expected");
+
+    const QString prefix = QLatin1String("// ");
+    QTest::newRow("single line") << QString(QLatin1String("a")) << prefix << true << true
+                                 << QString(QLatin1String("// a\n"));
+    QTest::newRow("single line without break") << QString(QLatin1String("a")) << prefix << false << true
+                                               << QString(QLatin1String("// a"));
+    QTest::newRow("empty") << QString() << prefix << true << true
+                           << QString(QLatin1String("// \n"));
+    QTest::newRow("lines") << QString(QLatin1String("a\nb")) << prefix << true << true
+                           << QString(QLatin1String("// a\n// b\n"));
+    QTest::newRow("trailing break") << QString(QLatin1String("a\nb\n")) << prefix << true << true
+                                    << QString(QLatin1String("// a\n// b\n"));
+    QTest::newRow("empty line") << QString(QLatin1String("a\n\nb")) << prefix << true << true
+                                << QString(QLatin1String("// a\n// \n// b\n"));
+    QTest::newRow("last line without break") << QString(QLatin1String("a\nb")) << QString() << true << false
+                                             << QString(QLatin1String("a\nb"));
+}
+
+void TEST_codeemitter::test_writeLines()
+{
+    QFETCH(QString, text);
+    QFETCH(QString, prefix);
+    QFETCH(bool, addBreak);
+    QFETCH(bool, lastLineHasBreak);
+    QFETCH(QString, expected);
+
+    UMLApp::app()->commonPolicy()->setLineEndingType(CodeGenerationPolicy::UNIX);
+    StringCodeEmitter emitter;
+    emitter.writeLines(text, 0, prefix, addBreak, lastLineHasBreak);
+    QCOMPARE(emitter.text(), expected);
+    QCOMPARE(TextBlock::formatMultiLineText(text, prefix, QLatin1String("\n"), addBreak, lastLineHasBreak), expected);
+}
+
+void TEST_codeemitter::test_indentation()
+{
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    policy->setLineEndingType(CodeGenerationPolicy::DOS);
+    policy->setIndentationType(CodeGenerationPolicy::SPACE);
+    policy->setIndentationAmount(2);
+
+    StringCodeEmitter emitter;
+    QCOMPARE(emitter.endLine(), QString(QLatin1String("\r\n")));
+    QCOMPARE(emitter.indentation(0), QString());
+    QCOMPARE(emitter.indentation(3), QString(QLatin1String("      ")));
+    QCOMPARE(emitter.indentation(1), QString(QLatin1String("  ")));
+    emitter.writeLines(QLatin1String("a\r\nb"), 2, QLatin1String("* "));
+    emitter.writeLine(1, QLatin1String("}"));
+    QCOMPARE(emitter.text(), QString(QLatin1String("    * a\r\n    * b\r\n  }\r\n")));
+
+    policy->setLineEndingType(CodeGenerationPolicy::UNIX);
+}
+
+void TEST_codeemitter::test_sinks()
+{
+    UMLApp::app()->commonPolicy()->setLineEndingType(CodeGenerationPolicy::UNIX);
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    // small buffers, so that the text is passed on in several parts
+    DeviceCodeEmitter device(&buffer, 16);
+    HashCodeEmitter hash(16);
+    StringCodeEmitter string;
+    for (int i = 0; i < 100; ++i) {
+        const QString line = QString(QLatin1String("line %1\ncontinued")).arg(i);
+        device.writeLines(line, i % 4);
+        hash.writeLines(line, i % 4);
+        string.writeLines(line, i % 4);
+    }
+    device.flush();
+    const QByteArray data = QTextCodec::codecForLocale()->fromUnicode(string.text());
+    QVERIFY(device.success());
+    QCOMPARE(buffer.data(), data);
+    QCOMPARE(hash.result(), QCryptographicHash::hash(data, QCryptographicHash::Sha1));
+}
+
+void TEST_codeemitter::test_document()
+{
+    Settings::optionState().generalState.newcodegen = true;
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+    createModel(5);
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    policy->setOverwritePolicy(CodeGenerationPolicy::Ok);
+    policy->setParallelGeneration(false);
+    const QString path = temporaryPath() + QLatin1String("emitter");
+    policy->setOutputDirectory(QDir(path));
+    generator->writeCodeToFile();
+
+    // the written files have the content of the code documents
+    QList<QByteArray> expected;
+    foreach(CodeDocument *doc, *generator->getCodeDocumentList()) {
+        if (!doc->getWriteOutCode())
+            continue;
+        const QByteArray data = QTextCodec::codecForLocale()->fromUnicode(doc->toString() + QLatin1Char('\n'));
+        expected.append(data);
+
+        HashCodeEmitter hash;
+        doc->write(hash);
+        hash.write(QLatin1Char('\n'));
+        QCOMPARE(hash.result(), QCryptographicHash::hash(data, QCryptographicHash::Sha1));
+    }
+    QList<QByteArray> written;
+    QDir dir(path);
+    foreach(const QString &name, dir.entryList(QDir::Files)) {
+        QFile file(dir.absoluteFilePath(name));
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        written.append(file.readAll());
+    }
+    qSort(expected);
+    qSort(written);
+    QCOMPARE(written, expected);
+
+    Settings::optionState().generalState.newcodegen = false;
+}
+
+void TEST_codeemitter::benchmark_generation_data()
+{
+    QTest::addColumn<QString>("sink");
+    QTest::addColumn<int>("count");
+    QTest::newRow("string 200") << QString(QLatin1String("string")) << 200;
+    QTest::newRow("hash 200") << QString(QLatin1String("hash")) << 200;
+    QTest::newRow("file 200") << QString(QLatin1String("file")) << 200;
+    QTest::newRow("string 1000") << QString(QLatin1String("string")) << 1000;
+    QTest::newRow("hash 1000") << QString(QLatin1String("hash")) << 1000;
+    QTest::newRow("file 1000") << QString(QLatin1String("file")) << 1000;
+}
+
+/**
+ * Measure the throughput of emitting the code of a large model into
+ * the different sinks.
+ */
+void TEST_codeemitter::benchmark_generation()
+{
+    QFETCH(QString, sink);
+    QFETCH(int, count);
+    Settings::optionState().generalState.newcodegen = true;
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+    createModel(count);
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    policy->setOverwritePolicy(CodeGenerationPolicy::Ok);
+    policy->setParallelGeneration(false);
+    policy->setOutputDirectory(QDir(temporaryPath() + QLatin1String("benchmark")));
+    CodeDocumentList *docs = generator->getCodeDocumentList();
+
+    qint64 size = 0;
+    QBENCHMARK {
+        if (sink == QLatin1String("file")) {
+            generator->writeCodeToFile();
+        } else if (sink == QLatin1String("hash")) {
+            foreach(CodeDocument *doc, *docs) {
+                HashCodeEmitter emitter;
+                doc->write(emitter);
+                size += emitter.result().size();
+            }
+        } else {
+            foreach(CodeDocument *doc, *docs) {
+                StringCodeEmitter emitter;
+                doc->write(emitter);
+                size += emitter.text().size();
+            }
+        }
+    }
+    if (sink != QLatin1String("file"))
+        QVERIFY(size > 0);
+
+    Settings::optionState().generalState.newcodegen = false;
+}
+
+QTEST_MAIN(TEST_codeemitter)
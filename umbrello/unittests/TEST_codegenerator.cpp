@@ -0,0 +1,152 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_codegenerator.h"
+
+// app includes
+#include "classifier.h"
+#include "codegenerationpolicy.h"
+#include "codegenerationrecord.h"
+#include "codegenerator.h"
+#include "object_factory.h"
+#include "optionstate.h"
+#include "uml.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QDateTime>
+#include <QDir>
+#include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QSignalSpy>
+
+// number of classes the code is generated for
+const int CLASSES = 40;
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Return the contents of the files in the given directory by file name.
+ */
+QMap<QString, QByteArray> TEST_codegenerator::readFiles(const QString &path)
+{
+    QMap<QString, QByteArray> files;
+    QDir dir(path);
+    foreach(const QString &name, dir.entryList(QDir::Files)) {
+        QFile file(dir.absoluteFilePath(name));
+        if (file.open(QIODevice::ReadOnly))
+            files.insert(name, file.readAll());
+    }
+    return files;
+}
+
+void TEST_codegenerator::test_writeCodeToFileInParallel()
+{
+    Settings::optionState().generalState.newcodegen = true;
+    UMLApp::app()->document()->newDocument();
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+    for (int i = 0; i < CLASSES; ++i) {
+        Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                        QString(QLatin1String("Class%1")).arg(i), 0, false);
+    }
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    policy->setOverwritePolicy(CodeGenerationPolicy::Ok);
+
+    const QString serialPath = temporaryPath() + QLatin1String("serial");
+    policy->setParallelGeneration(false);
+    policy->setOutputDirectory(QDir(serialPath));
+    generator->writeCodeToFile();
+
+    const QString parallelPath = temporaryPath() + QLatin1String("parallel");
+    policy->setParallelGeneration(true);
+    policy->setOutputDirectory(QDir(parallelPath));
+    QSignalSpy generated(generator, SIGNAL(showGeneratedFile(QString)));
+    generator->writeCodeToFile();
+    QCOMPARE(generated.count(), CLASSES);
+
+    QMap<QString, QByteArray> serial = readFiles(serialPath);
+    QCOMPARE(serial.size(), CLASSES);
+    QCOMPARE(readFiles(parallelPath), serial);
+
+    // files whose content did not change are not written again
+    const QString fileName = parallelPath + QLatin1String("/") + serial.firstKey();
+    const QDateTime modified = QFileInfo(fileName).lastModified();
+    QTest::qSleep(1100);
+    generator->writeCodeToFile();
+    QCOMPARE(QFileInfo(fileName).lastModified(), modified);
+    QCOMPARE(readFiles(parallelPath), serial);
+
+    policy->setParallelGeneration(false);
+    Settings::optionState().generalState.newcodegen = false;
+}
+
+void TEST_codegenerator::test_incrementalGeneration()
+{
+    Settings::optionState().generalState.newcodegen = true;
+    UMLApp::app()->document()->newDocument();
+    UMLApp::app()->setActiveLanguage(Uml::ProgrammingLanguage::Java);
+    UMLClassifier *changed = 0;
+    for (int i = 0; i < CLASSES; ++i) {
+        UMLObject *o = Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                                       QString(QLatin1String("Class%1")).arg(i), 0, false);
+        if (i == 0)
+            changed = static_cast<UMLClassifier*>(o);
+    }
+    QVERIFY(changed);
+    CodeGenerator *generator = UMLApp::app()->generator();
+    QVERIFY(generator);
+    CodeGenerationPolicy *policy = UMLApp::app()->commonPolicy();
+    policy->setOverwritePolicy(CodeGenerationPolicy::Ok);
+    policy->setIncrementalGeneration(true);
+    policy->setOutputDirectory(QDir(temporaryPath() + QLatin1String("incremental")));
+
+    QSignalSpy generated(generator, SIGNAL(showGeneratedFile(QString)));
+    generator->writeCodeToFile();
+    QCOMPARE(generated.count(), CLASSES);
+
+    // nothing changed, nothing is written
+    generated.clear();
+    generator->writeCodeToFile();
+    QCOMPARE(generated.count(), 0);
+
+    // only the changed class is written again
+    changed->addAttribute(QLatin1String("attribute"));
+    generator->writeCodeToFile();
+    QCOMPARE(generated.count(), 1);
+
+    // the record survives saving and loading
+    QDomDocument doc;
+    QDomElement root = doc.createElement(QLatin1String("codegenerator"));
+    generator->generationRecord()->saveToXMI(doc, root);
+    QDomElement element = root.firstChildElement();
+    generator->generationRecord()->clear();
+    generator->generationRecord()->loadFromXMI(element);
+    generated.clear();
+    generator->writeCodeToFile();
+    QCOMPARE(generated.count(), 0);
+
+    policy->setIncrementalGeneration(false);
+    Settings::optionState().generalState.newcodegen = false;
+}
+
+QTEST_MAIN(TEST_codegenerator)
@@ -0,0 +1,228 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_cppimport.h"
+
+// app includes
+#include "attribute.h"
+#include "classifier.h"
+#include "cppimport.h"
+#include "driver.h"
+#include "folder.h"
+#include "operation.h"
+#include "optionstate.h"
+#include "parsecache.h"
+#include "uml.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+// number of source files of the synthetic project
+const int SOURCES = 24;
+
+// number of headers and classes per header parsed by benchmark_parse
+const int BENCHMARK_HEADERS = 200;
+const int BENCHMARK_CLASSES = 25;
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Write a project of headers including each other to the temporary
+ * directory and return the names of the files.
+ */
+QStringList TEST_cppimport::writeSources()
+{
+    QStringList fileNames;
+    for (int i = 0; i < SOURCES; ++i) {
+        QString fileName = temporaryPath() + QString(QLatin1String("class%1.h")).arg(i);
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly))
+            return QStringList();
+        QTextStream out(&file);
+        out << "#ifndef CLASS" << i << "_H\n"
+            << "#define CLASS" << i << "_H\n";
+        if (i > 0)
+            out << "#include \"class" << i - 1 << ".h\"\n";
+        out << "namespace ns" << i % 3 << " {\n"
+            << "class Class" << i;
+        if (i > 0)
+            out << " : public ns" << (i - 1) % 3 << "::Class" << i - 1;
+        out << " {\n"
+            << "public:\n"
+            << "    int operation" << i << "(int a, const char *b);\n"
+            << "private:\n"
+            << "    double m_attribute" << i << ";\n"
+            << "};\n"
+            << "}\n"
+            << "#endif\n";
+        fileNames.append(fileName);
+    }
+    return fileNames;
+}
+
+/**
+ * Import the files into a new document and return the sorted names of
+ * the created classes, operations and attributes.
+ */
+QStringList TEST_cppimport::importedModel(bool parallel, const QStringList &fileNames)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    Settings::optionState().codeImportState.parallelImport = parallel;
+    CppImport importer;
+    importer.importFiles(fileNames);
+    Settings::optionState().codeImportState.parallelImport = false;
+
+    QStringList model;
+    UMLObjectList objects = doc->rootFolder(Uml::ModelType::Logical)->containedObjects();
+    while (!objects.isEmpty()) {
+        UMLObject *obj = objects.takeFirst();
+        model.append(obj->fullyQualifiedName());
+        UMLPackage *pkg = dynamic_cast<UMLPackage*>(obj);
+        if (pkg)
+            objects.append(pkg->containedObjects());
+        UMLClassifier *c = dynamic_cast<UMLClassifier*>(obj);
+        if (c) {
+            foreach(UMLOperation *op, c->getOpList())
+                model.append(op->fullyQualifiedName());
+            foreach(UMLAttribute *attr, c->getAttributeList())
+                model.append(attr->fullyQualifiedName());
+        }
+    }
+    model.sort();
+    return model;
+}
+
+void TEST_cppimport::test_importFilesInParallel()
+{
+    QStringList fileNames = writeSources();
+    QCOMPARE(fileNames.size(), SOURCES);
+
+    QStringList serial = importedModel(false, fileNames);
+    QVERIFY(serial.contains(QLatin1String("ns0::Class0")));
+    QVERIFY(serial.contains(QLatin1String("ns2::Class23")));
+    QStringList parallel = importedModel(true, fileNames);
+    QCOMPARE(parallel, serial);
+}
+
+void TEST_cppimport::test_parseCache()
+{
+    const QString includePath = temporaryPath() + QLatin1String("include");
+    QVERIFY(QDir().mkpath(includePath));
+    QFile header(includePath + QLatin1String("/global.h"));
+    QVERIFY(header.open(QIODevice::WriteOnly));
+    header.write("#define GLOBAL_VALUE 42\n"
+                 "class Global { int m_value; };\n");
+    header.close();
+    const QString fileName = temporaryPath() + QLatin1String("user.h");
+    QFile source(fileName);
+    QVERIFY(source.open(QIODevice::WriteOnly));
+    source.write("#include <global.h>\n"
+                 "class User : public Global { };\n");
+    source.close();
+
+    ParseCache cache(temporaryPath() + QLatin1String("parsecache"));
+    cache.clear();
+
+    // the first driver lexes the global header and stores it
+    Driver driver1;
+    driver1.setResolveDependencesEnabled(true);
+    driver1.addIncludePath(includePath);
+    driver1.setParseCache(&cache);
+    QVERIFY(driver1.parseFile(fileName));
+    QCOMPARE(driver1.parseCacheHits(), 0);
+    QCOMPARE(driver1.parseCacheMisses(), 1);
+    QVERIFY(driver1.hasMacro(HashedString(QLatin1String("GLOBAL_VALUE"))));
+
+    // a new driver takes it from the cache, with the macros it defines
+    Driver driver2;
+    driver2.setResolveDependencesEnabled(true);
+    driver2.addIncludePath(includePath);
+    driver2.setParseCache(&cache);
+    QVERIFY(driver2.parseFile(fileName));
+    QCOMPARE(driver2.parseCacheHits(), 1);
+    QCOMPARE(driver2.parseCacheMisses(), 0);
+    QVERIFY(driver2.hasMacro(HashedString(QLatin1String("GLOBAL_VALUE"))));
+    QVERIFY(driver2.translationUnit(fileName));
+
+    // a changed header is lexed again
+    QVERIFY(header.open(QIODevice::WriteOnly | QIODevice::Append));
+    header.write("#define OTHER_VALUE 43\n");
+    header.close();
+    Driver driver3;
+    driver3.setResolveDependencesEnabled(true);
+    driver3.addIncludePath(includePath);
+    driver3.setParseCache(&cache);
+    QVERIFY(driver3.parseFile(fileName));
+    QCOMPARE(driver3.parseCacheHits(), 0);
+    QCOMPARE(driver3.parseCacheMisses(), 1);
+    QVERIFY(driver3.hasMacro(HashedString(QLatin1String("OTHER_VALUE"))));
+}
+
+/**
+ * Lex and parse a large set of headers, included by one file.
+ */
+void TEST_cppimport::benchmark_parse()
+{
+    const QString path = temporaryPath() + QLatin1String("benchmark/");
+    QVERIFY(QDir().mkpath(path));
+    const QString fileName = path + QLatin1String("all.h");
+    QFile all(fileName);
+    QVERIFY(all.open(QIODevice::WriteOnly));
+    QTextStream allOut(&all);
+    for (int i = 0; i < BENCHMARK_HEADERS; ++i) {
+        QFile file(path + QString(QLatin1String("header%1.h")).arg(i));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QTextStream out(&file);
+        out << "#define HEADER" << i << "_EXPORT\n"
+            << "namespace bench" << i << " {\n";
+        for (int j = 0; j < BENCHMARK_CLASSES; ++j) {
+            out << "/**\n * Class " << j << " of header " << i << ".\n */\n"
+                << "class HEADER" << i << "_EXPORT Class" << j << " {\n"
+                << "public:\n"
+                << "    Class" << j << "();\n"
+                << "    virtual ~Class" << j << "();\n"
+                << "    template <typename T> T value(const T& defaultValue, int index = 0) const;\n"
+                << "    const char* name(unsigned long id, double scale) const;\n"
+                << "    void setName(const char* name);\n"
+                << "protected:\n"
+                << "    static int s_count;\n"
+                << "private:\n"
+                << "    int m_values[" << j + 1 << "];\n"
+                << "    Class" << j << " *m_next;\n"
+                << "};\n";
+        }
+        out << "}\n";
+        allOut << "#include \"header" << i << ".h\"\n";
+    }
+    allOut.flush();
+    all.close();
+
+    QBENCHMARK {
+        Driver driver;
+        driver.setResolveDependencesEnabled(true);
+        driver.parseFile(fileName);
+    }
+}
+
+QTEST_MAIN(TEST_cppimport)
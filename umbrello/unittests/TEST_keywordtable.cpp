@@ -0,0 +1,183 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_keywordtable.h"
+
+// app includes
+#include "codegenerator.h"
+#include "codegenfactory.h"
+#include "keywordtable.h"
+
+// qt includes
+#include <QRegExp>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+
+using namespace Uml::ProgrammingLanguage;
+
+/**
+ * Check that each table contains its words once and that the words
+ * are found by the lookup.
+ */
+void TEST_keywordtable::test_tables()
+{
+    for (int i = 0; i < Reserved; ++i) {
+        const Enum language = fromInt(i);
+        const KeywordTable *tables[] = { &reservedKeywords(language), &defaultDatatypes(language) };
+        for (int t = 0; t < 2; ++t) {
+            const KeywordTable *table = tables[t];
+            const QStringList words = table->toStringList();
+            QCOMPARE(words.size(), table->count());
+            QCOMPARE(words.toSet().size(), words.size());
+            foreach (const QString &word, words) {
+                QVERIFY2(table->contains(word), qPrintable(toString(language) + QLatin1String(": ") + word));
+                QVERIFY(!table->contains(word + QLatin1Char('x')) || words.contains(word + QLatin1Char('x')));
+            }
+            QVERIFY(!table->contains(QString()));
+        }
+    }
+    QCOMPARE(reservedKeywords(Reserved).count(), 0);
+    QVERIFY(!reservedKeywords(Reserved).contains(QLatin1String("class")));
+    QVERIFY(reservedKeywords(Cpp).count() > 0);
+    QVERIFY(defaultDatatypes(Java).contains(QLatin1String("boolean")));
+    QVERIFY(!defaultDatatypes(Java).contains(QLatin1String("bool")));
+}
+
+/**
+ * Check that the code generators report the generated tables.
+ */
+void TEST_keywordtable::test_generators()
+{
+    for (int i = 0; i < Reserved; ++i) {
+        const Enum language = fromInt(i);
+        CodeGenerator *generator = CodeGenFactory::createObject(language);
+        QVERIFY(generator);
+        QCOMPARE(generator->reservedKeywords(), reservedKeywords(language).toStringList());
+        QCOMPARE(generator->defaultDatatypes(), defaultDatatypes(language).toStringList());
+        foreach (const QString &keyword, generator->reservedKeywords())
+            QVERIFY(generator->isReservedKeyword(keyword));
+        QVERIFY(!generator->isReservedKeyword(QLatin1String("umbrelloIdentifier")));
+        delete generator;
+    }
+}
+
+void TEST_keywordtable::test_caseSensitivity_data()
+{
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QString>("word");
+    QTest::addColumn<bool>("keyword");
+
+    QTest::newRow("Ada lower") << int(Ada) << QString(QLatin1String("begin")) << true;
+    QTest::newRow("Ada upper") << int(Ada) << QString(QLatin1String("BEGIN")) << true;
+    QTest::newRow("Pascal mixed") << int(Pascal) << QString(QLatin1String("Procedure")) << true;
+    QTest::newRow("SQL upper") << int(SQL) << QString(QLatin1String("SELECT")) << true;
+    QTest::newRow("C++ lower") << int(Cpp) << QString(QLatin1String("class")) << true;
+    QTest::newRow("C++ upper") << int(Cpp) << QString(QLatin1String("CLASS")) << false;
+    QTest::newRow("C++ macro") << int(Cpp) << QString(QLatin1String("EOF")) << true;
+    QTest::newRow("C++ macro lower") << int(Cpp) << QString(QLatin1String("eof")) << false;
+}
+
+void TEST_keywordtable::test_caseSensitivity()
+{
+    QFETCH(int, language);
+    QFETCH(QString, word);
+    QFETCH(bool, keyword);
+    QCOMPARE(reservedKeywords(fromInt(language)).contains(word), keyword);
+}
+
+void TEST_keywordtable::test_sqlKeywords()
+{
+    QCOMPARE(reservedKeywords(MySQL).toStringList(), reservedKeywords(SQL).toStringList());
+    QCOMPARE(reservedKeywords(PostgreSQL).toStringList(), reservedKeywords(SQL).toStringList());
+    QVERIFY(defaultDatatypes(PostgreSQL).contains(QLatin1String("double precision")));
+    QVERIFY(!defaultDatatypes(SQL).contains(QLatin1String("double precision")));
+}
+
+void TEST_keywordtable::test_cleanName_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("empty") << QString() << QString();
+    QTest::newRow("unchanged") << QString(QLatin1String("my_name1")) << QString(QLatin1String("my_name1"));
+    QTest::newRow("space") << QString(QLatin1String("my name")) << QString(QLatin1String("my_name"));
+    QTest::newRow("run") << QString(QLatin1String("a - b")) << QString(QLatin1String("a_b"));
+    QTest::newRow("leading and trailing") << QString(QLatin1String(" a.b ")) << QString(QLatin1String("_a_b_"));
+    QTest::newRow("scope") << QString(QLatin1String("std::string")) << QString(QLatin1String("std_string"));
+    QTest::newRow("letters") << QString::fromUtf8("Gr\xc3\xb6\xc3\x9f" "e") << QString::fromUtf8("Gr\xc3\xb6\xc3\x9f" "e");
+}
+
+void TEST_keywordtable::test_cleanName()
+{
+    QFETCH(QString, name);
+    QFETCH(QString, expected);
+    QCOMPARE(CodeGenerator::cleanName(name), expected);
+    QString regExpResult = name;
+    regExpResult.replace(QRegExp(QLatin1String("\\W+")), QLatin1String("_"));
+    QCOMPARE(CodeGenerator::cleanName(name), regExpResult);
+}
+
+void TEST_keywordtable::benchmark_cleanName_data()
+{
+    QTest::addColumn<QString>("lookup");
+    QTest::newRow("table") << QString(QLatin1String("table"));
+    QTest::newRow("list") << QString(QLatin1String("list"));
+}
+
+/**
+ * Measure cleaning one million names and checking them against the
+ * C++ keywords, with the keyword table and with the former string list.
+ */
+void TEST_keywordtable::benchmark_cleanName()
+{
+    QFETCH(QString, lookup);
+    const KeywordTable &table = reservedKeywords(Cpp);
+    const QStringList list = table.toStringList();
+    QVector<QString> names;
+    names.reserve(1000000);
+    for (int i = 0; names.size() < 1000000; ++i) {
+        names.append(list.at(i % list.size()));
+        names.append(QString(QLatin1String("attribute%1")).arg(i));
+        names.append(QString(QLatin1String("operation name %1")).arg(i));
+        names.append(QString(QLatin1String("%1::Class")).arg(list.at(i % list.size())));
+    }
+
+    int count = 0;
+    QBENCHMARK {
+        count = 0;
+        if (lookup == QLatin1String("table")) {
+            foreach (const QString &name, names) {
+                if (table.contains(CodeGenerator::cleanName(name)))
+                    ++count;
+            }
+        } else {
+            foreach (const QString &name, names) {
+                if (list.contains(CodeGenerator::cleanName(name)))
+                    ++count;
+            }
+        }
+    }
+    QCOMPARE(count, 250000);
+}
+
+QTEST_MAIN(TEST_keywordtable)
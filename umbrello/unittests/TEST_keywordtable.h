@@ -0,0 +1,45 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEST_KEYWORDTABLE_H
+#define TEST_KEYWORDTABLE_H
+
+#include "testbase.h"
+
+/**
+ * Unit test for class KeywordTable (keywordtable.h), the generated
+ * keyword tables and CodeGenerator::cleanName().
+ */
+class TEST_keywordtable : public TestBase
+{
+    Q_OBJECT
+private slots:
+    void test_tables();
+    void test_generators();
+    void test_caseSensitivity_data();
+    void test_caseSensitivity();
+    void test_sqlKeywords();
+    void test_cleanName_data();
+    void test_cleanName();
+    void benchmark_cleanName_data();
+    void benchmark_cleanName();
+};
+
+#endif // TEST_KEYWORDTABLE_H
@@ -0,0 +1,327 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_layeredlayout.h"
+
+// app includes
+#include "associationline.h"
+#include "associationwidget.h"
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "folder.h"
+#include "layeredlayout.h"
+#include "layoutgenerator.h"
+#include "layoutjob.h"
+#include "object_factory.h"
+#include "optionstate.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QLineF>
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Create a tree of nodes, each node is the child of node (i - 1) / 3,
+ * with an additional weak edge from every fifth node.
+ */
+void TEST_LayeredLayout::createGraph(LayeredLayout &layout, int count)
+{
+    for (int i = 0; i < count; ++i)
+        layout.addNode(QString::number(i), QSizeF(80 + (i % 4) * 20, 40 + (i % 3) * 20));
+    for (int i = 1; i < count; ++i) {
+        layout.addEdge((i - 1) / 3, i);
+        if (i % 5 == 0)
+            layout.addEdge(i, (i * 7) % count, 0.001);
+    }
+}
+
+/**
+ * Create a class diagram with a class hierarchy, each class is derived
+ * from class (i - 1) / 3, and every fifth class has an association.
+ */
+UMLScene *TEST_LayeredLayout::createClassDiagram(int count)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+    UMLView *view = doc->createDiagram(logicalView, Uml::DiagramType::Class, QLatin1String("classes"));
+    UMLScene *scene = view->umlScene();
+    QList<ClassifierWidget*> widgets;
+    for (int i = 0; i < count; ++i) {
+        UMLObject *o = Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                                       QString::fromLatin1("C%1").arg(i),
+                                                       logicalView, false);
+        ClassifierWidget *w = new ClassifierWidget(scene, static_cast<UMLClassifier*>(o));
+        w->setSize(80, 40);
+        w->setX(0);
+        w->setY(0);
+        scene->widgetList().append(w);
+        widgets.append(w);
+    }
+    for (int i = 1; i < count; ++i) {
+        scene->addAssociation(AssociationWidget::create(scene, widgets[i], Uml::AssociationType::Generalization,
+                                                        widgets[(i - 1) / 3]));
+        if (i % 5 == 0 && (i * 7) % count != i)
+            scene->addAssociation(AssociationWidget::create(scene, widgets[i], Uml::AssociationType::Association,
+                                                            widgets[(i * 7) % count]));
+    }
+    return scene;
+}
+
+/**
+ * Return whether two widgets of the scene overlap.
+ */
+bool TEST_LayeredLayout::overlaps(UMLScene *scene)
+{
+    const UMLWidgetList widgets = scene->widgetList();
+    for (int i = 0; i < widgets.size(); ++i) {
+        QRectF a(widgets[i]->x(), widgets[i]->y(), widgets[i]->width(), widgets[i]->height());
+        for (int j = i + 1; j < widgets.size(); ++j) {
+            QRectF b(widgets[j]->x(), widgets[j]->y(), widgets[j]->width(), widgets[j]->height());
+            if (a.intersects(b))
+                return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Return the number of crossings between the association lines of the
+ * scene, which do not share a widget.
+ */
+int TEST_LayeredLayout::crossings(UMLScene *scene)
+{
+    const AssociationWidgetList associations = scene->associationList();
+    int result = 0;
+    for (int i = 0; i < associations.size(); ++i) {
+        AssociationWidget *a = associations[i];
+        AssociationLine *lineA = a->associationLine();
+        for (int j = i + 1; j < associations.size(); ++j) {
+            AssociationWidget *b = associations[j];
+            if (a->widgetForRole(Uml::RoleType::A) == b->widgetForRole(Uml::RoleType::A) ||
+                a->widgetForRole(Uml::RoleType::A) == b->widgetForRole(Uml::RoleType::B) ||
+                a->widgetForRole(Uml::RoleType::B) == b->widgetForRole(Uml::RoleType::A) ||
+                a->widgetForRole(Uml::RoleType::B) == b->widgetForRole(Uml::RoleType::B))
+                continue;
+            AssociationLine *lineB = b->associationLine();
+            for (int k = 0; k < lineA->count() - 1; ++k) {
+                QLineF segmentA(lineA->point(k), lineA->point(k + 1));
+                for (int l = 0; l < lineB->count() - 1; ++l) {
+                    QLineF segmentB(lineB->point(l), lineB->point(l + 1));
+                    QPointF p;
+                    if (segmentA.intersect(segmentB, &p) == QLineF::BoundedIntersection)
+                        ++result;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void TEST_LayeredLayout::test_layers()
+{
+    LayeredLayout layout;
+    int a = layout.addNode(QLatin1String("a"), QSizeF(100, 50));
+    int b = layout.addNode(QLatin1String("b"), QSizeF(80, 40));
+    int c = layout.addNode(QLatin1String("c"), QSizeF(60, 60));
+    layout.addEdge(a, b);
+    layout.addEdge(b, c);
+    layout.addEdge(a, c);
+    QVERIFY(layout.run());
+    const QVector<LayeredLayout::Node> &nodes = layout.nodes();
+    QVERIFY(nodes[a].position.y() + 50 <= nodes[b].position.y());
+    QVERIFY(nodes[b].position.y() + 40 <= nodes[c].position.y());
+    QCOMPARE(layout.crossings(), 0);
+
+    // the edges start at the bottom of their source and end at the top of their target
+    const LayeredLayout::Edge &edge = layout.edges()[2];
+    QCOMPARE(edge.points.first().y(), nodes[a].position.y() + 50);
+    QCOMPARE(edge.points.last().y(), nodes[c].position.y());
+    QVERIFY(layout.boundingRect().contains(QRectF(nodes[c].position, nodes[c].size)));
+}
+
+void TEST_LayeredLayout::test_direction()
+{
+    LayeredLayout layout;
+    int a = layout.addNode(QLatin1String("a"), QSizeF(100, 50));
+    int b = layout.addNode(QLatin1String("b"), QSizeF(80, 40));
+    layout.addEdge(a, b);
+
+    layout.setDirection(LayeredLayout::direction(QLatin1String("LR")));
+    QVERIFY(layout.run());
+    QVERIFY(layout.nodes()[a].position.x() + 100 <= layout.nodes()[b].position.x());
+
+    layout.setDirection(LayeredLayout::direction(QLatin1String("BT")));
+    QVERIFY(layout.run());
+    QVERIFY(layout.nodes()[b].position.y() + 40 <= layout.nodes()[a].position.y());
+
+    layout.setDirection(LayeredLayout::direction(QLatin1String("RL")));
+    QVERIFY(layout.run());
+    QVERIFY(layout.nodes()[b].position.x() + 80 <= layout.nodes()[a].position.x());
+}
+
+void TEST_LayeredLayout::test_cycles()
+{
+    LayeredLayout layout;
+    int a = layout.addNode(QLatin1String("a"), QSizeF(50, 50));
+    int b = layout.addNode(QLatin1String("b"), QSizeF(50, 50));
+    int c = layout.addNode(QLatin1String("c"), QSizeF(50, 50));
+    layout.addEdge(a, b);
+    layout.addEdge(b, c);
+    layout.addEdge(c, a);
+    layout.addEdge(b, b);
+    QVERIFY(layout.run());
+
+    // all edges are routed from their source to their target, except the loop
+    const QVector<LayeredLayout::Node> &nodes = layout.nodes();
+    for (int e = 0; e < 3; ++e) {
+        const LayeredLayout::Edge &edge = layout.edges()[e];
+        QVERIFY(QRectF(nodes[edge.source].position, nodes[edge.source].size).adjusted(-1, -1, 1, 1).contains(edge.points.first()));
+        QVERIFY(QRectF(nodes[edge.target].position, nodes[edge.target].size).adjusted(-1, -1, 1, 1).contains(edge.points.last()));
+    }
+    QVERIFY(layout.edges()[3].points.isEmpty());
+}
+
+void TEST_LayeredLayout::test_crossings()
+{
+    // each upper node is connected to the mirrored lower node
+    LayeredLayout layout;
+    for (int i = 0; i < 8; ++i)
+        layout.addNode(QString::number(i), QSizeF(50, 30));
+    for (int i = 0; i < 4; ++i)
+        layout.addEdge(i, 7 - i);
+    QVERIFY(layout.run());
+    QCOMPARE(layout.crossings(), 0);
+}
+
+void TEST_LayeredLayout::test_orthogonalRouting()
+{
+    LayeredLayout layout;
+    createGraph(layout, 200);
+    QVERIFY(layout.run());
+
+    const QVector<LayeredLayout::Node> &nodes = layout.nodes();
+    for (int i = 0; i < nodes.size(); ++i) {
+        QRectF a(nodes[i].position, nodes[i].size);
+        for (int j = i + 1; j < nodes.size(); ++j)
+            QVERIFY(!a.intersects(QRectF(nodes[j].position, nodes[j].size)));
+    }
+    foreach(const LayeredLayout::Edge &edge, layout.edges()) {
+        QVERIFY(edge.points.size() >= 2);
+        for (int i = 0; i < edge.points.size() - 1; ++i) {
+            QPointF d = edge.points[i + 1] - edge.points[i];
+            QVERIFY(qAbs(d.x()) < 0.01 || qAbs(d.y()) < 0.01);
+        }
+    }
+
+    layout.setRouting(LayeredLayout::Polyline);
+    QVERIFY(layout.run());
+    QVERIFY(layout.edges()[0].points.size() >= 2);
+}
+
+void TEST_LayeredLayout::test_cancel()
+{
+    LayeredLayout layout;
+    createGraph(layout, 100);
+    QAtomicInt cancelled(1);
+    QVERIFY(!layout.run(&cancelled));
+
+    LayoutJob job(layout);
+    job.start();
+    job.wait();
+    QVERIFY(job.success());
+    QCOMPARE(job.layout().nodes().size(), 100);
+
+    LayoutJob cancelledJob(layout);
+    cancelledJob.cancel();
+    cancelledJob.start();
+    cancelledJob.wait();
+    QVERIFY(!cancelledJob.success());
+}
+
+void TEST_LayeredLayout::test_applyLayout()
+{
+    Settings::optionState().autoLayoutState.useDot = false;
+    UMLScene *scene = createClassDiagram(20);
+    QVERIFY(overlaps(scene));
+    LayoutGenerator generator;
+    QVERIFY(generator.generate(scene));
+    QVERIFY(generator.apply(scene));
+    QVERIFY(!overlaps(scene));
+
+    // the base class is above its derived classes
+    UMLWidget *base = scene->widgetList().first();
+    UMLWidget *derived = scene->widgetList().last();
+    QVERIFY(base->y() + base->height() <= derived->y());
+
+    // the association lines are orthogonal
+    foreach(AssociationWidget *a, scene->associationList()) {
+        AssociationLine *line = a->associationLine();
+        for (int i = 0; i < line->count() - 1; ++i) {
+            QPointF d = line->point(i + 1) - line->point(i);
+            QVERIFY(qAbs(d.x()) < 0.01 || qAbs(d.y()) < 0.01);
+        }
+    }
+}
+
+void TEST_LayeredLayout::benchmark_layout_data()
+{
+    QTest::addColumn<bool>("useDot");
+    QTest::addColumn<int>("count");
+    QTest::newRow("layered 50") << false << 50;
+    QTest::newRow("dot 50") << true << 50;
+    QTest::newRow("layered 200") << false << 200;
+    QTest::newRow("dot 200") << true << 200;
+}
+
+/**
+ * Compare the speed and the number of crossing association lines of the
+ * built-in layout generator and of dot.
+ */
+void TEST_LayeredLayout::benchmark_layout()
+{
+    QFETCH(bool, useDot);
+    QFETCH(int, count);
+    if (useDot && LayoutGenerator::currentDotPath().isEmpty()) {
+#if QT_VERSION >= 0x050000
+        QSKIP("dot has not been found");
+#else
+        QSKIP("dot has not been found", SkipSingle);
+#endif
+    }
+    Settings::optionState().autoLayoutState.useDot = useDot;
+    Settings::optionState().autoLayoutState.autoDotPath = true;
+    UMLScene *scene = createClassDiagram(count);
+    LayoutGenerator generator;
+    bool generated = false;
+    QBENCHMARK {
+        generated = generator.generate(scene);
+    }
+    QVERIFY(generated);
+    QVERIFY(generator.apply(scene));
+    qDebug() << (useDot ? "dot:" : "layered:") << crossings(scene) << "crossings";
+    Settings::optionState().autoLayoutState.useDot = false;
+}
+
+QTEST_MAIN(TEST_LayeredLayout)
@@ -0,0 +1,209 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_nativeimport.h"
+
+// app includes
+#include "attribute.h"
+#include "classifier.h"
+#include "javaimport.h"
+#include "uml.h"
+#include "umldoc.h"
+
+// qt includes
+#include <QFile>
+#include <QScopedPointer>
+#include <QTextStream>
+
+// minimal number of lines of the files imported by benchmark_import
+const int CORPUS_LINES = 100000;
+
+/**
+ * Java importer giving access to the scanner of NativeImportBase.
+ */
+class TestJavaImport : public JavaImport
+{
+public:
+    using JavaImport::split;
+
+    QStringList scanned(const QString& line)
+    {
+        m_source.clear();
+        scan(line);
+        return m_source;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+void TEST_nativeimport::test_split()
+{
+    TestJavaImport importer;
+    QCOMPARE(importer.split(QLatin1String("  int  a = \"x  y\\\" z\";\t'c' ")),
+             QStringList() << QLatin1String("int")
+                           << QLatin1String("a")
+                           << QLatin1String("=")
+                           << QLatin1String("\"x  y\\\" z\"")
+                           << QLatin1String(";")
+                           << QLatin1String("'c'"));
+    QCOMPARE(importer.split(QLatin1String("a\"b\"c")),
+             QStringList() << QLatin1String("a")
+                           << QLatin1String("\"b\"")
+                           << QLatin1String("c"));
+    QCOMPARE(importer.split(QLatin1String(" \t ")), QStringList());
+}
+
+void TEST_nativeimport::test_scan()
+{
+    TestJavaImport importer;
+    QCOMPARE(importer.scanned(QLatin1String("private int[] m_a; // comment")),
+             QStringList() << QLatin1String("// comment")
+                           << QLatin1String("private")
+                           << QLatin1String("int")
+                           << QLatin1String("[")
+                           << QLatin1String("]")
+                           << QLatin1String("m_a")
+                           << QLatin1String(";"));
+    QCOMPARE(importer.scanned(QLatin1String("String s = \"a b\";")),
+             QStringList() << QLatin1String("String")
+                           << QLatin1String("s")
+                           << QLatin1String("=")
+                           << QLatin1String("\"a b\"")
+                           << QLatin1String(";"));
+    QCOMPARE(importer.scanned(QLatin1String(" \t")), QStringList());
+}
+
+void TEST_nativeimport::test_parseFileCrLf()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    const QString fileName = temporaryPath() + QLatin1String("CrLf.java");
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write("public class CrLf {\r\n"
+               "    // the value\r\n"
+               "    private int m_value;\r\n"
+               "}");
+    file.close();
+
+    JavaImport importer;
+    QVERIFY(importer.importFiles(QStringList() << fileName));
+    UMLClassifier *c = doc->findUMLClassifier(QLatin1String("CrLf"));
+    QVERIFY(c);
+    UMLAttributeList attributes = c->getAttributeList();
+    QCOMPARE(attributes.size(), 1);
+    QCOMPARE(attributes.first()->name(), QLatin1String("m_value"));
+}
+
+void TEST_nativeimport::benchmark_import_data()
+{
+    QTest::addColumn<QString>("extension");
+    QTest::addColumn<QString>("header");
+    QTest::addColumn<QString>("body");
+    QTest::addColumn<QString>("trailer");
+
+    QTest::newRow("java")
+        << QString(QLatin1String("java"))
+        << QString(QLatin1String("package bench;\n"))
+        << QString(QLatin1String(
+               "/**\n"
+               " * Class %1.\n"
+               " */\n"
+               "class Class%1 extends Object {\n"
+               "    private int m_value; // the value\n"
+               "    public String name(int a, String b) { return \"x y\"; }\n"
+               "}\n"))
+        << QString();
+    QTest::newRow("csharp")
+        << QString(QLatin1String("cs"))
+        << QString(QLatin1String("namespace Bench {\n"))
+        << QString(QLatin1String(
+               "/// Class %1.\n"
+               "public class Class%1 {\n"
+               "    private int m_value; // the value\n"
+               "    public string Name(int a, string b) { return \"x y\"; }\n"
+               "}\n"))
+        << QString(QLatin1String("}\n"));
+    QTest::newRow("python")
+        << QString(QLatin1String("py"))
+        << QString()
+        << QString(QLatin1String(
+               "# Class %1.\n"
+               "class Class%1(object):\n"
+               "    def name(self, a, b):\n"
+               "        return \"x y\"\n"
+               "\n"))
+        << QString();
+    QTest::newRow("pascal")
+        << QString(QLatin1String("pas"))
+        << QString(QLatin1String("unit Bench;\ninterface\ntype\n"))
+        << QString(QLatin1String(
+               "  { Class %1. }\n"
+               "  TClass%1 = class\n"
+               "  private\n"
+               "    FValue: Integer; // the value\n"
+               "  public\n"
+               "    function Name(A: Integer; B: String): String;\n"
+               "  end;\n"))
+        << QString(QLatin1String("implementation\nend.\n"));
+    QTest::newRow("ada")
+        << QString(QLatin1String("ads"))
+        << QString(QLatin1String("package Bench is\n"))
+        << QString(QLatin1String(
+               "   -- Class %1.\n"
+               "   type Class%1 is tagged record\n"
+               "      Value : Integer;\n"
+               "   end record;\n"
+               "   function Name (Self : Class%1; A : Integer) return String;\n"))
+        << QString(QLatin1String("end Bench;\n"));
+}
+
+/**
+ * Import a file of at least CORPUS_LINES lines with the importer
+ * selected by the extension of the file.
+ */
+void TEST_nativeimport::benchmark_import()
+{
+    QFETCH(QString, extension);
+    QFETCH(QString, header);
+    QFETCH(QString, body);
+    QFETCH(QString, trailer);
+
+    const QString fileName = temporaryPath() + QLatin1String("bench.") + extension;
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QTextStream out(&file);
+    out << header;
+    const int bodyLines = body.count(QLatin1Char('\n'));
+    for (int i = 0; i * bodyLines < CORPUS_LINES; ++i)
+        out << body.arg(i);
+    out << trailer;
+    out.flush();
+    file.close();
+
+    UMLDoc *doc = UMLApp::app()->document();
+    QBENCHMARK {
+        doc->newDocument();
+        QScopedPointer<ClassImport> importer(ClassImport::createImporterByFileExt(fileName));
+        importer->importFiles(QStringList() << fileName);
+    }
+}
+
+QTEST_MAIN(TEST_nativeimport)
@@ -0,0 +1,590 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_umldoc.h"
+
+// app includes
+#include "association.h"
+#include "associationwidget.h"
+#include "attribute.h"
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "folder.h"
+#include "object_factory.h"
+#include "package.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "uniqueid.h"
+#include "xmisavejob.h"
+
+// qt includes
+#include <QBuffer>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegExp>
+#include <QSignalSpy>
+#include <QThread>
+
+// number of packages and classes per package of the synthetic model
+const int PACKAGES = 500;
+const int CLASSES_PER_PACKAGE = 99;
+
+// size of the snapshot written by test_saveInBackground, several blocks of XMISaveJob
+const int SNAPSHOT_SIZE = 8 * 1024 * 1024 + 123;
+
+// number of classes of the model autosaved by test_saveDocumentDuringBackgroundSave
+const int AUTOSAVE_CLASSES = 10000;
+
+//-----------------------------------------------------------------------------
+
+void TEST_UMLDoc::test_findObjectById()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *root = doc->rootFolder(Uml::ModelType::Logical);
+
+    UMLPackage *pkg = new UMLPackage(QLatin1String("Test Package"));
+    pkg->setUMLPackage(root);
+    root->addObject(pkg);
+    QCOMPARE(doc->findObjectById(pkg->id()), static_cast<UMLObject*>(pkg));
+
+    UMLClassifier *c = new UMLClassifier(QLatin1String("Test A"));
+    c->setUMLPackage(pkg);
+    pkg->addObject(c);
+    QCOMPARE(doc->findObjectById(c->id()), static_cast<UMLObject*>(c));
+
+    UMLAttribute *attr = c->addAttribute(QLatin1String("attributeA_"));
+    QCOMPARE(doc->findObjectById(attr->id()), static_cast<UMLObject*>(attr));
+
+    // ID change as done by UMLDoc::assignNewIDs() when pasting
+    Uml::ID::Type oldID = c->id();
+    c->setID(UniqueID::gen());
+    QCOMPARE(doc->findObjectById(oldID), static_cast<UMLObject*>(0));
+    QCOMPARE(doc->findObjectById(c->id()), static_cast<UMLObject*>(c));
+
+    // reparenting
+    pkg->removeObject(c);
+    QCOMPARE(doc->findObjectById(c->id()), static_cast<UMLObject*>(0));
+    QCOMPARE(doc->findObjectById(attr->id()), static_cast<UMLObject*>(0));
+    c->setUMLPackage(root);
+    root->addObject(c);
+    QCOMPARE(doc->findObjectById(c->id()), static_cast<UMLObject*>(c));
+    QCOMPARE(doc->findObjectById(attr->id()), static_cast<UMLObject*>(attr));
+
+    c->removeAttribute(attr);
+    QCOMPARE(doc->findObjectById(attr->id()), static_cast<UMLObject*>(0));
+
+    // objects outside of the model tree are not found
+    UMLClassifier detached(QLatin1String("Test B"));
+    UMLAttribute *detachedAttr = detached.addAttribute(QLatin1String("attributeB_"));
+    QCOMPARE(doc->findObjectById(detached.id()), static_cast<UMLObject*>(0));
+    QCOMPARE(doc->findObjectById(detachedAttr->id()), static_cast<UMLObject*>(0));
+
+    Uml::ID::Type id = c->id();
+    root->removeObject(c);
+    delete c;
+    QCOMPARE(doc->findObjectById(id), static_cast<UMLObject*>(0));
+    root->removeObject(pkg);
+    delete pkg;
+}
+
+void TEST_UMLDoc::test_loadLargeModel()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *root = doc->rootFolder(Uml::ModelType::Logical);
+    for (int i = 0; i < PACKAGES; ++i) {
+        UMLPackage *pkg = new UMLPackage(QString(QLatin1String("package%1")).arg(i));
+        pkg->setUMLPackage(root);
+        root->addObject(pkg);
+        for (int j = 0; j < CLASSES_PER_PACKAGE; ++j) {
+            UMLClassifier *c = new UMLClassifier(QString(QLatin1String("class%1")).arg(j));
+            c->setUMLPackage(pkg);
+            pkg->addObject(c);
+            if (j % 10 == 0) {
+                m_sampleIDs.append(c->id());
+            }
+        }
+    }
+    QBuffer buffer;
+    buffer.open(QIODevice::ReadWrite);
+    doc->saveToXMI(buffer);
+    doc->closeDocument();
+    QCOMPARE(doc->findObjectById(m_sampleIDs.first()), static_cast<UMLObject*>(0));
+
+    buffer.seek(0);
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(doc->loadFromXMI(buffer, ENC_UNICODE));
+    qDebug() << "loaded" << PACKAGES * (CLASSES_PER_PACKAGE + 1) << "objects in"
+             << timer.elapsed() << "ms";
+    foreach (const Uml::ID::Type &id, m_sampleIDs) {
+        QVERIFY(doc->findObjectById(id) != 0);
+    }
+}
+
+void TEST_UMLDoc::test_findObjectByIdWalk()
+{
+    // the lookup as done before the ID index was introduced
+    UMLDoc *doc = UMLApp::app()->document();
+    QBENCHMARK {
+        foreach (const Uml::ID::Type &id, m_sampleIDs) {
+            UMLObject *o = 0;
+            for (int i = 0; i < Uml::ModelType::N_MODELTYPES && !o; ++i) {
+                o = doc->rootFolder(Uml::ModelType::fromInt(i))->findObjectById(id);
+            }
+            QVERIFY(o != 0);
+        }
+    }
+}
+
+void TEST_UMLDoc::test_findObjectByIdIndexed()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    QBENCHMARK {
+        foreach (const Uml::ID::Type &id, m_sampleIDs) {
+            QVERIFY(doc->findObjectById(id) != 0);
+        }
+    }
+}
+
+/**
+ * Save the current model and return it without the timestamp.
+ */
+static QString save()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    UMLApp::app()->document()->saveToXMI(buffer);
+    QString result = QString::fromUtf8(buffer.data());
+    result.remove(QRegExp(QLatin1String("timestamp=\"[^\"]*\"")));
+    return result;
+}
+
+/**
+ * Load the given file with the DOM or the stream based loader and
+ * return the model saved again, without the timestamp.
+ */
+static QString loadAndSave(const QString &fileName, bool streaming)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->closeDocument();
+    doc->setStreamingLoad(streaming);
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    QElapsedTimer timer;
+    timer.start();
+    doc->setLoading(true);
+    bool status = doc->loadFromXMI(file);
+    doc->setLoading(false);
+    qDebug() << QFileInfo(fileName).fileName() << (streaming ? "stream:" : "DOM:")
+             << timer.elapsed() << "ms";
+    if (!status) {
+        return QString();
+    }
+    return save();
+}
+
+void TEST_UMLDoc::test_loadFromXMI_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QStringList dirs;
+    dirs << QLatin1String("test")
+         << QLatin1String("models/UmbrelloArchitecture")
+         << QLatin1String("models/diagrams/activity")
+         << QLatin1String("models/diagrams/class")
+         << QLatin1String("models/diagrams/state");
+    foreach (const QString &dir, dirs) {
+        QDir d(QLatin1String(UMBRELLO_SOURCE_DIR) + QLatin1Char('/') + dir);
+        foreach (const QString &name, d.entryList(QStringList() << QLatin1String("*.xmi"), QDir::Files)) {
+            QTest::newRow(name.toLatin1().constData()) << d.filePath(name);
+        }
+    }
+}
+
+void TEST_UMLDoc::test_loadFromXMI()
+{
+    QFETCH(QString, fileName);
+    UMLDoc *doc = UMLApp::app()->document();
+    bool oldState = doc->streamingLoad();
+    QString dom = loadAndSave(fileName, false);
+    QString stream = loadAndSave(fileName, true);
+    doc->setStreamingLoad(oldState);
+    QVERIFY(!dom.isEmpty());
+    QCOMPARE(stream, dom);
+}
+
+void TEST_UMLDoc::test_saveToXMI_data()
+{
+    test_loadFromXMI_data();
+}
+
+void TEST_UMLDoc::test_saveToXMI()
+{
+    QFETCH(QString, fileName);
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->closeDocument();
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    doc->setLoading(true);
+    bool status = doc->loadFromXMI(file);
+    doc->setLoading(false);
+    QVERIFY(status);
+
+    bool oldState = doc->streamingSave();
+    QElapsedTimer timer;
+    timer.start();
+    doc->setStreamingSave(false);
+    QString dom = save();
+    qint64 domTime = timer.restart();
+    doc->setStreamingSave(true);
+    QString stream = save();
+    qint64 streamTime = timer.elapsed();
+    doc->setStreamingSave(oldState);
+    qDebug() << QFileInfo(fileName).fileName() << "DOM:" << domTime << "ms"
+             << "stream:" << streamTime << "ms";
+    QVERIFY(!dom.isEmpty());
+    QCOMPARE(stream, dom);
+}
+
+/**
+ * Return the resident memory of the process in kB as reported by the
+ * kernel, or 0 where it is not available.
+ */
+static qint64 residentMemory()
+{
+    QFile file(QLatin1String("/proc/self/status"));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    foreach (const QByteArray &line, file.readAll().split('\n')) {
+        if (line.startsWith("VmRSS:")) {
+            return line.mid(6).trimmed().split(' ').first().toLongLong();
+        }
+    }
+    return 0;
+}
+
+/**
+ * Load the given file with the diagrams loaded at once or on demand
+ * and print the time and the memory needed.
+ */
+static bool loadLazily(const QString &fileName, bool lazy)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->closeDocument();
+    doc->setLazyDiagramLoad(lazy);
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const qint64 memory = residentMemory();
+    QElapsedTimer timer;
+    timer.start();
+    doc->setLoading(true);
+    bool status = doc->loadFromXMI(file);
+    doc->setLoading(false);
+    qDebug() << QFileInfo(fileName).fileName() << (lazy ? "lazy:" : "eager:")
+             << timer.elapsed() << "ms" << residentMemory() - memory << "kB";
+    return status;
+}
+
+/**
+ * Return the number of diagrams of the document not loaded yet.
+ */
+static int unloadedViewCount()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    int count = 0;
+    for (int i = 0; i < Uml::ModelType::N_MODELTYPES; ++i) {
+        count += doc->rootFolder(Uml::ModelType::fromInt(i))->unloadedViewCount();
+    }
+    return count;
+}
+
+void TEST_UMLDoc::test_lazyDiagramLoad_data()
+{
+    test_loadFromXMI_data();
+}
+
+void TEST_UMLDoc::test_lazyDiagramLoad()
+{
+    QFETCH(QString, fileName);
+    UMLDoc *doc = UMLApp::app()->document();
+    bool oldState = doc->lazyDiagramLoad();
+
+    QVERIFY(loadLazily(fileName, false));
+    QCOMPARE(unloadedViewCount(), 0);
+    const int viewCount = doc->viewIterator().count();
+    QString eager = save();
+
+    QVERIFY(loadLazily(fileName, true));
+    // at most the current diagram has been loaded
+    QVERIFY(doc->loadedViews().count() <= 1);
+    QCOMPARE(doc->viewNames().count(), viewCount);
+    QCOMPARE(doc->viewIterator().count(), viewCount);
+    QCOMPARE(unloadedViewCount(), 0);
+    QString lazy = save();
+    doc->setLazyDiagramLoad(oldState);
+    QCOMPARE(lazy, eager);
+}
+
+void TEST_UMLDoc::test_removeObjectOfDeferredView()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    bool oldState = doc->lazyDiagramLoad();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("deferred"));
+    UMLObject *a = Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("A"), 0, false);
+    UMLObject *b = Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("B"), 0, false);
+    const QString idA = Uml::ID::toString(a->id());
+    const QString idB = Uml::ID::toString(b->id());
+    UMLObject *c = Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("C"), 0, false);
+    UMLScene *scene = view->umlScene();
+    scene->widgetList().append(new ClassifierWidget(scene, static_cast<UMLClassifier*>(a)));
+    ClassifierWidget *widgetB = new ClassifierWidget(scene, static_cast<UMLClassifier*>(b));
+    scene->widgetList().append(widgetB);
+    ClassifierWidget *widgetC = new ClassifierWidget(scene, static_cast<UMLClassifier*>(c));
+    widgetC->setX(200);
+    scene->widgetList().append(widgetC);
+    AssociationWidget *assocWidget = AssociationWidget::create(scene, widgetB, Uml::AssociationType::Association, widgetC);
+    doc->addAssociation(assocWidget->association());
+    scene->addAssociation(assocWidget);
+    const QString idAssoc = Uml::ID::toString(assocWidget->association()->id());
+    // a second diagram, so that the first one is not loaded as the current one
+    doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                       Uml::DiagramType::Class, QLatin1String("current"));
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    doc->saveToXMI(buffer);
+    buffer.close();
+
+    doc->closeDocument();
+    doc->setLazyDiagramLoad(true);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    doc->setLoading(true);
+    bool status = doc->loadFromXMI(buffer);
+    doc->setLoading(false);
+    QVERIFY(status);
+    foreach (UMLView *loaded, doc->loadedViews()) {
+        QVERIFY(loaded->umlScene()->name() != QLatin1String("deferred"));
+    }
+
+    // an association is removed from the diagram without loading it
+    QCOMPARE(doc->associations().count(), 1);
+    doc->removeUMLObject(doc->associations().first(), true);
+    foreach (UMLView *loaded, doc->loadedViews()) {
+        QVERIFY(loaded->umlScene()->name() != QLatin1String("deferred"));
+    }
+    QString xmi = save();
+    QVERIFY(!xmi.contains(idAssoc));
+    QVERIFY(!xmi.contains(QLatin1String("<assocwidget")));
+
+    // a diagram showing a widget of a removed object is loaded
+    a = doc->findObjectById(Uml::ID::fromString(idA));
+    QVERIFY(a);
+    doc->removeUMLObject(a, true);
+    xmi = save();
+    doc->setLazyDiagramLoad(oldState);
+    // the widget of the removed object is not saved with the diagram
+    QVERIFY(!xmi.contains(idA));
+    QVERIFY(xmi.contains(QLatin1String("xmi.id=\"") + idB + QLatin1Char('"')));
+}
+
+void TEST_UMLDoc::test_saveInBackground()
+{
+    QString fileName = QDir::tempPath() + QLatin1String("/TEST_umldoc_background.xmi");
+    QByteArray xmi(SNAPSHOT_SIZE, 'x');
+    for (int i = 0; i < SNAPSHOT_SIZE; i += 4099) {
+        xmi[i] = char('a' + i % 26);
+    }
+    XMISaveJob job(xmi, fileName);
+    QSignalSpy progress(&job, SIGNAL(progress(qint64,qint64)));
+    QSignalSpy saved(&job, SIGNAL(saved(bool,QString)));
+    ThreadRecorder recorder;
+    connect(&job, SIGNAL(progress(qint64,qint64)), &recorder, SLOT(record()), Qt::DirectConnection);
+    // the job waits at each block until the GUI event loop has run the probe
+    EventLoopProbe probe(&job);
+    connect(&job, SIGNAL(progress(qint64,qint64)), &probe, SLOT(probe()), Qt::BlockingQueuedConnection);
+    QEventLoop loop;
+    connect(&job, SIGNAL(finished()), &loop, SLOT(quit()));
+    job.start();
+    loop.exec();
+    job.wait();
+
+    // the file is written by the job thread, not the GUI thread
+    QCOMPARE(recorder.recordedThread(), static_cast<QThread*>(&job));
+    QVERIFY(recorder.recordedThread() != QThread::currentThread());
+    // the GUI event loop kept processing events while the file was written
+    QCOMPARE(probe.callsWhileRunning(), progress.count());
+
+    QVERIFY(job.success());
+    QCOMPARE(saved.count(), 1);
+    QCOMPARE(saved.at(0).at(0).toBool(), true);
+    QCOMPARE(progress.count(), SNAPSHOT_SIZE / (1024 * 1024) + 1);
+    QCOMPARE(progress.last().at(0).toLongLong(), qint64(SNAPSHOT_SIZE));
+    QCOMPARE(progress.last().at(1).toLongLong(), qint64(SNAPSHOT_SIZE));
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(file.readAll() == xmi);
+    file.close();
+    QFile::remove(fileName);
+}
+
+void TEST_UMLDoc::test_saveInBackgroundCompressed()
+{
+    QString fileName = QDir::tempPath() + QLatin1String("/TEST_umldoc_background.xmi.tgz");
+    XMISaveJob job(QByteArray(1024, 'x'), fileName);
+    QEventLoop loop;
+    connect(&job, SIGNAL(finished()), &loop, SLOT(quit()));
+    job.start();
+    loop.exec();
+    QVERIFY(job.success());
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QByteArray magic = file.read(2);
+    QCOMPARE(magic, QByteArray("\x1f\x8b"));
+    file.close();
+    QFile::remove(fileName);
+}
+
+void TEST_UMLDoc::test_saveDocumentInBackground()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->closeDocument();
+    UMLFolder *root = doc->rootFolder(Uml::ModelType::Logical);
+    UMLClassifier *c = new UMLClassifier(QLatin1String("Test A"));
+    c->setUMLPackage(root);
+    root->addObject(c);
+    QString expected = save();
+
+    QString fileName = QDir::tempPath() + QLatin1String("/TEST_umldoc_document.xmi");
+    doc->setModified(true);
+    const QString url = doc->url().toString();
+    QSignalSpy progress(doc, SIGNAL(sigBackgroundSaveProgress(qint64,qint64)));
+    QSignalSpy finished(doc, SIGNAL(sigBackgroundSaveFinished(bool,QString)));
+    QEventLoop loop;
+    connect(doc, SIGNAL(sigBackgroundSaveFinished(bool,QString)), &loop, SLOT(quit()));
+#if QT_VERSION >= 0x050000
+    QVERIFY(doc->saveDocumentInBackground(QUrl::fromLocalFile(fileName)));
+#else
+    QVERIFY(doc->saveDocumentInBackground(KUrl(fileName)));
+#endif
+    QVERIFY(doc->isSavingInBackground());
+    loop.exec();
+    QVERIFY(!doc->isSavingInBackground());
+    QCOMPARE(finished.count(), 1);
+    QCOMPARE(finished.at(0).at(0).toBool(), true);
+    QVERIFY(progress.count() > 0);
+
+    // an autosave leaves the state of the document alone
+    QVERIFY(doc->isModified());
+    QCOMPARE(doc->url().toString(), url);
+
+    // the file is complete and can be loaded
+    QCOMPARE(loadAndSave(fileName, false), expected);
+    QFile::remove(fileName);
+}
+
+void TEST_UMLDoc::test_saveDocumentDuringBackgroundSave()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->closeDocument();
+    UMLFolder *root = doc->rootFolder(Uml::ModelType::Logical);
+    UMLClassifier *c = new UMLClassifier(QLatin1String("Test A"));
+    c->setUMLPackage(root);
+    root->addObject(c);
+    // make the snapshot large enough for the job to be still running
+    for (int i = 0; i < AUTOSAVE_CLASSES; ++i) {
+        UMLClassifier *other = new UMLClassifier(QString(QLatin1String("class%1")).arg(i));
+        other->setUMLPackage(root);
+        root->addObject(other);
+    }
+
+    QString fileName = QDir::tempPath() + QLatin1String("/TEST_umldoc_autosave.xmi");
+#if QT_VERSION >= 0x050000
+    const QUrl url = QUrl::fromLocalFile(fileName);
+#else
+    const KUrl url(fileName);
+#endif
+    QVERIFY(doc->saveDocumentInBackground(url));
+    c->setName(QLatin1String("Test B"));
+    QString expected = save();
+    QVERIFY(doc->saveDocument(url));
+    if (doc->isSavingInBackground()) {
+        QEventLoop loop;
+        connect(doc, SIGNAL(sigBackgroundSaveFinished(bool,QString)), &loop, SLOT(quit()));
+        loop.exec();
+    }
+    QVERIFY(!doc->isSavingInBackground());
+
+    // the older snapshot of the autosave did not replace the saved file
+    QCOMPARE(loadAndSave(fileName, false), expected);
+    QFile::remove(fileName);
+}
+
+ThreadRecorder::ThreadRecorder()
+  : m_thread(0)
+{
+}
+
+/**
+ * Return the thread record() was called in last.
+ */
+QThread *ThreadRecorder::recordedThread() const
+{
+    return m_thread;
+}
+
+void ThreadRecorder::record()
+{
+    m_thread = QThread::currentThread();
+}
+
+EventLoopProbe::EventLoopProbe(QThread *thread)
+  : m_thread(thread),
+    m_callsWhileRunning(0)
+{
+}
+
+/**
+ * Return the number of calls of probe() made while the thread was running.
+ */
+int EventLoopProbe::callsWhileRunning() const
+{
+    return m_callsWhileRunning;
+}
+
+void EventLoopProbe::probe()
+{
+    if (m_thread->isRunning() && QThread::currentThread() == thread()) {
+        ++m_callsWhileRunning;
+    }
+}
+
+QTEST_MAIN(TEST_UMLDoc)
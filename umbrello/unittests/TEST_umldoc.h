@@ -0,0 +1,102 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEST_UMLDOC_H
+#define TEST_UMLDOC_H
+
+#include "testbase.h"
+
+// app includes
+#include "basictypes.h"
+
+// qt includes
+#include <QList>
+
+class QThread;
+
+/**
+ * Unit test for class UMLDoc (umldoc.h).
+ */
+class TEST_UMLDoc : public TestBase
+{
+    Q_OBJECT
+private slots:
+    void test_findObjectById();
+    void test_loadLargeModel();
+    void test_findObjectByIdWalk();
+    void test_findObjectByIdIndexed();
+    void test_loadFromXMI_data();
+    void test_loadFromXMI();
+    void test_saveToXMI_data();
+    void test_saveToXMI();
+    void test_lazyDiagramLoad_data();
+    void test_lazyDiagramLoad();
+    void test_removeObjectOfDeferredView();
+    void test_saveInBackground();
+    void test_saveInBackgroundCompressed();
+    void test_saveDocumentInBackground();
+    void test_saveDocumentDuringBackgroundSave();
+
+private:
+    QList<Uml::ID::Type> m_sampleIDs;
+};
+
+/**
+ * Records the thread its slot is called in, connect it with
+ * Qt::DirectConnection.
+ */
+class ThreadRecorder : public QObject
+{
+    Q_OBJECT
+public:
+    ThreadRecorder();
+
+    QThread *recordedThread() const;
+
+public slots:
+    void record();
+
+private:
+    QThread *m_thread;
+};
+
+/**
+ * Counts the calls of its slot made while the given thread is running.
+ * Connected with Qt::BlockingQueuedConnection to a signal of that
+ * thread, each call shows that the event loop of the thread owning the
+ * object is processing events while the other thread is working.
+ */
+class EventLoopProbe : public QObject
+{
+    Q_OBJECT
+public:
+    explicit EventLoopProbe(QThread *thread);
+
+    int callsWhileRunning() const;
+
+public slots:
+    void probe();
+
+private:
+    QThread *m_thread;
+    int m_callsWhileRunning;
+};
+
+#endif // TEST_UMLDOC_H
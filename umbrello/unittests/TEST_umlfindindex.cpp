@@ -0,0 +1,223 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_umlfindindex.h"
+
+// app includes
+#include "associationwidget.h"
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "folder.h"
+#include "object_factory.h"
+#include "objectwidget.h"
+#include "operation.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umldocfinder.h"
+#include "umlfindindex.h"
+#include "umlscenefinder.h"
+#include "umlscene.h"
+#include "umlview.h"
+
+// qt includes
+#include <QElapsedTimer>
+
+/**
+ * Create a new document with a class of the given name in the logical view.
+ */
+static UMLClassifier *createClass(const QString &name)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+    return static_cast<UMLClassifier*>(Object_Factory::createUMLObject(UMLObject::ot_Class, name, logicalView, false));
+}
+
+/**
+ * Return the names of the objects, sorted.
+ */
+static QStringList names(const UMLObjectList &objects)
+{
+    QStringList result;
+    foreach (UMLObject *o, objects) {
+        result.append(o->name());
+    }
+    result.sort();
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+
+void TEST_UMLFindIndex::test_findName()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    createClass(QLatin1String("Customer"));
+    createClass(QLatin1String("CustomerAccount"));
+    createClass(QLatin1String("Account"));
+    UMLFindIndex *index = doc->findIndex();
+
+    QCOMPARE(names(index->find(QLatin1String("cust"), UMLFinder::Prefix)),
+             QStringList() << QLatin1String("Customer") << QLatin1String("CustomerAccount"));
+    QCOMPARE(names(index->find(QLatin1String("ACCOUNT"), UMLFinder::Substring)),
+             QStringList() << QLatin1String("Account") << QLatin1String("CustomerAccount"));
+    QCOMPARE(names(index->find(QLatin1String("co"), UMLFinder::Substring)),
+             QStringList() << QLatin1String("Account") << QLatin1String("CustomerAccount"));
+    QCOMPARE(names(index->find(QLatin1String("^c.*r$"), UMLFinder::RegExp)),
+             QStringList() << QLatin1String("Customer"));
+    QVERIFY(index->find(QLatin1String("supplier")).isEmpty());
+    QVERIFY(index->find(QLatin1String("("), UMLFinder::RegExp).isEmpty());
+}
+
+void TEST_UMLFindIndex::test_findStereotypeAndDocumentation()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLClassifier *entity = createClass(QLatin1String("Order"));
+    entity->setStereotypeCmd(QLatin1String("entity"));
+    UMLClassifier *documented = createClass(QLatin1String("Invoice"));
+    documented->setDoc(QLatin1String("Created for every shipped order"));
+    UMLFindIndex *index = doc->findIndex();
+
+    QCOMPARE(names(index->find(QLatin1String("order"))), QStringList() << QLatin1String("Order"));
+    QCOMPARE(names(index->find(QLatin1String("entity"), UMLFinder::Substring, UMLFinder::Stereotypes)),
+             QStringList() << QLatin1String("Order"));
+    QCOMPARE(names(index->find(QLatin1String("order"), UMLFinder::Substring,
+                               UMLFinder::Names | UMLFinder::Documentation)),
+             QStringList() << QLatin1String("Invoice") << QLatin1String("Order"));
+}
+
+void TEST_UMLFindIndex::test_category()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLClassifier *c = createClass(QLatin1String("Printer"));
+    UMLOperation *op = c->createOperation(QLatin1String("print"));
+    QVERIFY(op);
+    UMLFindIndex *index = doc->findIndex();
+
+    QCOMPARE(index->find(QLatin1String("print")).count(), 2);
+    UMLObjectList operations = index->find(QLatin1String("print"), UMLFinder::Substring,
+                                           UMLFinder::Names, UMLFinder::Operations);
+    QCOMPARE(operations.count(), 1);
+    QCOMPARE(operations.first().data(), static_cast<UMLObject*>(op));
+}
+
+void TEST_UMLFindIndex::test_changedObjects()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLClassifier *c = createClass(QLatin1String("Before"));
+    UMLFindIndex *index = doc->findIndex();
+    QCOMPARE(index->find(QLatin1String("before")).count(), 1);
+    QVERIFY(index->isBuilt());
+
+    c->setNameCmd(QLatin1String("After"));
+    QVERIFY(index->find(QLatin1String("before")).isEmpty());
+    QCOMPARE(index->find(QLatin1String("after")).count(), 1);
+
+    createClass(QLatin1String("AfterAll"));
+    QCOMPARE(index->find(QLatin1String("after")).count(), 2);
+
+    doc->removeUMLObject(c, true);
+    QCOMPARE(names(index->find(QLatin1String("after"))), QStringList() << QLatin1String("AfterAll"));
+
+    doc->newDocument();
+    QVERIFY(!index->isBuilt());
+    QVERIFY(index->find(QLatin1String("after")).isEmpty());
+}
+
+void TEST_UMLFindIndex::test_diagrams()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLClassifier *shown = createClass(QLatin1String("Shown"));
+    UMLClassifier *hidden = createClass(QLatin1String("Hidden"));
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("diagram"));
+    UMLScene *scene = view->umlScene();
+    ClassifierWidget *w = new ClassifierWidget(scene, shown);
+    scene->widgetList().append(w);
+    UMLFindIndex *index = doc->findIndex();
+
+    QCOMPARE(index->find(QLatin1String("shown")).count(), 1);
+    QCOMPARE(index->diagrams(shown), QList<Uml::ID::Type>() << scene->ID());
+    QVERIFY(index->diagrams(hidden).isEmpty());
+
+    // widget lists are compared on each query
+    ClassifierWidget *hiddenWidget = new ClassifierWidget(scene, hidden);
+    scene->widgetList().append(hiddenWidget);
+    index->find(QString());
+    QCOMPARE(index->diagrams(hidden), QList<Uml::ID::Type>() << scene->ID());
+
+    // associations are shown on the diagram as well
+    AssociationWidget *a = AssociationWidget::create(scene, w, Uml::AssociationType::Association, hiddenWidget);
+    scene->addAssociation(a);
+    QVERIFY(a->umlObject());
+    index->find(QString());
+    QCOMPARE(index->diagrams(a->umlObject()), QList<Uml::ID::Type>() << scene->ID());
+}
+
+void TEST_UMLFindIndex::test_sceneFinder()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLClassifier *c = createClass(QLatin1String("Customer"));
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Sequence, QLatin1String("sequence"));
+    UMLScene *scene = view->umlScene();
+    ObjectWidget *w = new ObjectWidget(scene, c);
+    w->setInstanceName(QLatin1String("alice"));
+    scene->widgetList().append(w);
+
+    // the instance name is only known to the widget
+    QVERIFY(doc->findIndex()->find(QLatin1String("alice")).isEmpty());
+    UMLSceneFinder sceneFinder(view);
+    QCOMPARE(sceneFinder.collect(UMLFinder::All, QLatin1String("alice"), UMLFinder::Substring, UMLFinder::Names), 1);
+    QCOMPARE(sceneFinder.collect(UMLFinder::Classes, QLatin1String("ALI"), UMLFinder::Prefix, UMLFinder::Names), 1);
+    QCOMPARE(sceneFinder.collect(UMLFinder::All, QLatin1String("cust"), UMLFinder::Prefix, UMLFinder::Names), 1);
+    QCOMPARE(sceneFinder.collect(UMLFinder::Operations, QLatin1String("alice"), UMLFinder::Substring, UMLFinder::Names), 0);
+    QCOMPARE(sceneFinder.collect(UMLFinder::All, QLatin1String("alice"), UMLFinder::Substring, UMLFinder::Documentation), 0);
+
+    UMLDocFinder docFinder;
+    QCOMPARE(docFinder.collect(UMLFinder::All, QLatin1String("alice"), UMLFinder::Substring, UMLFinder::Names), 1);
+}
+
+void TEST_UMLFindIndex::benchmark_find()
+{
+    const int count = 10000;
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    for (int i = 0; i < count; ++i) {
+        createClass(QString::fromLatin1("Class%1").arg(i));
+    }
+    UMLFindIndex *index = doc->findIndex();
+
+    QElapsedTimer timer;
+    timer.start();
+    QCOMPARE(index->find(QLatin1String("class")).count(), count);
+    qDebug() << "built index of" << count << "classes in" << timer.elapsed() << "ms";
+
+    QBENCHMARK {
+        QCOMPARE(index->find(QLatin1String("ss123")).count(), 11);
+        QCOMPARE(index->find(QLatin1String("class99"), UMLFinder::Prefix).count(), 111);
+    }
+}
+
+QTEST_MAIN(TEST_UMLFindIndex)
@@ -0,0 +1,125 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_umllistview.h"
+
+// app includes
+#include "folder.h"
+#include "object_factory.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umllistview.h"
+#include "umllistviewitem.h"
+#include "umlobjectlist.h"
+#include "uniqueid.h"
+
+// qt includes
+#include <QElapsedTimer>
+
+/**
+ * Number of classes of the generated model used by the benchmarks.
+ */
+static const int ModelSize = 2000;
+
+/**
+ * Create a new document with @p count classes in the logical view.
+ */
+static UMLObjectList createModel(int count)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+
+    QElapsedTimer timer;
+    timer.start();
+    UMLObjectList objects;
+    for (int i = 0; i < count; ++i) {
+        objects.append(Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                                       QString::fromLatin1("Class%1").arg(i),
+                                                       logicalView, false));
+    }
+    qDebug() << "created" << count << "classes in" << timer.elapsed() << "ms";
+    return objects;
+}
+
+//-----------------------------------------------------------------------------
+
+void TEST_UMLListView::test_findItem()
+{
+    UMLObjectList objects = createModel(10);
+    UMLListView *listView = UMLApp::app()->listView();
+    foreach(UMLObject *o, objects) {
+        UMLListViewItem *item = listView->findUMLObject(o);
+        QVERIFY(item);
+        QCOMPARE(item->umlObject(), o);
+        QCOMPARE(listView->findItem(o->id()), item);
+        QCOMPARE(listView->theLogicalView()->findUMLObject(o), item);
+    }
+}
+
+void TEST_UMLListView::test_findItemAfterSetID()
+{
+    UMLObjectList objects = createModel(1);
+    UMLListView *listView = UMLApp::app()->listView();
+    UMLObject *o = objects.first();
+    UMLListViewItem *item = listView->findUMLObject(o);
+    QVERIFY(item);
+
+    Uml::ID::Type oldId = o->id();
+    o->setID(UniqueID::gen());
+    QCOMPARE(listView->findItem(o->id()), item);
+    QCOMPARE(listView->findUMLObject(o), item);
+    QVERIFY(listView->findItem(oldId) == 0);
+}
+
+void TEST_UMLListView::test_findRemovedItem()
+{
+    UMLObjectList objects = createModel(2);
+    UMLListView *listView = UMLApp::app()->listView();
+    UMLObject *removed = objects.first();
+    Uml::ID::Type id = removed->id();
+    UMLApp::app()->document()->removeUMLObject(removed, true);
+    QVERIFY(listView->findItem(id) == 0);
+    QVERIFY(listView->findUMLObject(objects.last()));
+}
+
+void TEST_UMLListView::benchmark_findIndexed()
+{
+    UMLObjectList objects = createModel(ModelSize);
+    UMLListView *listView = UMLApp::app()->listView();
+    QBENCHMARK {
+        foreach(UMLObject *o, objects) {
+            QVERIFY(listView->findItem(o->id()));
+        }
+    }
+}
+
+void TEST_UMLListView::benchmark_findByTreeWalk()
+{
+    UMLObjectList objects = createModel(ModelSize);
+    UMLListViewItem *logicalView = UMLApp::app()->listView()->theLogicalView();
+    QBENCHMARK {
+        foreach(UMLObject *o, objects) {
+            QVERIFY(logicalView->findItem(o->id()));
+        }
+    }
+}
+
+QTEST_MAIN(TEST_UMLListView)
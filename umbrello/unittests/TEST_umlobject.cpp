@@ -31,6 +31,9 @@
 // kde includes
 #include <KLocalizedString>
 
+// qt includes
+#include <QSignalSpy>
+
 const bool IS_NOT_IMPL = false;
 
 //-----------------------------------------------------------------------------
@@ -217,4 +220,35 @@ void TEST_UMLObject::test_toString()
     QCOMPARE(UMLObject::toI18nString(UMLObject::ot_Class), i18n("Class &name:"));
 }
 
+void TEST_UMLObject::test_changeBatch()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    UMLObject a("Test A");
+    UMLObject b("Test B");
+    QSignalSpy spyA(&a, SIGNAL(modified()));
+    QSignalSpy spyB(&b, SIGNAL(modified()));
+    const uint saved = doc->savedNotificationCount();
+
+    doc->beginChangeBatch();
+    a.setAbstract(true);
+    a.setStatic(true);
+    doc->beginChangeBatch();
+    a.setVisibility(Uml::Visibility::Private);
+    b.setStatic(true);
+    doc->commitChangeBatch();
+    QCOMPARE(spyA.count(), 0);
+    QCOMPARE(spyB.count(), 0);
+    doc->commitChangeBatch();
+
+    // one notification per object
+    QCOMPARE(spyA.count(), 1);
+    QCOMPARE(spyB.count(), 1);
+    QVERIFY(doc->savedNotificationCount() >= saved + 2);
+    QVERIFY(!doc->isBatchingChanges());
+
+    // outside of a batch each change is notified
+    a.setAbstract(false);
+    QCOMPARE(spyA.count(), 2);
+}
+
 QTEST_MAIN(TEST_UMLObject)
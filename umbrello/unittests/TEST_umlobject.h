@@ -41,6 +41,7 @@ private slots:
     void test_setUMLPackage();
     void test_setVisibility();
     void test_toString();
+    void test_changeBatch();
 };
 
 #endif // TEST_UMLOBJECT_H
@@ -0,0 +1,378 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_umlscene.h"
+
+// app includes
+#include "associationline.h"
+#include "associationwidget.h"
+#include "boxwidget.h"
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "cmds.h"
+#include "floatingtextwidget.h"
+#include "folder.h"
+#include "object_factory.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "uniqueid.h"
+
+// qt includes
+#include <QImage>
+#include <QPainter>
+
+// number of widgets in each direction of the benchmark diagrams
+const int GRID = 100;
+
+// size of and distance between the widgets
+const qreal SIZE = 40;
+const qreal DISTANCE = 60;
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Create a class diagram with a grid of box widgets.
+ */
+UMLScene *TEST_UMLScene::createScene(int rows, int columns)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("scene"));
+    UMLScene *scene = view->umlScene();
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            BoxWidget *w = new BoxWidget(scene, UniqueID::gen());
+            w->setSize(SIZE, SIZE);
+            w->setX(column * DISTANCE);
+            w->setY(row * DISTANCE);
+            scene->widgetList().append(w);
+        }
+    }
+    return scene;
+}
+
+/**
+ * Create a class diagram with a grid of classes, each associated with its
+ * right neighbour.
+ */
+UMLScene *TEST_UMLScene::createClassDiagram(int rows, int columns)
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLFolder *logicalView = doc->rootFolder(Uml::ModelType::Logical);
+    UMLView *view = doc->createDiagram(logicalView, Uml::DiagramType::Class, QLatin1String("classes"));
+    UMLScene *scene = view->umlScene();
+    for (int row = 0; row < rows; ++row) {
+        ClassifierWidget *left = 0;
+        for (int column = 0; column < columns; ++column) {
+            UMLObject *o = Object_Factory::createUMLObject(UMLObject::ot_Class,
+                                                           QString::fromLatin1("C%1_%2").arg(row).arg(column),
+                                                           logicalView, false);
+            ClassifierWidget *w = new ClassifierWidget(scene, static_cast<UMLClassifier*>(o));
+            w->setSize(2 * SIZE, SIZE);
+            w->setX(column * 2 * DISTANCE);
+            w->setY(row * DISTANCE);
+            scene->widgetList().append(w);
+            if (left) {
+                AssociationWidget *a = AssociationWidget::create(scene, left, Uml::AssociationType::Association, w);
+                scene->addAssociation(a);
+            }
+            left = w;
+        }
+    }
+    return scene;
+}
+
+void TEST_UMLScene::test_widgetAt()
+{
+    UMLScene *scene = createScene(2, 2);
+    UMLWidget *first = scene->widgetList().first();
+    QCOMPARE(scene->widgetAt(QPointF(SIZE / 2, SIZE / 2)), first);
+    QCOMPARE(scene->widgetAt(QPointF(DISTANCE + SIZE / 2, DISTANCE + SIZE / 2)),
+             scene->widgetList().last());
+    QVERIFY(scene->widgetAt(QPointF(SIZE + 10, SIZE + 10)) == 0);
+
+    // the smallest widget wins
+    BoxWidget *inner = new BoxWidget(scene, UniqueID::gen());
+    inner->setSize(SIZE / 4, SIZE / 4);
+    inner->setX(SIZE / 2);
+    inner->setY(SIZE / 2);
+    scene->widgetList().append(inner);
+    QCOMPARE(scene->widgetAt(QPointF(SIZE / 2 + 1, SIZE / 2 + 1)), inner);
+
+    // moved widgets are found at their new position
+    first->setX(-200);
+    QCOMPARE(scene->widgetAt(QPointF(-200 + SIZE / 2, SIZE / 4)), first);
+    QVERIFY(scene->widgetAt(QPointF(SIZE / 4, SIZE / 4)) == 0);
+}
+
+void TEST_UMLScene::test_findWidget()
+{
+    UMLScene *scene = createScene(3, 3);
+    UMLWidget *w = scene->widgetList().at(4);
+    const Uml::ID::Type id = w->id();
+    QCOMPARE(scene->findWidget(id), w);
+    QCOMPARE(scene->findWidget(id), w);
+    QCOMPARE(scene->widgetOnDiagram(id), w);
+
+    // removed widgets are not found any more
+    scene->removeWidget(w);
+    QVERIFY(scene->findWidget(id) == 0);
+    QVERIFY(scene->widgetOnDiagram(id) == 0);
+    QVERIFY(scene->findWidget(UniqueID::gen()) == 0);
+}
+
+void TEST_UMLScene::test_selectWidgets()
+{
+    UMLScene *scene = createScene(4, 4);
+    // covers the widgets of the second and third row and column
+    scene->selectWidgets(DISTANCE + 1, DISTANCE + 1, 2 * DISTANCE + 1, 2 * DISTANCE + 1);
+    QCOMPARE(scene->selectedWidgets().count(), 4);
+    scene->selectWidgets(4 * DISTANCE, 4 * DISTANCE, 5 * DISTANCE, 5 * DISTANCE);
+    QCOMPARE(scene->selectedWidgets().count(), 0);
+    scene->selectWidgets(-1, -1, 4 * DISTANCE, 4 * DISTANCE);
+    QCOMPARE(scene->selectedWidgets().count(), 16);
+}
+
+void TEST_UMLScene::test_selectAssociationLabel()
+{
+    UMLScene *scene = createClassDiagram(1, 2);
+    AssociationWidget *a = scene->associationList().first();
+    a->setRoleName(QLatin1String("role"), Uml::RoleType::B);
+    FloatingTextWidget *label = a->roleWidget(Uml::RoleType::B);
+    QVERIFY(label);
+    QVERIFY(label->parentItem());
+    // move the label away from the association line and the classes
+    label->setPos(label->parentItem()->mapFromScene(QPointF(DISTANCE, 4 * DISTANCE)));
+    const QRectF labelRect = label->sceneBoundingRect();
+
+    // a rubber band around the label only selects nothing
+    scene->selectWidgets(labelRect.left() - 2, labelRect.top() - 2,
+                         labelRect.right() + 2, labelRect.bottom() + 2);
+    QCOMPARE(scene->selectedWidgets().count(), 0);
+    QVERIFY(!a->isSelected());
+
+    // the label is found through its association
+    QCOMPARE(scene->widgetAt(labelRect.center()), static_cast<UMLWidget*>(label));
+    QVERIFY(scene->widgetAt(labelRect.center()) != a->widgetForRole(Uml::RoleType::B));
+
+    // a rubber band around the classes selects them and the association
+    scene->selectWidgets(-1, -1, 4 * DISTANCE, SIZE + 1);
+    QCOMPARE(scene->selectedWidgets().count(), 2);
+    QVERIFY(a->isSelected());
+}
+
+void TEST_UMLScene::test_undoMoveSelection()
+{
+    UMLScene *scene = createScene(1, 3);
+    UMLApp::app()->enableUndo(true);
+
+    // the moves of one gesture are merged, separate moves are not
+    UMLWidget *first = scene->widgetList().at(0);
+    UMLWidget *second = scene->widgetList().at(1);
+    Uml::CmdMoveWidget separate(first);
+    UMLApp::app()->beginMacro(QLatin1String("Move widgets"));
+    Uml::CmdMoveWidget gesture1(first);
+    Uml::CmdMoveWidget gesture2(second);
+    UMLApp::app()->endMacro();
+    QVERIFY(!separate.mergeWith(&gesture1));
+    QVERIFY(gesture1.mergeWith(&gesture2));
+
+    UMLApp::app()->clearUndoStack();
+    UMLApp::app()->beginMacro(QLatin1String("Move widgets"));
+    foreach (UMLWidget *w, scene->widgetList()) {
+        w->setStartMovePosition(w->pos());
+        w->setX(w->x() + DISTANCE);
+        UMLApp::app()->executeCommand(new Uml::CmdMoveWidget(w));
+    }
+    UMLApp::app()->endMacro();
+
+    UMLApp::app()->undo();
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(scene->widgetList().at(i)->x(), i * DISTANCE);
+    }
+    UMLApp::app()->redo();
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(scene->widgetList().at(i)->x(), (i + 1) * DISTANCE);
+    }
+}
+
+void TEST_UMLScene::test_undoMemoryBudget()
+{
+    const int count = 1000;
+    const qint64 budget = 64 * 1024;
+    UMLScene *scene = createScene(0, 0);
+    UMLApp::app()->enableUndo(true);
+    const qint64 oldBudget = Uml::XMISnapshot::memoryBudget();
+    Uml::XMISnapshot::setMemoryBudget(budget);
+
+    for (int i = 0; i < count; ++i) {
+        BoxWidget *w = new BoxWidget(scene, UniqueID::gen());
+        w->setSize(SIZE, SIZE);
+        w->setX(i * DISTANCE);
+        scene->widgetList().append(w);
+        scene->removeWidget(w);
+    }
+    QCOMPARE(scene->widgetList().count(), 0);
+    qDebug() << "undo snapshots in memory after" << count << "removals:"
+             << Uml::XMISnapshot::memoryUsage() << "bytes";
+    QVERIFY(Uml::XMISnapshot::memoryUsage() <= budget);
+
+    // the swapped out widgets are restored as well
+    for (int i = 0; i < count; ++i) {
+        UMLApp::app()->undo();
+    }
+    QCOMPARE(scene->widgetList().count(), count);
+    QVERIFY(scene->widgetAt(QPointF(SIZE / 2, SIZE / 2)) != 0);
+
+    UMLApp::app()->clearUndoStack();
+    QCOMPARE(Uml::XMISnapshot::memoryUsage(), qint64(0));
+    Uml::XMISnapshot::setMemoryBudget(oldBudget);
+}
+
+void TEST_UMLScene::test_associationLineGeometry()
+{
+    UMLScene *scene = createClassDiagram(1, 2);
+    QCOMPARE(scene->associationList().count(), 1);
+    AssociationLine *line = scene->associationList().first()->associationLine();
+    line->setEndPoints(QPointF(0, 0), QPointF(100, 0));
+    QVERIFY(line->shape().contains(QPointF(50, 0)));
+    QVERIFY(line->boundingRect().contains(QPointF(100, 0)));
+
+    // the cached geometry follows the points
+    line->insertPoint(1, QPointF(50, 100));
+    QVERIFY(!line->shape().contains(QPointF(50, 0)));
+    QVERIFY(line->shape().contains(QPointF(25, 50)));
+    QVERIFY(line->boundingRect().contains(QPointF(50, 100)));
+    line->setPoint(1, QPointF(50, 200));
+    QVERIFY(line->boundingRect().contains(QPointF(50, 200)));
+    QCOMPARE(line->path().elementCount(), 3);
+
+    // and the layout
+    line->setLayout(AssociationLine::Direct);
+    QVERIFY(line->shape().contains(QPointF(50, 0)));
+}
+
+/**
+ * Render the view of the scene at 20% into an image. QWidget::render()
+ * paints the viewport, so the painters of the items refer to it.
+ */
+static QImage renderView(UMLScene *scene)
+{
+    UMLView *view = scene->activeView();
+    view->resize(200, 200);
+    view->setZoom(20);
+    QImage image(view->viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+    image.fill(0);
+    view->viewport()->render(&image);
+    return image;
+}
+
+/**
+ * Render the scene at 20% into an image, like an export does.
+ */
+static QImage renderExport(UMLScene *scene)
+{
+    QImage image(200, 200, QImage::Format_ARGB32_Premultiplied);
+    image.fill(0);
+    QPainter painter(&image);
+    scene->render(&painter, QRectF(image.rect()), QRectF(0, 0, 1000, 1000));
+    return image;
+}
+
+void TEST_UMLScene::test_lowDetail()
+{
+    UMLScene *scene = createClassDiagram(2, 2);
+
+    // only items painted into a view are drawn with less detail
+    QWidget *viewport = scene->activeView()->viewport();
+    QImage image(10, 10, QImage::Format_ARGB32);
+    QPainter painter(&image);
+    QVERIFY(!scene->isLowDetail(&painter, viewport));
+    painter.scale(0.2, 0.2);
+    QVERIFY(scene->isLowDetail(&painter, viewport));
+    QVERIFY(!scene->isLowDetail(&painter, 0));
+    painter.end();
+
+    // a zoomed out view is drawn with less detail unless switched off
+    const QImage lowDetailView = renderView(scene);
+    const QImage lowDetailExport = renderExport(scene);
+    scene->setLowDetailThreshold(0.1);
+    QVERIFY(renderView(scene) != lowDetailView);
+    scene->setLowDetailThreshold(0);
+    QVERIFY(renderView(scene) != lowDetailView);
+
+    // a scaled export is drawn in full detail
+    QVERIFY(renderExport(scene) == lowDetailExport);
+}
+
+void TEST_UMLScene::benchmark_widgetAt()
+{
+    UMLScene *scene = createScene(GRID, GRID);
+    int found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (int i = 0; i < GRID; ++i) {
+            if (scene->widgetAt(QPointF(i * DISTANCE + SIZE / 2, i * DISTANCE + SIZE / 2)))
+                ++found;
+        }
+    }
+    QCOMPARE(found, GRID);
+}
+
+void TEST_UMLScene::benchmark_selectWidgets()
+{
+    UMLScene *scene = createScene(GRID, GRID);
+    QBENCHMARK {
+        scene->selectWidgets(DISTANCE + 1, DISTANCE + 1, 10 * DISTANCE + 1, 10 * DISTANCE + 1);
+    }
+    QCOMPARE(scene->selectedWidgets().count(), 100);
+}
+
+void TEST_UMLScene::benchmark_paint_data()
+{
+    QTest::addColumn<qreal>("zoom");
+    QTest::newRow("10%") << qreal(0.1);
+    QTest::newRow("25%") << qreal(0.25);
+    QTest::newRow("50%") << qreal(0.5);
+    QTest::newRow("100%") << qreal(1.0);
+}
+
+/**
+ * Time the painting of one frame of the view of a large class diagram at
+ * several zoom levels, the first two are drawn with less detail.
+ */
+void TEST_UMLScene::benchmark_paint()
+{
+    QFETCH(qreal, zoom);
+    UMLScene *scene = createClassDiagram(30, 30);
+    UMLView *view = scene->activeView();
+    view->resize(800, 600);
+    view->setZoom(zoom * 100);
+    QImage image(view->viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+    QBENCHMARK {
+        view->viewport()->render(&image);
+    }
+}
+
+QTEST_MAIN(TEST_UMLScene)
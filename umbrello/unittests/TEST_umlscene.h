@@ -0,0 +1,54 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEST_UMLSCENE_H
+#define TEST_UMLSCENE_H
+
+#include "testbase.h"
+
+class UMLScene;
+
+/**
+ * Unit test for the hit tests, the selection, the undo commands and the
+ * painting of class UMLScene (umlscene.h).
+ */
+class TEST_UMLScene : public TestBase
+{
+    Q_OBJECT
+private slots:
+    void test_widgetAt();
+    void test_findWidget();
+    void test_selectWidgets();
+    void test_selectAssociationLabel();
+    void test_undoMoveSelection();
+    void test_undoMemoryBudget();
+    void test_associationLineGeometry();
+    void test_lowDetail();
+    void benchmark_widgetAt();
+    void benchmark_selectWidgets();
+    void benchmark_paint_data();
+    void benchmark_paint();
+
+private:
+    UMLScene *createScene(int rows, int columns);
+    UMLScene *createClassDiagram(int rows, int columns);
+};
+
+#endif // TEST_UMLSCENE_H
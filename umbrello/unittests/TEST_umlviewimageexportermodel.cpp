@@ -0,0 +1,183 @@
+/*
+    Copyright 2016  Umbrello UML Modeller Authors <umbrello-devel@kde.org>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License as
+    published by the Free Software Foundation; either version 2 of
+    the License or (at your option) version 3 or any later version
+    accepted by the membership of KDE e.V. (or its successor approved
+    by the membership of KDE e.V.), which shall act as a proxy
+    defined in Section 14 of version 3 of the license.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TEST_umlviewimageexportermodel.h"
+
+// app includes
+#include "boxwidget.h"
+#include "classifier.h"
+#include "classifierwidget.h"
+#include "folder.h"
+#include "object_factory.h"
+#include "uml.h"
+#include "umldoc.h"
+#include "umlscene.h"
+#include "umlview.h"
+#include "umlviewimageexportermodel.h"
+#include "uniqueid.h"
+
+// kde includes
+#if QT_VERSION < 0x050000
+#include <kurl.h>
+#endif
+
+// qt includes
+#include <QDir>
+#include <QFile>
+#include <QImage>
+
+//-----------------------------------------------------------------------------
+
+/**
+ * Create a class diagram with box widgets of different sizes, so that
+ * the widget borders cross the tile borders at various places.
+ */
+UMLScene *TEST_UMLViewImageExporterModel::createScene()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("export"));
+    UMLScene *scene = view->umlScene();
+    for (int i = 0; i < 6; ++i) {
+        BoxWidget *w = new BoxWidget(scene, UniqueID::gen());
+        w->setSize(30 + 17 * i, 20 + 11 * i);
+        w->setX(23 * i);
+        w->setY(37 * (i % 3));
+        scene->widgetList().append(w);
+    }
+    return scene;
+}
+
+/**
+ * Export the scene to a PNG file in the temporary directory and load it.
+ */
+QImage TEST_UMLViewImageExporterModel::exportImage(const UMLViewImageExporterModel &model,
+                                                   UMLScene *scene, const QString &name)
+{
+    const QString fileName = temporaryPath() + name + QLatin1String(".png");
+#if QT_VERSION >= 0x050000
+    const QUrl url = QUrl::fromLocalFile(fileName);
+#else
+    const KUrl url(fileName);
+#endif
+    const QString error = model.exportView(scene, QLatin1String("png"), url);
+    if (!error.isNull()) {
+        QWARN(qPrintable(error));
+        return QImage();
+    }
+    return QImage(fileName).convertToFormat(QImage::Format_RGB32);
+}
+
+void TEST_UMLViewImageExporterModel::test_tiledExport_data()
+{
+    QTest::addColumn<int>("tileSize");
+    QTest::newRow("single tile") << 4096;
+    QTest::newRow("16 pixels") << 16;
+    QTest::newRow("7 pixels") << 7;
+    QTest::newRow("1 pixel") << 1;
+}
+
+void TEST_UMLViewImageExporterModel::test_tiledExport()
+{
+    QFETCH(int, tileSize);
+    UMLScene *scene = createScene();
+
+    UMLViewImageExporterModel monolithic;
+    const QImage expected = exportImage(monolithic, scene, QLatin1String("monolithic"));
+    QVERIFY(!expected.isNull());
+
+    UMLViewImageExporterModel tiled;
+    tiled.setMaxImagePixels(0);
+    tiled.setTileSize(tileSize);
+    const QImage stitched = exportImage(tiled, scene, QLatin1String("tiled"));
+    QCOMPARE(stitched.size(), expected.size());
+    QVERIFY(stitched == expected);
+}
+
+/**
+ * Export a class diagram with skipping unchanged views several times.
+ * The exported file is overwritten between the exports, so a skipped
+ * export leaves the overwritten content.
+ */
+void TEST_UMLViewImageExporterModel::test_skipUnchanged()
+{
+    UMLDoc *doc = UMLApp::app()->document();
+    doc->newDocument();
+    UMLView *view = doc->createDiagram(doc->rootFolder(Uml::ModelType::Logical),
+                                       Uml::DiagramType::Class, QLatin1String("skip"));
+    UMLScene *scene = view->umlScene();
+    UMLClassifier *c = static_cast<UMLClassifier*>(
+        Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("A"), 0, false));
+    // the type is not shown in the diagram
+    UMLClassifier *type = static_cast<UMLClassifier*>(
+        Object_Factory::createUMLObject(UMLObject::ot_Class, QLatin1String("B"), 0, false));
+    c->addAttribute(QLatin1String("a"), type, Uml::Visibility::Public);
+    ClassifierWidget *w = new ClassifierWidget(scene, c);
+    w->setVisualProperty(ClassifierWidget::ShowAttributes, true);
+    w->setSize(w->calculateSize());
+    scene->widgetList().append(w);
+
+    UMLViewList views;
+    views.append(view);
+    const QString directory = temporaryPath() + QLatin1String("skip");
+    QDir().mkpath(directory);
+    const QString fileName = directory + QLatin1String("/skip.png");
+    const QString stateFileName = directory + QLatin1String("/.umbrello-export");
+    QFile::remove(fileName);
+    QFile::remove(stateFileName);
+    const QUrl url = QUrl::fromLocalFile(directory);
+    UMLViewImageExporterModel model;
+
+    // the first export writes the image and the state file
+    QVERIFY(model.exportViews(views, QLatin1String("png"), url, false, true).isEmpty());
+    QVERIFY(!QImage(fileName).isNull());
+    QFile stateFile(stateFileName);
+    QVERIFY(stateFile.open(QIODevice::ReadOnly));
+    QVERIFY(stateFile.readAll().contains("\tskip.png\n"));
+    stateFile.close();
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("stale");
+    file.close();
+
+    // an unchanged view is skipped by the state file read back
+    QVERIFY(model.exportViews(views, QLatin1String("png"), url, false, true).isEmpty());
+    QVERIFY(QImage(fileName).isNull());
+
+    // a changed model object is exported again
+    c->addAttribute(QLatin1String("b"), type, Uml::Visibility::Public);
+    QVERIFY(model.exportViews(views, QLatin1String("png"), url, false, true).isEmpty());
+    QVERIFY(!QImage(fileName).isNull());
+
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("stale");
+    file.close();
+    QVERIFY(model.exportViews(views, QLatin1String("png"), url, false, true).isEmpty());
+    QVERIFY(QImage(fileName).isNull());
+
+    // renaming a type referenced by the diagram is noticed
+    type->setName(QLatin1String("C"));
+    QVERIFY(model.exportViews(views, QLatin1String("png"), url, false, true).isEmpty());
+    QVERIFY(!QImage(fileName).isNull());
+}
+
+QTEST_MAIN(TEST_UMLViewImageExporterModel)